@@ -19,3 +19,12 @@ function(configure_test link_libs)
     )
     add_test(${PROJECT_NAME} ${PROJECT_NAME})
 endfunction()
+
+# Configure for building a benchmark. Benchmarks are built along with everything else, but are not run as part of the tests.
+#
+# param0 - link_libs - libraries that are to be linked as part of the building
+function(configure_benchmark link_libs)
+    file(GLOB_RECURSE benchmark_src_files CONFIGURE_DEPENDS src/*.cpp)
+    add_executable(${PROJECT_NAME} ${benchmark_src_files})
+    target_link_libraries(${PROJECT_NAME} ${link_libs})
+endfunction()
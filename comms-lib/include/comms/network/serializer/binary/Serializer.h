@@ -163,6 +163,43 @@ namespace cadf::comms::binary {
             }
     };
 
+    /**
+     * Struct that can be used to allow for uniform calls to serialization and deserialization regardless of the type.
+     * std::string must be explicitly specified, as otherwise it can be matched as a dynamic array.
+     */
+    template<>
+    struct DataSerializer<std::string> {
+            /**
+             * Determine the size of a string
+             *
+             * @param &data const std::string reference to the string
+             */
+            static size_t sizeOf(const std::string &data) {
+                return binary::sizeOfData(data);
+            }
+
+            /**
+             * Serialize a string
+             *
+             * @param &data const std::string reference to the string
+             * @param *buffer OutputBuffer pointer where the data is to be copied to
+             */
+            static void serialize(const std::string &data, OutputBuffer *buffer) {
+                binary::serializeData(data, buffer);
+            }
+
+            /**
+             * Deserialize a string
+             *
+             * @param *buffer InputBuffer pointer where the data is to be copied from
+             *
+             * @return std::string as retrieved from the buffer
+             */
+            static std::string deserialize(InputBuffer *buffer) {
+                return binary::deserializeData<std::string>(buffer);
+            }
+    };
+
     /**
      * Struct that can be used to allow for uniform calls to serialization and deserialization regardless of the type.
      *
@@ -2,6 +2,7 @@
 #define CAMB_NETWORK_JSON_SERIALIZER_H_
 
 #include "comms/network/serializer/dom/SerializationFuncs.h"
+#include "comms/network/serializer/dom/OutputBufferSink.h"
 #include "comms/network/serializer/TemplateProtocol.h"
 #include "comms/network/NetworkException.h"
 #include "comms/message/Message.h"
@@ -25,12 +26,11 @@ namespace cadf::comms::dom {
              * @param *msg const AbstractDataMessage that is to be serialized
              */
             Serializer(cadf::dom::DomConverter *converter, const AbstractDataMessage<T> *msg, int type, int instance)
-                    : ISerializer(msg->getType()), m_type(type), m_instance(instance) {
-                cadf::dom::DomNode root = cadf::dom::buildNode("message", m_msgType);
-                root["type"] = m_type;
-                root["instance"] = m_instance;
-                root["data"] = buildTree<T>(msg->getData());
-                m_stringRep = converter->toString(root);
+                    : ISerializer(msg->getType()), m_converter(converter), m_type(type), m_instance(instance) {
+                m_root = cadf::dom::buildNode("message", m_msgType);
+                m_root["type"] = m_type;
+                m_root["instance"] = m_instance;
+                m_root["data"] = buildTree<T>(msg->getData());
             }
 
             /**
@@ -39,7 +39,7 @@ namespace cadf::comms::dom {
              * @return size_t the number of bytes (characters) required in order to properly serialize the message
              */
             size_t getSize() const {
-                return m_stringRep.size() + 1; // +1 for null terminator
+                return m_converter->size(m_root) + 1; // +1 for null terminator
             }
 
             /**
@@ -50,12 +50,16 @@ namespace cadf::comms::dom {
              * Note: this is dependent on pre-existing external buildTree functions being available for the population of the DOM tree with the data.
              */
             void serialize(OutputBuffer *buffer) {
-                buffer->append(m_stringRep.c_str(), getSize());
+                OutputBufferSink sink(buffer);
+                m_converter->write(m_root, &sink);
+                buffer->append('\0', 1);
             }
 
-        private:
-            /** The representation of the message as a string */
-            std::string m_stringRep;
+        protected:
+            // The converter which writes the tree
+            cadf::dom::DomConverter *m_converter;
+            // The tree representing the message
+            cadf::dom::DomNode m_root;
             // The type of recipient
             int m_type;
             // The instance of the type
@@ -75,6 +79,14 @@ namespace cadf::comms::dom {
              */
             Deserializer(cadf::dom::DomConverter *converter, InputBuffer *buffer);
 
+            /**
+             * CTOR
+             *
+             * @param *converter cadf::dom::DomConverter which is to convert the data
+             * @param data std::string_view over the received representation of the message, which is converted in place
+             */
+            Deserializer(cadf::dom::DomConverter *converter, std::string_view data);
+
             /**
              * DTOR
              */
@@ -0,0 +1,86 @@
+#ifndef COMMS_NETWORK_SERIALIZER_DOM_CBORSERIALIZER_H_
+#define COMMS_NETWORK_SERIALIZER_DOM_CBORSERIALIZER_H_
+
+#include "comms/network/serializer/dom/BaseSerializer.h"
+#include "dom/cbor/CborConverter.h"
+
+namespace cadf::comms::dom::cbor {
+
+    /**
+     * Serializes the data contained within a message into CBOR. The same buildTree() as for the JSONProtocol is used to build
+     * the tree, however the tree is written in binary rather than as text. As the CBOR is binary, it is not null terminated.
+     *
+     * @template class T the type of data contained within the message
+     */
+    template<class T>
+    class CborSerializer: public Serializer<T> {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *msg const AbstractDataMessage containing the data to be serialized
+             * @param type int the type of the destination to receive the message
+             * @param instance int the instance of the destination to receive the message
+             */
+            CborSerializer(const AbstractDataMessage<T> *msg, int type, int instance):
+                Serializer<T>(cadf::dom::cbor::CborConverter::instance(), msg, type, instance) {
+            }
+
+            /**
+             * Determine the size of the message when it is serialized to CBOR.
+             *
+             * @return size_t the number of bytes required in order to serialize the message
+             */
+            size_t getSize() const {
+                return this->m_converter->size(this->m_root);
+            }
+
+            /**
+             * Serialize the data.
+             *
+             * @param *buffer OutputBuffer pointer where the data is to be copied to
+             */
+            void serialize(OutputBuffer *buffer) {
+                OutputBufferSink sink(buffer);
+                this->m_converter->write(this->m_root, &sink);
+            }
+    };
+
+    /**
+     * Deserializes the data within the received CBOR into a proper data message
+     */
+    class CborDeserializer: public Deserializer {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *buffer InputBuffer where the data of the received message is stored
+             */
+            CborDeserializer(InputBuffer *buffer): Deserializer(cadf::dom::cbor::CborConverter::instance(), std::string_view(buffer->getData(), buffer->getDataSize())) {
+            }
+    };
+
+    /**
+     * SerializerFactory for the (de)serialization of messages to/from CBOR.
+     *
+     * @template T class indicating the type of data that is stored within the message
+     */
+    template<class T>
+    struct CBORSerializerFactory: public TemplateSerializerFactory<CborSerializer, CborDeserializer, T> {
+
+            /**
+             * CTOR
+             */
+            CBORSerializerFactory() : TemplateSerializerFactory<CborSerializer, CborDeserializer, T>("CBOR") {
+            }
+    };
+
+    /**
+     * The protocol through which to handle the (de)serialization of messages to CBOR. This uses the same buildTree() and loadFromTree()
+     * functions as the JSONProtocol, but is considerably more compact and faster to (de)serialize.
+     */
+    struct CBORProtocol: public Protocol<CBORSerializerFactory, CborDeserializer> {
+    };
+}
+
+#endif /* COMMS_NETWORK_SERIALIZER_DOM_CBORSERIALIZER_H_ */
@@ -3,6 +3,7 @@
 
 #include "comms/network/serializer/dom/BaseSerializer.h"
 #include "dom/json/JsonConverter.h"
+#include "dom/json/LazyJsonDocument.h"
 
 namespace cadf::comms::dom::json {
 
@@ -27,17 +28,51 @@ namespace cadf::comms::dom::json {
     };
 
     /**
-     * Deserializes the data within the received JSON string into a proper data message
+     * Deserializes the data within the received JSON string into a proper data message. The JSON is only parsed on demand: the
+     * details of the message (type, instance, message) are read without parsing the data, which is only parsed once it is
+     * retrieved. A message which is not processed (or is only relayed) is therefore never fully parsed.
+     *
+     * The deserializer refers to the JSON within the buffer, as such the buffer must outlive it.
      */
-    class JsonDeserializer: public Deserializer {
+    class JsonDeserializer: public IDeserializer {
         public:
             /**
              * CTOR
              *
              * @param *buffer InputBuffer where the data of the received message is stored
              */
-            JsonDeserializer(InputBuffer *buffer): Deserializer(cadf::dom::json::JsonConverter::instance(), buffer) {
+            JsonDeserializer(InputBuffer *buffer);
+
+            /**
+             * DTOR
+             */
+            virtual ~JsonDeserializer() = default;
+
+            /**
+             * Load the data from the message and populate a data structure with it.
+             *
+             * @template T the type of class (struct) where the data is contained
+             * @return T the data structure with the loaded data
+             *
+             * Note: this is dependent on pre-existing external loadFromTree functions being available for the population of the data type.
+             */
+            template<class T>
+            T getData() const {
+                return loadFromTree<T>(m_document["data"]);
             }
+
+            /**
+             * Get the underlying document, to allow for inspecting the raw content of the message without parsing it.
+             *
+             * @return const cadf::dom::json::LazyJsonDocument& of the received JSON
+             */
+            const cadf::dom::json::LazyJsonDocument& getDocument() const {
+                return m_document;
+            }
+
+        private:
+            // The received JSON, indexed but only parsed on demand
+            cadf::dom::json::LazyJsonDocument m_document;
     };
 
     /**
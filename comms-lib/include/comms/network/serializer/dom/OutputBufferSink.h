@@ -0,0 +1,39 @@
+#ifndef COMMS_NETWORK_SERIALIZER_DOM_OUTPUTBUFFERSINK_H_
+#define COMMS_NETWORK_SERIALIZER_DOM_OUTPUTBUFFERSINK_H_
+
+#include "comms/network/Buffer.h"
+#include "dom/OutputSink.h"
+
+namespace cadf::comms::dom {
+
+    /**
+     * Sink which allows for a DomConverter to write directly into an OutputBuffer.
+     */
+    class OutputBufferSink: public cadf::dom::OutputSink {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *buffer OutputBuffer where the data is to be written
+             */
+            OutputBufferSink(OutputBuffer *buffer) : m_buffer(buffer) {
+            }
+
+            /**
+             * Append the data to the buffer.
+             *
+             * @throws BufferOverflowException if the buffer is too small
+             * @param *data const char pointer to the data to write
+             * @param size size_t the number of bytes to write
+             */
+            void write(const char *data, size_t size) {
+                m_buffer->append(data, size);
+            }
+
+        private:
+            // Where the data is written to
+            OutputBuffer *m_buffer;
+    };
+}
+
+#endif /* COMMS_NETWORK_SERIALIZER_DOM_OUTPUTBUFFERSINK_H_ */
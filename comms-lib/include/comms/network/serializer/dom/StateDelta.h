@@ -0,0 +1,167 @@
+#ifndef CAMB_NETWORK_DOM_STATEDELTA_H_
+#define CAMB_NETWORK_DOM_STATEDELTA_H_
+
+#include "comms/network/serializer/dom/SerializationFuncs.h"
+#include "dom/DomNode.h"
+
+#include <cstdint>
+#include <map>
+#include <optional>
+
+namespace cadf::comms::dom {
+
+    /**
+     * The data of a message which carries a state, either in full or as a patch (see cadf::dom::DomPatch) against a state which was
+     * previously sent and acknowledged. buildTree() and loadFromTree() are provided for it, so that it can be sent via any of the DOM
+     * based protocols.
+     */
+    struct StateUpdate {
+        /** Sequence number of the state which the update produces */
+        uint64_t sequence = 0;
+        /** Sequence number of the state to which the patch applies (0 if the update contains the full state) */
+        uint64_t base = 0;
+        /** The full state, or the patch */
+        cadf::dom::DomNode content;
+    };
+
+    /**
+     * Sending side of delta encoded state updates. Each state is encoded as a patch against the most recent state which the receiver
+     * acknowledged, or in full if no state was acknowledged yet. Acknowledging a state is left to the application (i.e.: via a message
+     * carrying the sequence number from StateDecoder::getSequence()), until then states continue to be encoded against the previously
+     * acknowledged one, so that updates which are lost do not prevent subsequent ones from being applied.
+     */
+    class StateEncoder {
+        public:
+            /**
+             * CTOR
+             *
+             * @param maxPending size_t the maximum number of unacknowledged states that are retained, older ones can no longer be
+             *        acknowledged (defaults to 16)
+             */
+            StateEncoder(size_t maxPending = 16);
+
+            /**
+             * DTOR
+             */
+            virtual ~StateEncoder() = default;
+
+            /**
+             * Encode the state, against the acknowledged state if there is one.
+             *
+             * @param &state const cadf::dom::DomNode tree of the state to send
+             * @return StateUpdate to send to the receiver
+             */
+            StateUpdate encode(const cadf::dom::DomNode &state);
+
+            /**
+             * Encode the state, against the acknowledged state if there is one.
+             *
+             * @template T the type of the state, for which buildTree() must be provided
+             * @param &state const T the state to send
+             * @return StateUpdate to send to the receiver
+             */
+            template<class T>
+            StateUpdate encodeState(const T &state) {
+                return encode(buildTree<T>(state));
+            }
+
+            /**
+             * Record that the receiver has the state, so that subsequent states are encoded against it. Acknowledging a state that is
+             * older than the already acknowledged one, or is no longer retained, has no effect.
+             *
+             * @param sequence uint64_t sequence number of the received state
+             */
+            void acknowledge(uint64_t sequence);
+
+            /**
+             * Forget about all previously sent states, such that the next state is sent in full (i.e.: when the receiver reconnects).
+             */
+            void reset();
+
+            /**
+             * Get the sequence number of the acknowledged state.
+             *
+             * @return uint64_t the sequence number (0 if no state was acknowledged)
+             */
+            uint64_t getAcknowledged() const;
+
+        private:
+            // Maximum number of pending states
+            size_t m_maxPending;
+            // Sequence number of the most recently encoded state
+            uint64_t m_sequence;
+            // Sequence number of the acknowledged state
+            uint64_t m_acknowledgedSequence;
+            // The acknowledged state
+            cadf::dom::DomNode m_acknowledged;
+            // States which were sent, but not yet acknowledged
+            std::map<uint64_t, cadf::dom::DomNode> m_pending;
+    };
+
+    /**
+     * Receiving side of delta encoded state updates, reconstructing the states from the updates produced by a StateEncoder. Only the
+     * states which the encoder may still use as a base are retained: the base of the most recent update, and those within the
+     * encoder's window of unacknowledged states.
+     */
+    class StateDecoder {
+        public:
+            /**
+             * CTOR
+             *
+             * @param maxPending size_t the maximum number of unacknowledged states that the StateEncoder retains (defaults to 16, as
+             *        for the StateEncoder)
+             */
+            StateDecoder(size_t maxPending = 16);
+
+            /**
+             * DTOR
+             */
+            virtual ~StateDecoder() = default;
+
+            /**
+             * Reconstruct the state from the update.
+             *
+             * @throws cadf::dom::PatchException if the base of the update is not known, or the patch cannot be applied to it
+             * @param &update const StateUpdate received from the sender
+             * @return const cadf::dom::DomNode& the reconstructed state (valid until the next update is decoded)
+             */
+            const cadf::dom::DomNode& decode(const StateUpdate &update);
+
+            /**
+             * Reconstruct the state from the update.
+             *
+             * @template T the type of the state, for which loadFromTree() must be provided
+             * @throws cadf::dom::PatchException if the base of the update is not known, or the patch cannot be applied to it
+             * @param &update const StateUpdate received from the sender
+             * @return T the reconstructed state
+             */
+            template<class T>
+            T decodeState(const StateUpdate &update) {
+                return loadFromTree<T>(decode(update));
+            }
+
+            /**
+             * Get the sequence number of the most recently decoded state, which is to be acknowledged to the sender.
+             *
+             * @return uint64_t the sequence number (0 if nothing was decoded yet)
+             */
+            uint64_t getSequence() const;
+
+            /**
+             * Get the number of decoded states which are retained, as the sender may still use them as a base.
+             *
+             * @return size_t the number of states (at most maxPending + 1)
+             */
+            size_t getNumStates() const;
+
+        private:
+            // Maximum number of states pending at the encoder
+            size_t m_maxPending;
+            // Sequence number of the most recently decoded state
+            uint64_t m_sequence;
+            // Decoded states which the sender may still use as a base, by sequence number
+            std::map<uint64_t, cadf::dom::DomNode> m_states;
+    };
+}
+
+#endif /* CAMB_NETWORK_DOM_STATEDELTA_H_ */
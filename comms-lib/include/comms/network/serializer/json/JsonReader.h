@@ -0,0 +1,181 @@
+#ifndef COMMS_NETWORK_SERIALIZER_JSON_JSONREADER_H_
+#define COMMS_NETWORK_SERIALIZER_JSON_JSONREADER_H_
+
+#include <string>
+#include <string_view>
+
+namespace cadf::comms::json {
+
+    /**
+     * Pull parser which reads JSON directly from a character buffer, one element at a time, without building any intermediate
+     * representation of the data. The caller drives the parse, requesting the element that is expected to be present next.
+     *
+     * Reading an object is performed via:
+     *
+     *     reader.startObject();
+     *     std::string_view name;
+     *     while (reader.nextField(name)) {
+     *         if (name == "field")
+     *             data.field = reader.readInt();
+     *         else
+     *             reader.skipValue();
+     *     }
+     *
+     * The data is not copied, so the buffer must remain valid for as long as the reader is used.
+     *
+     * @throws cadf::dom::ParseException if the input does not contain the expected element
+     */
+    class JsonReader {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *data const char pointer to the JSON to be read
+             * @param size size_t the size of the JSON (in bytes)
+             * @param startIndex size_t where within the data to start reading (defaults to the start)
+             */
+            JsonReader(const char *data, size_t size, size_t startIndex = 0);
+
+            /**
+             * Get the current position of the reader within the data.
+             *
+             * @return size_t the index of the next character to be read
+             */
+            size_t getPosition() const {
+                return m_currIndex;
+            }
+
+            /**
+             * Read the start of an object ("{").
+             */
+            void startObject();
+
+            /**
+             * Advance to the next field of the current object. When the end of the object is reached it is consumed.
+             *
+             * @param &name std::string_view where the name of the field is to be stored. References the underlying data, unless the name
+             *        contains escape sequences, in which case it references the decoded name held by the reader until the next field
+             * @return bool true if another field is present (its value is to be read next), false if the end of the object was reached
+             */
+            bool nextField(std::string_view &name);
+
+            /**
+             * Read the start of an array ("[").
+             */
+            void startArray();
+
+            /**
+             * Advance to the next element of the current array. When the end of the array is reached it is consumed.
+             *
+             * @return bool true if another element is present (it is to be read next), false if the end of the array was reached
+             */
+            bool nextElement();
+
+            /**
+             * Check whether the next value is null, consuming it if so.
+             *
+             * @return bool true if the value was null
+             */
+            bool readNull();
+
+            /**
+             * Read an integral value.
+             *
+             * @return long the value read
+             */
+            long readLong();
+
+            /**
+             * Read an integral value.
+             *
+             * @return int the value read
+             */
+            int readInt() {
+                return int(readLong());
+            }
+
+            /**
+             * Read a floating point value.
+             *
+             * @return double the value read
+             */
+            double readDouble();
+
+            /**
+             * Read a boolean value ("true" or "false").
+             *
+             * @return bool the value read
+             */
+            bool readBool();
+
+            /**
+             * Read a string value, decoding any escape sequences.
+             *
+             * @return std::string the value read
+             */
+            std::string readString();
+
+            /**
+             * Skip over the next value, regardless of its type (including any nested objects/arrays).
+             */
+            void skipValue();
+
+        private:
+            // The JSON being read
+            const char *m_data;
+            // The size of the JSON
+            size_t m_size;
+            // The current index of the read
+            size_t m_currIndex;
+            // Whether the next field/element is the first within the current object/array
+            bool m_first;
+            // The decoded name of the current field, should its name contain escape sequences
+            std::string m_decodedName;
+
+            /**
+             * Peak at the next non-whitespace character without advancing past it.
+             *
+             * @return char the next non-whitespace character ('\0' if the end of the data is reached)
+             */
+            char peakChar();
+
+            /**
+             * Consume the expected character, skipping any preceding whitespace.
+             *
+             * @param expected char the character that must be present
+             */
+            void expectChar(char expected);
+
+            /**
+             * Read the raw (undecoded) content of a string.
+             *
+             * @param &hasEscape bool set to indicate whether the string contains any escape sequences
+             * @return std::string_view referencing the content of the string within the data
+             */
+            std::string_view readRawString(bool &hasEscape);
+
+            /**
+             * Read the raw token of a literal value (number, true, false, null).
+             *
+             * @return std::string_view referencing the token within the data
+             */
+            std::string_view readToken();
+
+            /**
+             * Advance to the next item of an object or array.
+             *
+             * @param terminator char the character which terminates the object/array
+             * @return bool true if there is another item
+             */
+            bool nextItem(char terminator);
+
+            /**
+             * Throw an exception to indicate that invalid or malformed input was detected.
+             *
+             * @param &expected const std::string indicating what was expected to be seen in the input
+             */
+            [[noreturn]] void throwException(const std::string &expected) const;
+    };
+}
+
+#endif /* COMMS_NETWORK_SERIALIZER_JSON_JSONREADER_H_ */
@@ -0,0 +1,167 @@
+#ifndef COMMS_NETWORK_SERIALIZER_JSON_JSONWRITER_H_
+#define COMMS_NETWORK_SERIALIZER_JSON_JSONWRITER_H_
+
+#include <string>
+
+#include "comms/network/Buffer.h"
+#include "dom/OutputSink.h"
+
+namespace cadf::comms::json {
+
+    /**
+     * Writes JSON directly into an OutputBuffer, without building any intermediate representation of the data. When no buffer
+     * is provided, nothing is written and only the size of the resulting JSON is tallied, allowing the size of a message to be
+     * determined prior to allocating the buffer for it.
+     *
+     * The writer takes care of placing the "," separators, but it is up to the caller to ensure that the start/end calls are
+     * properly balanced. Values are formatted identically to the cadf::dom::json::JsonConverter, which also escapes the strings
+     * (the writer being the sink into which they are written).
+     */
+    class JsonWriter: private cadf::dom::OutputSink {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *buffer OutputBuffer pointer where the JSON is to be written (nullptr to only determine the size)
+             */
+            JsonWriter(OutputBuffer *buffer = nullptr);
+
+            /**
+             * Get the number of bytes (characters) that have been written so far.
+             *
+             * @return size_t number of bytes written
+             */
+            size_t getSize() const {
+                return m_size;
+            }
+
+            /**
+             * Start a new object ("{").
+             */
+            void startObject();
+
+            /**
+             * End the current object ("}").
+             */
+            void endObject();
+
+            /**
+             * Start a new array ("[").
+             */
+            void startArray();
+
+            /**
+             * End the current array ("]").
+             */
+            void endArray();
+
+            /**
+             * Write the name of the next field within the current object. Must be followed by the value of the field.
+             *
+             * @param *name const char the name of the field
+             */
+            void writeKey(const char *name);
+
+            /**
+             * Write a null value.
+             */
+            void writeNull();
+
+            /**
+             * Write an integral value.
+             *
+             * @param value long the value to write
+             */
+            void writeValue(long value);
+
+            /**
+             * Write an integral value.
+             *
+             * @param value int the value to write
+             */
+            void writeValue(int value) {
+                writeValue(long(value));
+            }
+
+            /**
+             * Write an integral value.
+             *
+             * @param value unsigned int the value to write
+             */
+            void writeValue(unsigned int value) {
+                writeValue(long(value));
+            }
+
+            /**
+             * Write a floating point value.
+             *
+             * @param value double the value to write
+             */
+            void writeValue(double value);
+
+            /**
+             * Write a boolean value.
+             *
+             * @param value bool the value to write
+             */
+            void writeValue(bool value);
+
+            /**
+             * Write a string value, escaping any characters which cannot appear within a JSON string as is.
+             *
+             * @param &value const std::string the value to write
+             */
+            void writeValue(const std::string &value);
+
+            /**
+             * Write a string value, escaping any characters which cannot appear within a JSON string as is.
+             *
+             * @param *value const char the null terminated value to write
+             */
+            void writeValue(const char *value);
+
+            /**
+             * Write a complete field (name and value) within the current object.
+             *
+             * @template T the type of value to write
+             * @param *name const char the name of the field
+             * @param &value const T the value of the field
+             */
+            template<typename T>
+            void writeField(const char *name, const T &value) {
+                writeKey(name);
+                writeValue(value);
+            }
+
+        private:
+            // Where the JSON is written to
+            OutputBuffer *m_buffer;
+            // How many bytes have been written
+            size_t m_size;
+            // Whether a "," must precede the next key or value
+            bool m_needsSeparator;
+
+            /**
+             * Write the separator if one is required prior to the next key or value.
+             */
+            void separate();
+
+            /**
+             * Write raw data.
+             *
+             * @param *data const char pointer to the data to write
+             * @param size size_t the number of bytes to write
+             */
+            void write(const char *data, size_t size) override;
+
+            /**
+             * Write the quoted and escaped string.
+             *
+             * @param *value const char pointer to the start of the string
+             * @param size size_t the length of the string
+             */
+            void writeString(const char *value, size_t size);
+    };
+}
+
+#endif /* COMMS_NETWORK_SERIALIZER_JSON_JSONWRITER_H_ */
@@ -0,0 +1,37 @@
+#ifndef COMMS_NETWORK_SERIALIZER_JSON_SERIALIZATIONFUNCS_H_
+#define COMMS_NETWORK_SERIALIZER_JSON_SERIALIZATIONFUNCS_H_
+
+#include "comms/network/serializer/json/JsonWriter.h"
+#include "comms/network/serializer/json/JsonReader.h"
+
+namespace cadf::comms::json {
+
+    /**
+     * Write the JSON representation of the specified data. No default implementation is provided.
+     * A concrete implementation must be provided for each data type (i.e.: struct) that is to be
+     * contained within a message.
+     *
+     * Note: in order for the output to match that of the cadf::comms::dom::json::JSONProtocol, the
+     * fields must be written in alphabetical order.
+     *
+     * @template class T the type of data that is to be written
+     * @param &data const T reference to the specific instance to be written
+     * @param *writer JsonWriter pointer through which the JSON is to be written
+     */
+    template<class T>
+    void writeJson(const T &data, JsonWriter *writer);
+
+    /**
+     * Read the data from JSON. No default implementation is provided.
+     * A concrete implementation must be provided for each data type (i.e.: struct) that is to be
+     * contained within a message.
+     *
+     * @template class T that is to be read
+     * @param *reader JsonReader pointer positioned at the start of the data
+     * @return T containing the data read from the JSON
+     */
+    template<class T>
+    T readJson(JsonReader *reader);
+}
+
+#endif /* COMMS_NETWORK_SERIALIZER_JSON_SERIALIZATIONFUNCS_H_ */
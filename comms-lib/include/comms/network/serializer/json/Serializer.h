@@ -0,0 +1,153 @@
+#ifndef COMMS_NETWORK_SERIALIZER_JSON_SERIALIZER_H_
+#define COMMS_NETWORK_SERIALIZER_JSON_SERIALIZER_H_
+
+#include "comms/network/serializer/json/SerializationFuncs.h"
+#include "comms/network/serializer/TemplateProtocol.h"
+#include "comms/network/NetworkException.h"
+#include "comms/message/Message.h"
+#include "comms/message/MessageFactory.h"
+
+namespace cadf::comms::json {
+
+    /**
+     * Serializer that is responsible for writing an AbstractDataMessage class directly into the buffer as JSON. The output is
+     * identical to that of the cadf::comms::dom::json::JSONProtocol, however no DOM tree or intermediate string is created.
+     *
+     * @template T the class (struct) representing the data that is stored within the message
+     */
+    template<class T>
+    class MessageSerializer: public ISerializer {
+
+        public:
+            /**
+             * CTOR
+             *
+             * @param *msg const AbstractDataMessage that is to be serialized
+             * @param type int the type of the destination to receive the message
+             * @param instance int the instance of the destination to receive the message
+             */
+            MessageSerializer(const AbstractDataMessage<T> *msg, int type, int instance) : ISerializer(msg->getType()), m_message(msg), m_type(type), m_instance(instance) {
+            }
+
+            /**
+             * Determine the size of the message when it is serialized to JSON. This performs a "dry run" of the serialization.
+             *
+             * @return size_t the number of bytes (characters) required in order to properly serialize the message
+             */
+            size_t getSize() const {
+                JsonWriter writer;
+                write(&writer);
+                return writer.getSize() + 1; // +1 for null terminator
+            }
+
+            /**
+             * Serialize the data.
+             *
+             * @param *buffer OutputBuffer pointer where the data is to be written to
+             *
+             * Note: this is dependent on pre-existing external writeJson functions being available for the data type.
+             */
+            void serialize(OutputBuffer *buffer) {
+                JsonWriter writer(buffer);
+                write(&writer);
+                buffer->append('\0', 1);
+            }
+
+        private:
+            // The message that is to be serialized
+            const AbstractDataMessage<T> *m_message;
+            // The type of recipient
+            int m_type;
+            // The instance of the type
+            int m_instance;
+
+            /**
+             * Write the message through the writer. Fields are written in alphabetical order to match the DOM representation.
+             *
+             * @param *writer JsonWriter to write the message with
+             */
+            void write(JsonWriter *writer) const {
+                writer->startObject();
+                writer->writeKey("data");
+                writeJson<T>(m_message->getData(), writer);
+                writer->writeField("instance", m_instance);
+                writer->writeField("message", m_msgType);
+                writer->writeField("type", m_type);
+                writer->endObject();
+            }
+    };
+
+    /**
+     * Deserializer that is responsible for reading the JSON directly out of the buffer. Only the header of the message is read on
+     * construction, the data is only read when it is requested.
+     */
+    class MessageDeserializer: public IDeserializer {
+
+        public:
+            /**
+             * CTOR
+             *
+             * @param *buffer InputBuffer pointer to the buffer where the received JSON is stored
+             */
+            MessageDeserializer(InputBuffer *buffer);
+
+            /**
+             * DTOR
+             */
+            virtual ~MessageDeserializer() = default;
+
+            /**
+             * Load the data from the message and populate a data structure with it.
+             *
+             * @template T the type of class (struct) where the data is contained
+             * @return T the data structure with the loaded data
+             *
+             * Note: this is dependent on pre-existing external readJson functions being available for the data type.
+             */
+            template<class T>
+            T getData() const {
+                JsonReader reader(m_data, m_dataSize, dataIndex());
+                return readJson<T>(&reader);
+            }
+
+        private:
+            // The received JSON (owned by the buffer)
+            const char *m_data;
+            // The size of the received JSON
+            size_t m_dataSize;
+            // Where the value of the "data" field starts within the JSON
+            size_t m_dataIndex;
+
+            /**
+             * Get where the data starts within the JSON.
+             *
+             * @throws cadf::dom::ParseException if the JSON contained no data
+             * @return size_t index of the start of the data
+             */
+            size_t dataIndex() const;
+    };
+
+    /**
+     * SerializerFactory for the streaming (de)serialization of messages to/from JSON.
+     *
+     * @template T class indicating the type of data that is stored within the message
+     */
+    template<class T>
+    struct JSONStreamSerializerFactory: public TemplateSerializerFactory<MessageSerializer, MessageDeserializer, T> {
+
+            /**
+             * CTOR
+             */
+            JSONStreamSerializerFactory() : TemplateSerializerFactory<MessageSerializer, MessageDeserializer, T>("JSONStream") {
+            }
+    };
+
+    /**
+     * The protocol through which to handle the streaming (de)serialization of messages to JSON. On the wire this is
+     * compatible with the cadf::comms::dom::json::JSONProtocol.
+     */
+    struct JSONStreamProtocol: public Protocol<JSONStreamSerializerFactory, MessageDeserializer> {
+    };
+}
+
+#endif /* COMMS_NETWORK_SERIALIZER_JSON_SERIALIZER_H_ */
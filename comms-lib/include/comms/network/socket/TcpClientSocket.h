@@ -49,6 +49,13 @@ namespace cadf::comms {
              */
             virtual void removeMessageListener(ISocketMessageReceivedListener *listener);
 
+            /**
+             * Disconnect from the server, stopping the reading of messages before the socket is closed
+             *
+             * @return bool true if the socket is successfully disconnected
+             */
+            virtual bool disconnect();
+
         protected:
             /**
              * Establish the connection to the server.
@@ -51,6 +51,13 @@ namespace cadf::comms {
              */
             virtual void removeMessageListener(ISocketMessageReceivedListener *listener);
 
+            /**
+             * Stop the server, no longer accepting connections before the socket is closed
+             *
+             * @return bool true if the socket is successfully disconnected
+             */
+            virtual bool disconnect();
+
         protected:
             /**
              * Connects the socket as a server
@@ -75,7 +82,7 @@ namespace cadf::comms {
             size_t m_addrlen;
 
             /**
-             * The thread loop that waits for a client to connect
+             * The thread loop that waits for a client to connect (or for the thread to be stopped)
              */
             void execLoop();
     };
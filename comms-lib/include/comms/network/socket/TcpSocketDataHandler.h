@@ -3,6 +3,7 @@
 
 #include <unistd.h>
 #include <vector>
+#include <mutex>
 
 #include "comms/network/socket/ISocketMessageReceivedListener.h"
 #include "thread/Thread.h"
@@ -50,8 +51,10 @@ namespace cadf::comms {
              *
              * @param socketFd int the file descriptor of the socket
              * @param maxMessageSize size_t the max size of message that can be sent
+             * @param autoStart bool to indicate whether reading should start on initialization (defaults to true)
+             * @param &threadConfig const cadf::thread::ThreadConfig to apply to the reading thread (defaults to inheriting everything)
              */
-            TcpSocketDataHandler(int socketFd, size_t maxMessageSize);
+            TcpSocketDataHandler(int socketFd, size_t maxMessageSize, bool autoStart = true, const cadf::thread::ThreadConfig &threadConfig = cadf::thread::ThreadConfig());
 
             /**
              * DTOR
@@ -81,9 +84,16 @@ namespace cadf::comms {
              */
             virtual void send(const OutputBuffer *out);
 
+            /**
+             * Start reading messages. Only required if the handler was not started on initialization.
+             */
+            virtual void start();
+
         private:
             /** Listeners to be notified when something is received */
             std::vector<ISocketMessageReceivedListener*> m_listeners;
+            /** Mutex to ensure thread safety when accessing the listeners */
+            std::mutex m_listenerMutex;
             /** The socket from which to read */
             int m_socketFd;
             /** The maximum size of the data */
@@ -91,18 +101,13 @@ namespace cadf::comms {
             /** Buffer into which to read the data */
             char *m_messageBuffer;
 
-            /**
-             * Start reading message
-             */
-            virtual void start();
-
             /**
              * Stop reading messages
              */
             virtual void stop();
 
             /**
-             * Called by the thread, waits for something to be delivered to the socket.
+             * Called by the thread, waits for something to be delivered to the socket (or for the thread to be stopped).
              */
             void execLoop();
 
@@ -19,8 +19,9 @@ namespace cadf::comms {
     void ThreadedBus::sendMessage(IBusConnection *sender, const MessagePacket *packet) {
         // Need to clone the packet as we have no control overly the packet life cycle from the caller. With the thread
         // the sending is now asynchronous from the caller, and so they could very easily cleanup the packet before
-        // the thread is able to send it.
-        m_threadPool->schedule(std::bind(&ThreadedBus::routeMessage, this, sender, packet->clone()));
+        // the thread is able to send it. The capture is small enough for the task to be stored without allocating.
+        const MessagePacket *clone = packet->clone();
+        m_threadPool->schedule([this, sender, clone] { routeMessage(sender, clone); });
     }
 
     /**
@@ -37,12 +37,15 @@ namespace cadf::comms {
         if (isConnected())
             return true;
 
-        if (m_socket->connect()) {
-            if (m_messageProcessor != NULL)
-                m_socket->addMessageListener(m_messageProcessor);
+        // Register the listener prior to connecting, so that it is in place as soon as data starts arriving
+        if (m_messageProcessor != NULL)
+            m_socket->addMessageListener(m_messageProcessor);
+
+        if (m_socket->connect())
             return true;
-        }
 
+        if (m_messageProcessor != NULL)
+            m_socket->removeMessageListener(m_messageProcessor);
         return false;
     }
 
@@ -2,6 +2,7 @@
 
 #include "comms/network/serializer/dom/BaseSerializer.h"
 #include "comms/network/serializer/binary/Serializer.h"
+#include "comms/network/serializer/json/Serializer.h"
 
 namespace cadf::comms {
     /*
@@ -62,4 +63,31 @@ namespace cadf::comms {
         data.version = root["version"];
         return data;
     }
+
+    /*
+     * Write the message data directly as JSON.
+     */
+    template<>
+    void cadf::comms::json::writeJson<HandshakeCompleteData>(const HandshakeCompleteData &data, JsonWriter *writer) {
+        writer->startObject();
+        writer->writeField("version", data.version);
+        writer->endObject();
+    }
+
+    /*
+     * Read the message data directly from JSON
+     */
+    template<>
+    HandshakeCompleteData cadf::comms::json::readJson<HandshakeCompleteData>(JsonReader *reader) {
+        HandshakeCompleteData data;
+        reader->startObject();
+        std::string_view name;
+        while (reader->nextField(name)) {
+            if (name == "version")
+                data.version = reader->readInt();
+            else
+                reader->skipValue();
+        }
+        return data;
+    }
 }
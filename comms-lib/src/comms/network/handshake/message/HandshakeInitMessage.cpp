@@ -2,6 +2,7 @@
 
 #include "comms/network/serializer/dom/BaseSerializer.h"
 #include "comms/network/serializer/binary/Serializer.h"
+#include "comms/network/serializer/json/Serializer.h"
 
 namespace cadf::comms {
     /*
@@ -62,4 +63,31 @@ namespace cadf::comms {
         data.maxVersion = root["maxVersion"];
         return data;
     }
+
+    /*
+     * Write the message data directly as JSON.
+     */
+    template<>
+    void cadf::comms::json::writeJson<HandshakeInitData>(const HandshakeInitData &data, JsonWriter *writer) {
+        writer->startObject();
+        writer->writeField("maxVersion", data.maxVersion);
+        writer->endObject();
+    }
+
+    /*
+     * Read the message data directly from JSON
+     */
+    template<>
+    HandshakeInitData cadf::comms::json::readJson<HandshakeInitData>(JsonReader *reader) {
+        HandshakeInitData data;
+        reader->startObject();
+        std::string_view name;
+        while (reader->nextField(name)) {
+            if (name == "maxVersion")
+                data.maxVersion = reader->readInt();
+            else
+                reader->skipValue();
+        }
+        return data;
+    }
 }
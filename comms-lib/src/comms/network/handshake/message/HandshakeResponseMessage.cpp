@@ -2,6 +2,7 @@
 
 #include "comms/network/serializer/dom/BaseSerializer.h"
 #include "comms/network/serializer/binary/Serializer.h"
+#include "comms/network/serializer/json/Serializer.h"
 
 namespace cadf::comms {
     /*
@@ -67,4 +68,34 @@ namespace cadf::comms {
         data.clientInstance = root["clientInstance"];
         return data;
     }
+
+    /*
+     * Write the message data directly as JSON.
+     */
+    template<>
+    void cadf::comms::json::writeJson<HandshakeResponseDataV1>(const HandshakeResponseDataV1 &data, JsonWriter *writer) {
+        writer->startObject();
+        writer->writeField("clientInstance", data.clientInstance);
+        writer->writeField("clientType", data.clientType);
+        writer->endObject();
+    }
+
+    /*
+     * Read the message data directly from JSON
+     */
+    template<>
+    HandshakeResponseDataV1 cadf::comms::json::readJson<HandshakeResponseDataV1>(JsonReader *reader) {
+        HandshakeResponseDataV1 data;
+        reader->startObject();
+        std::string_view name;
+        while (reader->nextField(name)) {
+            if (name == "clientInstance")
+                data.clientInstance = reader->readInt();
+            else if (name == "clientType")
+                data.clientType = reader->readInt();
+            else
+                reader->skipValue();
+        }
+        return data;
+    }
 }
@@ -2,10 +2,16 @@
 
 namespace cadf::comms::dom {
     /*
-     * CTOR - load the details of the message from the JSON in the buffer
+     * CTOR - the buffer contains a null terminated string
      */
-    Deserializer::Deserializer(cadf::dom::DomConverter *converter, InputBuffer *buffer): IDeserializer(0, 0, "") {
-        m_root = converter->fromString(buffer->getData());
+    Deserializer::Deserializer(cadf::dom::DomConverter *converter, InputBuffer *buffer): Deserializer(converter, std::string_view(buffer->getData())) {
+    }
+
+    /*
+     * CTOR - load the details of the message from the data
+     */
+    Deserializer::Deserializer(cadf::dom::DomConverter *converter, std::string_view data): IDeserializer(0, 0, "") {
+        m_root = converter->fromData(data);
         m_type = m_root["type"];
         m_instance = m_root["instance"];
         m_msgType = m_root["message"].operator std::string();
@@ -0,0 +1,12 @@
+#include "comms/network/serializer/dom/JsonSerializer.h"
+
+namespace cadf::comms::dom::json {
+    /*
+     * CTOR - index the JSON in the buffer, only parsing the details of the message
+     */
+    JsonDeserializer::JsonDeserializer(InputBuffer *buffer): IDeserializer(0, 0, ""), m_document(buffer->getData()) {
+        m_type = m_document["type"];
+        m_instance = m_document["instance"];
+        m_msgType = m_document["message"].operator std::string();
+    }
+}
@@ -0,0 +1,130 @@
+#include "comms/network/serializer/dom/StateDelta.h"
+#include "dom/DomPatch.h"
+#include "dom/DomException.h"
+
+namespace cadf::comms::dom {
+
+    /*
+     * CTOR
+     */
+    StateEncoder::StateEncoder(size_t maxPending): m_maxPending(maxPending), m_sequence(0), m_acknowledgedSequence(0) {
+    }
+
+    /*
+     * Diff against the acknowledged state, retaining the state until it is acknowledged
+     */
+    StateUpdate StateEncoder::encode(const cadf::dom::DomNode &state) {
+        StateUpdate update;
+        update.sequence = ++m_sequence;
+        update.base = m_acknowledgedSequence;
+        update.content = m_acknowledgedSequence == 0 ? state : cadf::dom::DomPatch::diff(m_acknowledged, state);
+
+        m_pending.emplace(update.sequence, state);
+        if (m_pending.size() > m_maxPending)
+            m_pending.erase(m_pending.begin());
+        return update;
+    }
+
+    /*
+     * The acknowledged state becomes the new base, anything older can no longer be acknowledged
+     */
+    void StateEncoder::acknowledge(uint64_t sequence) {
+        std::map<uint64_t, cadf::dom::DomNode>::iterator it = m_pending.find(sequence);
+        if (it == m_pending.end())
+            return;
+
+        m_acknowledged = std::move(it->second);
+        m_acknowledgedSequence = sequence;
+        m_pending.erase(m_pending.begin(), ++it);
+    }
+
+    /*
+     * Start over from scratch
+     */
+    void StateEncoder::reset() {
+        m_acknowledged = cadf::dom::DomNode();
+        m_acknowledgedSequence = 0;
+        m_pending.clear();
+    }
+
+    /*
+     * Sequence number of the acknowledged state
+     */
+    uint64_t StateEncoder::getAcknowledged() const {
+        return m_acknowledgedSequence;
+    }
+
+    /*
+     * CTOR
+     */
+    StateDecoder::StateDecoder(size_t maxPending): m_maxPending(maxPending), m_sequence(0) {
+    }
+
+    /*
+     * Apply the patch to a copy of the base. As the sender only ever encodes against the most recently acknowledged state, any states
+     * older than the base are no longer required. Nor are those which fell out of the sender's window of pending states, as they can
+     * no longer be acknowledged (otherwise a sender whose acknowledgements are lost would grow the states with every update).
+     */
+    const cadf::dom::DomNode& StateDecoder::decode(const StateUpdate &update) {
+        cadf::dom::DomNode state;
+        if (update.base == 0) {
+            // The sender started over
+            state = update.content;
+            m_states.clear();
+        } else {
+            std::map<uint64_t, cadf::dom::DomNode>::iterator base = m_states.find(update.base);
+            if (base == m_states.end())
+                throw cadf::dom::PatchException("unknown base state " + std::to_string(update.base), "");
+            state = base->second;
+            cadf::dom::DomPatch::apply(state, update.content);
+            m_states.erase(m_states.begin(), base);
+        }
+
+        m_sequence = update.sequence;
+        cadf::dom::DomNode &decoded = m_states[update.sequence];
+        decoded = std::move(state);
+
+        // The base (if any) is the first state, which remains
+        std::map<uint64_t, cadf::dom::DomNode>::iterator it = update.base == 0 ? m_states.begin() : std::next(m_states.begin());
+        while (it != m_states.end() && it->first != update.sequence && update.sequence - it->first >= m_maxPending)
+            it = m_states.erase(it);
+        return decoded;
+    }
+
+    /*
+     * Sequence number of the last decoded state
+     */
+    uint64_t StateDecoder::getSequence() const {
+        return m_sequence;
+    }
+
+    /*
+     * Number of retained states
+     */
+    size_t StateDecoder::getNumStates() const {
+        return m_states.size();
+    }
+
+    /*
+     * Build the tree for the update
+     */
+    template<>
+    cadf::dom::DomNode buildTree<StateUpdate>(const StateUpdate &update) {
+        cadf::dom::DomNode node = cadf::dom::buildNode("content", update.content);
+        node["base"] = update.base;
+        node["sequence"] = update.sequence;
+        return node;
+    }
+
+    /*
+     * Load the update from the tree
+     */
+    template<>
+    StateUpdate loadFromTree<StateUpdate>(const cadf::dom::DomNode &root) {
+        StateUpdate update;
+        update.sequence = root["sequence"].operator long();
+        update.base = root["base"].operator long();
+        update.content = root["content"];
+        return update;
+    }
+}
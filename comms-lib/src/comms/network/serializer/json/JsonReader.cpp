@@ -0,0 +1,236 @@
+#include "comms/network/serializer/json/JsonReader.h"
+#include "dom/DomException.h"
+#include "dom/json/JsonParser.h"
+
+#include <charconv>
+#include <cctype>
+
+namespace cadf::comms::json {
+
+    /*
+     * CTOR
+     */
+    JsonReader::JsonReader(const char *data, size_t size, size_t startIndex) : m_data(data), m_size(size), m_currIndex(startIndex), m_first(false) {
+    }
+
+    /*
+     * Start of an object
+     */
+    void JsonReader::startObject() {
+        expectChar('{');
+        m_first = true;
+    }
+
+    /*
+     * Advance to the next field
+     */
+    bool JsonReader::nextField(std::string_view &name) {
+        if (!nextItem('}'))
+            return false;
+
+        bool hasEscape;
+        name = readRawString(hasEscape);
+        if (hasEscape) {
+            m_decodedName.clear();
+            cadf::dom::json::JsonParser::decodeEscapes(name, m_decodedName, name.data() - m_data);
+            name = m_decodedName;
+        }
+        expectChar(':');
+        return true;
+    }
+
+    /*
+     * Start of an array
+     */
+    void JsonReader::startArray() {
+        expectChar('[');
+        m_first = true;
+    }
+
+    /*
+     * Advance to the next element
+     */
+    bool JsonReader::nextElement() {
+        return nextItem(']');
+    }
+
+    /*
+     * Check for (and consume) null
+     */
+    bool JsonReader::readNull() {
+        if (peakChar() != 'n')
+            return false;
+
+        if (readToken() != "null")
+            throwException("null");
+        return true;
+    }
+
+    /*
+     * Read an integral value
+     */
+    long JsonReader::readLong() {
+        std::string_view token = readToken();
+        long value = 0;
+        std::from_chars_result result = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (token.empty() || result.ec != std::errc() || result.ptr != token.data() + token.size())
+            throwException("integer");
+        return value;
+    }
+
+    /*
+     * Read a floating point value
+     */
+    double JsonReader::readDouble() {
+        std::string_view token = readToken();
+        double value = 0;
+        std::from_chars_result result = std::from_chars(token.data(), token.data() + token.size(), value);
+        if (token.empty() || result.ec != std::errc() || result.ptr != token.data() + token.size())
+            throwException("number");
+        return value;
+    }
+
+    /*
+     * Read a boolean value
+     */
+    bool JsonReader::readBool() {
+        std::string_view token = readToken();
+        if (token == "true")
+            return true;
+        if (token == "false")
+            return false;
+
+        throwException("boolean");
+    }
+
+    /*
+     * Read a string, only decoding it if escapes are actually present
+     */
+    std::string JsonReader::readString() {
+        bool hasEscape;
+        std::string_view raw = readRawString(hasEscape);
+        if (!hasEscape)
+            return std::string(raw);
+
+        std::string decoded;
+        decoded.reserve(raw.size());
+        cadf::dom::json::JsonParser::decodeEscapes(raw, decoded, raw.data() - m_data);
+        return decoded;
+    }
+
+    /*
+     * Skip the next value
+     */
+    void JsonReader::skipValue() {
+        bool hasEscape;
+
+        switch (peakChar()) {
+            case '{':
+                // The names of the fields are not needed, and as such not decoded
+                startObject();
+                while (nextItem('}')) {
+                    readRawString(hasEscape);
+                    expectChar(':');
+                    skipValue();
+                }
+                break;
+            case '[':
+                startArray();
+                while (nextElement())
+                    skipValue();
+                break;
+            case '"':
+                readRawString(hasEscape);
+                break;
+            default:
+                if (readToken().empty())
+                    throwException("value");
+                break;
+        }
+    }
+
+    /*
+     * Peak at the next non-whitespace character
+     */
+    char JsonReader::peakChar() {
+        while (m_currIndex < m_size && isspace((unsigned char) m_data[m_currIndex]))
+            m_currIndex++;
+        return m_currIndex < m_size ? m_data[m_currIndex] : '\0';
+    }
+
+    /*
+     * Consume the expected char
+     */
+    void JsonReader::expectChar(char expected) {
+        if (peakChar() != expected)
+            throwException(std::string("'") + expected + "'");
+        m_currIndex++;
+    }
+
+    /*
+     * Read the string as is
+     */
+    std::string_view JsonReader::readRawString(bool &hasEscape) {
+        expectChar('"');
+        hasEscape = false;
+
+        size_t start = m_currIndex;
+        while (m_currIndex < m_size) {
+            char c = m_data[m_currIndex];
+            if (c == '"') {
+                std::string_view raw(m_data + start, m_currIndex - start);
+                m_currIndex++;
+                return raw;
+            }
+            if (c == '\\') {
+                hasEscape = true;
+                m_currIndex++;
+            }
+            m_currIndex++;
+        }
+
+        throwException("'\"'");
+    }
+
+    /*
+     * Read a literal token
+     */
+    std::string_view JsonReader::readToken() {
+        peakChar();
+        size_t start = m_currIndex;
+        while (m_currIndex < m_size) {
+            char c = m_data[m_currIndex];
+            if (c == ',' || c == '}' || c == ']' || c == '\0' || isspace((unsigned char) c))
+                break;
+            m_currIndex++;
+        }
+        return std::string_view(m_data + start, m_currIndex - start);
+    }
+
+    /*
+     * Advance to the next item of the object/array
+     */
+    bool JsonReader::nextItem(char terminator) {
+        char c = peakChar();
+        if (c == terminator) {
+            m_currIndex++;
+            m_first = false;
+            return false;
+        }
+
+        if (m_first)
+            m_first = false;
+        else if (c == ',')
+            m_currIndex++;
+        else
+            throwException(std::string("',', '") + terminator + "'");
+        return true;
+    }
+
+    /*
+     * Throw an exception
+     */
+    void JsonReader::throwException(const std::string &expected) const {
+        throw cadf::dom::ParseException(expected, m_currIndex);
+    }
+}
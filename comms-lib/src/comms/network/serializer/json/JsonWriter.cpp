@@ -0,0 +1,143 @@
+#include "comms/network/serializer/json/JsonWriter.h"
+#include "dom/json/JsonConverter.h"
+
+#include <charconv>
+#include <cstring>
+
+namespace cadf::comms::json {
+
+    /*
+     * CTOR
+     */
+    JsonWriter::JsonWriter(OutputBuffer *buffer) : m_buffer(buffer), m_size(0), m_needsSeparator(false) {
+    }
+
+    /*
+     * Start an object
+     */
+    void JsonWriter::startObject() {
+        separate();
+        write("{", 1);
+        m_needsSeparator = false;
+    }
+
+    /*
+     * End an object
+     */
+    void JsonWriter::endObject() {
+        write("}", 1);
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Start an array
+     */
+    void JsonWriter::startArray() {
+        separate();
+        write("[", 1);
+        m_needsSeparator = false;
+    }
+
+    /*
+     * End an array
+     */
+    void JsonWriter::endArray() {
+        write("]", 1);
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write the name of a field
+     */
+    void JsonWriter::writeKey(const char *name) {
+        separate();
+        writeString(name, strlen(name));
+        write(":", 1);
+        m_needsSeparator = false;
+    }
+
+    /*
+     * Write null
+     */
+    void JsonWriter::writeNull() {
+        separate();
+        write("null", 4);
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write an integral value
+     */
+    void JsonWriter::writeValue(long value) {
+        separate();
+        char conv[24];
+        std::to_chars_result result = std::to_chars(conv, conv + sizeof(conv), value);
+        write(conv, result.ptr - conv);
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write a floating point value, as the shortest representation which reads back as the same value (as the DOM does)
+     */
+    void JsonWriter::writeValue(double value) {
+        separate();
+        char conv[32];
+        std::to_chars_result result = std::to_chars(conv, conv + sizeof(conv), value);
+        write(conv, result.ptr - conv);
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write a boolean value
+     */
+    void JsonWriter::writeValue(bool value) {
+        separate();
+        if (value)
+            write("true", 4);
+        else
+            write("false", 5);
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write a string value
+     */
+    void JsonWriter::writeValue(const std::string &value) {
+        separate();
+        writeString(value.c_str(), value.size());
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write a string value
+     */
+    void JsonWriter::writeValue(const char *value) {
+        separate();
+        writeString(value, strlen(value));
+        m_needsSeparator = true;
+    }
+
+    /*
+     * Write the separator if needed
+     */
+    void JsonWriter::separate() {
+        if (m_needsSeparator)
+            write(",", 1);
+    }
+
+    /*
+     * Write the raw data (or just tally it if there is no buffer)
+     */
+    void JsonWriter::write(const char *data, size_t size) {
+        if (m_buffer)
+            m_buffer->append(data, size);
+        m_size += size;
+    }
+
+    /*
+     * Write the string, escaping it as the DOM does
+     */
+    void JsonWriter::writeString(const char *value, size_t size) {
+        cadf::dom::json::JsonConverter::writeQuoted(std::string_view(value, size), this);
+    }
+}
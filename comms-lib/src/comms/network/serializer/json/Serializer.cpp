@@ -0,0 +1,40 @@
+#include "comms/network/serializer/json/Serializer.h"
+#include "dom/DomException.h"
+
+namespace cadf::comms::json {
+
+    // Indicates that no data was found within the message
+    static const size_t NO_DATA = size_t(-1);
+
+    /*
+     * CTOR - load the header of the message, noting where the data is for later
+     */
+    MessageDeserializer::MessageDeserializer(InputBuffer *buffer) : IDeserializer(0, 0, ""), m_data(buffer->getData()), m_dataSize(buffer->getDataSize()), m_dataIndex(NO_DATA) {
+        JsonReader reader(m_data, m_dataSize);
+        reader.startObject();
+
+        std::string_view name;
+        while (reader.nextField(name)) {
+            if (name == "type") {
+                m_type = reader.readInt();
+            } else if (name == "instance") {
+                m_instance = reader.readInt();
+            } else if (name == "message") {
+                m_msgType = reader.readString();
+            } else {
+                if (name == "data")
+                    m_dataIndex = reader.getPosition();
+                reader.skipValue();
+            }
+        }
+    }
+
+    /*
+     * Get where the data starts
+     */
+    size_t MessageDeserializer::dataIndex() const {
+        if (m_dataIndex == NO_DATA)
+            throw cadf::dom::ParseException("\"data\"", m_dataSize);
+        return m_dataIndex;
+    }
+}
@@ -23,9 +23,12 @@ namespace cadf::comms {
         if (::connect(m_socketFd, (sockaddr*) &m_address, sizeof(m_address)) < 0)
             return false;
 
-        m_dataSocket = new TcpSocketDataHandler(m_socketFd, m_maxMessageSize);
+        // Only start reading once the listeners are in place, otherwise early messages (i.e.: handshake) can be lost
+        TcpSocketDataHandler *dataSocket = new TcpSocketDataHandler(m_socketFd, m_maxMessageSize, false);
         for (ISocketMessageReceivedListener *l: m_listeners)
-            m_dataSocket->addListener(l);
+            dataSocket->addListener(l);
+        m_dataSocket = dataSocket;
+        dataSocket->start();
         return true;
     }
 
@@ -41,6 +44,14 @@ namespace cadf::comms {
         return true;
     }
 
+    /*
+     * Stop reading first, so that the reading thread never waits on a closed (or since reused) file descriptor
+     */
+    bool TcpClientSocket::disconnect() {
+        terminateConnection();
+        return AbstractTcpSocket::disconnect();
+    }
+
     /*
      * Send a message
      */
@@ -45,6 +45,14 @@ namespace cadf::comms {
         return true;
     }
 
+    /*
+     * Stop accepting first, so that the thread never waits on a closed (or since reused) file descriptor
+     */
+    bool TcpServerSocket::disconnect() {
+        m_connectThread.stop();
+        return AbstractTcpSocket::disconnect();
+    }
+
     /*
      * Cannot send
      */
@@ -70,6 +78,9 @@ namespace cadf::comms {
      * Wait for a client to connect and process it
      */
     void TcpServerSocket::execLoop() {
+        if (!getCancellationToken().waitFor(m_socketFd))
+            return;
+
         int newSock = accept(m_socketFd, (sockaddr*) &m_address, (socklen_t*) &m_addrlen);
         if (newSock > 0)
             m_connectionHandler->handleConnection(newSock);
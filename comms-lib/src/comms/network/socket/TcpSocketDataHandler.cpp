@@ -4,13 +4,20 @@
 #include <functional>
 #include <algorithm>
 #include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 
 namespace cadf::comms {
     /*
      * CTOR
      */
-    TcpSocketDataHandler::TcpSocketDataHandler(int socketFd, size_t maxMessageSize) : m_socketFd(socketFd), m_maxMessageSize(maxMessageSize), m_messageBuffer(new char[maxMessageSize]) {
-        start();
+    TcpSocketDataHandler::TcpSocketDataHandler(int socketFd, size_t maxMessageSize, bool autoStart, const cadf::thread::ThreadConfig &threadConfig) :
+            LoopingThread(threadConfig), m_socketFd(socketFd), m_maxMessageSize(maxMessageSize), m_messageBuffer(new char[maxMessageSize]) {
+        // Messages are small and discrete, do not let Nagle hold them back waiting for an ACK
+        int noDelay = 1;
+        setsockopt(m_socketFd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        if (autoStart)
+            start();
     }
 
     /*
@@ -39,6 +46,7 @@ namespace cadf::comms {
      * Add the listener
      */
     void TcpSocketDataHandler::addListener(ISocketMessageReceivedListener *listener) {
+        std::unique_lock<std::mutex> lock(m_listenerMutex);
         m_listeners.push_back(listener);
     }
 
@@ -46,6 +54,7 @@ namespace cadf::comms {
      * Remove the listener
      */
     void TcpSocketDataHandler::removeListener(ISocketMessageReceivedListener *listener) {
+        std::unique_lock<std::mutex> lock(m_listenerMutex);
         m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener), m_listeners.end());
     }
 
@@ -53,6 +62,9 @@ namespace cadf::comms {
      * Read data from the socket
      */
     void TcpSocketDataHandler::execLoop() {
+        if (!getCancellationToken().waitFor(m_socketFd))
+            return;
+
         int valread = read(m_socketFd, m_messageBuffer, m_maxMessageSize);
         if (valread <= 0) {
             // TODO error!
@@ -67,7 +79,13 @@ namespace cadf::comms {
      */
     void TcpSocketDataHandler::processMessage(size_t messageSize) {
         InputBuffer inBuffer(m_messageBuffer, messageSize);
-        for (ISocketMessageReceivedListener *l : m_listeners)
+        // Listeners can add/remove listeners while processing (i.e.: handshake completing), so iterate over a snapshot
+        std::vector<ISocketMessageReceivedListener*> listeners;
+        {
+            std::unique_lock<std::mutex> lock(m_listenerMutex);
+            listeners = m_listeners;
+        }
+        for (ISocketMessageReceivedListener *l : listeners)
             l->messageReceived(&inBuffer);
     }
 
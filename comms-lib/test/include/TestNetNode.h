@@ -4,6 +4,9 @@
 #include "comms/network/BasicNodeClient.h"
 
 #include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include "TestMessage.h"
 
 namespace test {
@@ -24,7 +27,14 @@ namespace test {
                 lastVal2 = msg->getData().val2;
             }
 
+            void waitForMessages(int expectedReceived) {
+                // Allow for the message to make its way through the network
+                for (int i = 0; i < 100 && numReceived < expectedReceived; i++)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+
             void verifyState(int expectedReceived, int expectLastVal1, double expectedLastVal2) {
+                waitForMessages(expectedReceived);
                 BOOST_CHECK_EQUAL(expectedReceived, numReceived);
                 BOOST_CHECK_EQUAL(expectLastVal1, lastVal1);
                 lastVal1 = -1;
@@ -33,9 +43,9 @@ namespace test {
             }
 
         private:
-            int numReceived = 0;
-            int lastVal1 = -1;
-            double lastVal2 = -2;
+            std::atomic<int> numReceived = 0;
+            std::atomic<int> lastVal1 = -1;
+            std::atomic<double> lastVal2 = -2;
     };
 
 }
@@ -3,6 +3,7 @@
 #include "TestData.h"
 
 #include "comms/network/serializer/dom/BaseSerializer.h"
+#include "comms/network/serializer/json/Serializer.h"
 #include "comms/message/MessageFactory.h"
 #include "comms/message/Message.h"
 
@@ -49,3 +50,27 @@ TestData cadf::comms::dom::loadFromTree<TestData>(const cadf::dom::DomNode &root
     data.val2 = root["val2"];
     return data;
 }
+
+template<>
+void cadf::comms::json::writeJson<TestData>(const TestData &data, JsonWriter *writer) {
+    writer->startObject();
+    writer->writeField("val1", data.val1);
+    writer->writeField("val2", data.val2);
+    writer->endObject();
+}
+
+template<>
+TestData cadf::comms::json::readJson<TestData>(JsonReader *reader) {
+    TestData data;
+    reader->startObject();
+    std::string_view name;
+    while (reader->nextField(name)) {
+        if (name == "val1")
+            data.val1 = reader->readInt();
+        else if (name == "val2")
+            data.val2 = reader->readDouble();
+        else
+            reader->skipValue();
+    }
+    return data;
+}
@@ -26,7 +26,7 @@ namespace LocalThreadedBusTest {
                 stubMockConnection(mockConn2_2, 2, 2);
                 stubMockConnection(mockConn3_1, 3, 1);
                 stubMockConnection(mockConn3_2, 3, 2);
-                fakeit::When(Method(mockThreadPool, schedule)).AlwaysDo([=] (std::function<void()> func) {scheduledFunc = func;});
+                fakeit::When(Method(mockThreadPool, schedule)).AlwaysDo([=] (cadf::thread::TaskFunction &func) {scheduledFunc = std::move(func);});
             }
 
             void stubMockConnection(fakeit::Mock<cadf::comms::IBusConnection> &mockConnection, int type, int instance) {
@@ -52,7 +52,7 @@ namespace LocalThreadedBusTest {
             }
 
             fakeit::Mock<cadf::thread::IThreadPool> mockThreadPool;
-            std::function<void()> scheduledFunc;
+            cadf::thread::TaskFunction scheduledFunc;
             fakeit::Mock<cadf::comms::IBusConnection> mockConn1_1;
             fakeit::Mock<cadf::comms::IBusConnection> mockConn1_2;
             fakeit::Mock<cadf::comms::IBusConnection> mockConn2_1;
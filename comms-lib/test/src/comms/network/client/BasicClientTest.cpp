@@ -221,6 +221,9 @@ BOOST_AUTO_TEST_SUITE(BasicClient_Test_Suite)
         BOOST_CHECK(!client->connect());
         verifyIsConnectedCalled();
         fakeit::Verify(Method(mockSocket, connect)).Once();
+        // The listener is registered ahead of connecting, and must be removed again on failure
+        fakeit::Verify(Method(mockSocket, addMessageListener).Using(&mockListener.get())).Once();
+        fakeit::Verify(Method(mockSocket, removeMessageListener).Using(&mockListener.get())).Once();
 
         // Clear the failure
         fakeit::When(Method(mockSocket, connect)).AlwaysReturn(true);
@@ -0,0 +1,71 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "TestData.h"
+#include "TestMessage.h"
+#include "comms/network/serializer/dom/CborSerializer.h"
+#include "comms/network/serializer/dom/JsonSerializer.h"
+
+/**
+ * Test suite for the CBOR (de)serialization
+ */
+BOOST_AUTO_TEST_SUITE(SerializerCBOR_Test_Suite)
+
+    /**
+     * Verify that the message is serialized to the exact size, and can be deserialized.
+     */
+    BOOST_AUTO_TEST_CASE(TestSerializeDeserializeDataExactSize) {
+        TestData data { 123, 1.23 };
+        TestMessage1 msg(data);
+
+        cadf::comms::dom::cbor::CborSerializer<TestData> serializer(&msg, 1, 2);
+        BOOST_CHECK_EQUAL(65, serializer.getSize());
+        cadf::comms::OutputBuffer outBuffer(serializer.getSize());
+        serializer.serialize(&outBuffer);
+        BOOST_CHECK_EQUAL(65, outBuffer.getDataSize());
+
+        // Smaller than the equivalent JSON
+        cadf::comms::dom::json::JsonSerializer<TestData> jsonSerializer(&msg, 1, 2);
+        BOOST_CHECK_LT(serializer.getSize(), jsonSerializer.getSize());
+
+        cadf::comms::InputBuffer inBuffer(outBuffer.getData(), outBuffer.getDataSize());
+        cadf::comms::dom::cbor::CborDeserializer deserializer(&inBuffer);
+        BOOST_CHECK_EQUAL("TestMessage1", deserializer.getMessageType());
+        BOOST_CHECK_EQUAL(1, deserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(2, deserializer.getRecipientInstance());
+
+        TestData newData = deserializer.getData<TestData>();
+        BOOST_CHECK_EQUAL(data, newData);
+    }
+
+    /**
+     * Verify that a message can be serialized and deserialized when the protocol is employed
+     */
+    BOOST_AUTO_TEST_CASE(TestProtocolSerializeDeserialize) {
+        TestData data { -987, 4.5 };
+        TestMessage3 msg(data);
+
+        cadf::comms::ISerializerFactory *serializerFactory = cadf::comms::dom::cbor::CBORProtocol::createSerializerFactory(&msg);
+        cadf::comms::ISerializer *serializer = serializerFactory->buildSerializer(&msg, 5, 6);
+        cadf::comms::OutputBuffer out(serializer->getSize());
+        serializer->serialize(&out);
+
+        cadf::comms::InputBuffer in(out.getData(), out.getDataSize());
+        cadf::comms::IDeserializer *deserializer = cadf::comms::dom::cbor::CBORProtocol::createDeserializer(&in);
+        BOOST_CHECK_EQUAL("TestMessage3", deserializer->getMessageType());
+        BOOST_CHECK_EQUAL(5, deserializer->getRecipientType());
+        BOOST_CHECK_EQUAL(6, deserializer->getRecipientInstance());
+        TestMessage3 received;
+        serializerFactory->deserializeTo(&received, deserializer);
+        BOOST_CHECK_EQUAL(data, received.getData());
+
+        delete(serializer);
+        delete(deserializer);
+        delete(serializerFactory);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
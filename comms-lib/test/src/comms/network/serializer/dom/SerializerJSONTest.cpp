@@ -8,6 +8,7 @@
 #include "TestData.h"
 #include "TestMessage.h"
 #include "comms/network/serializer/dom/JsonSerializer.h"
+#include "dom/DomException.h"
 
 /**
  * Test suite for the Serialization functions
@@ -86,4 +87,34 @@ BOOST_AUTO_TEST_SUITE(SerializerJSON_Test_Suite)
         delete(serializerFactory);
     }
 
+    /**
+     * Verify that the data of the message is only parsed once it is retrieved
+     */
+    BOOST_AUTO_TEST_CASE(TestLazyDeserialize) {
+        std::string json = "{\"data\":{\"val1\":246,\"val2\":1.5,\"extra\":[{\"a\":\"}]\"},[]]},\"instance\":8,\"message\":\"TestMessage1\",\"type\":7}";
+        cadf::comms::InputBuffer in(json.c_str(), json.size() + 1);
+        cadf::comms::dom::json::JsonDeserializer deserializer(&in);
+        BOOST_CHECK_EQUAL("TestMessage1", deserializer.getMessageType());
+        BOOST_CHECK_EQUAL(7, deserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(8, deserializer.getRecipientInstance());
+        BOOST_CHECK(!deserializer.getDocument().isParsed("data"));
+
+        TestData expected { 246, 1.5 };
+        BOOST_CHECK_EQUAL(expected, deserializer.getData<TestData>());
+        BOOST_CHECK(deserializer.getDocument().isParsed("data"));
+    }
+
+    /**
+     * Verify that the details of the message can be read even if the data is malformed
+     */
+    BOOST_AUTO_TEST_CASE(TestLazyDeserializeMalformedData) {
+        std::string json = "{\"type\":1,\"data\":{\"val1\" 1},\"instance\":2,\"message\":\"TestMessage2\"}";
+        cadf::comms::InputBuffer in(json.c_str(), json.size() + 1);
+        cadf::comms::dom::json::JsonDeserializer deserializer(&in);
+        BOOST_CHECK_EQUAL("TestMessage2", deserializer.getMessageType());
+        BOOST_CHECK_EQUAL(1, deserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(2, deserializer.getRecipientInstance());
+        BOOST_CHECK_THROW(deserializer.getData<TestData>(), cadf::dom::ParseException);
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,155 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "comms/network/serializer/dom/StateDelta.h"
+#include "comms/network/serializer/dom/JsonSerializer.h"
+#include "comms/message/Message.h"
+#include "dom/DomException.h"
+
+namespace StateDeltaTest {
+
+    /**
+     * Message carrying a state update
+     */
+    class StateMessage: public cadf::comms::AbstractDataMessage<cadf::comms::dom::StateUpdate> {
+        public:
+            StateMessage(): cadf::comms::AbstractDataMessage<cadf::comms::dom::StateUpdate>("StateMessage", cadf::comms::dom::StateUpdate()) {}
+            StateMessage(const cadf::comms::dom::StateUpdate &data) : cadf::comms::AbstractDataMessage<cadf::comms::dom::StateUpdate>("StateMessage", data) {}
+
+            AbstractDataMessage<cadf::comms::dom::StateUpdate>* newInstance() const {
+                return new StateMessage(m_data);
+            }
+    };
+
+    /**
+     * Build a large state, of which only the specified value changes
+     */
+    cadf::dom::DomNode buildState(int value) {
+        cadf::dom::DomNode state;
+        for (int i = 0; i < 100; i++)
+            state["entry" + std::to_string(i)] = "unchanging value " + std::to_string(i);
+        state["value"] = value;
+        return state;
+    }
+
+    /**
+     * Send the update through the JSON serializer, as it would be over the network
+     */
+    cadf::comms::dom::StateUpdate transfer(const cadf::comms::dom::StateUpdate &update, size_t *size) {
+        StateMessage msg(update);
+        cadf::comms::dom::json::JsonSerializer<cadf::comms::dom::StateUpdate> serializer(&msg, 1, 2);
+        *size = serializer.getSize();
+        cadf::comms::OutputBuffer out(serializer.getSize());
+        serializer.serialize(&out);
+
+        cadf::comms::InputBuffer in(out.getData(), out.getDataSize());
+        cadf::comms::dom::json::JsonDeserializer deserializer(&in);
+        return deserializer.getData<cadf::comms::dom::StateUpdate>();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(StateDelta_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(FullThenDeltaTest) {
+        cadf::comms::dom::StateEncoder encoder;
+        cadf::comms::dom::StateDecoder decoder;
+
+        size_t fullSize;
+        cadf::comms::dom::StateUpdate update = StateDeltaTest::transfer(encoder.encode(StateDeltaTest::buildState(1)), &fullSize);
+        BOOST_CHECK_EQUAL(1, update.sequence);
+        BOOST_CHECK_EQUAL(0, update.base);
+        BOOST_CHECK(StateDeltaTest::buildState(1) == decoder.decode(update));
+        BOOST_CHECK_EQUAL(1, decoder.getSequence());
+
+        // Nothing acknowledged yet, still sent in full
+        size_t size;
+        update = StateDeltaTest::transfer(encoder.encode(StateDeltaTest::buildState(2)), &size);
+        BOOST_CHECK_EQUAL(0, update.base);
+        BOOST_CHECK(StateDeltaTest::buildState(2) == decoder.decode(update));
+
+        encoder.acknowledge(decoder.getSequence());
+        BOOST_CHECK_EQUAL(2, encoder.getAcknowledged());
+        update = StateDeltaTest::transfer(encoder.encode(StateDeltaTest::buildState(3)), &size);
+        BOOST_CHECK_EQUAL(3, update.sequence);
+        BOOST_CHECK_EQUAL(2, update.base);
+        BOOST_CHECK(size * 10 < fullSize);
+        BOOST_CHECK(StateDeltaTest::buildState(3) == decoder.decode(update));
+    }
+
+    BOOST_AUTO_TEST_CASE(LostUpdateTest) {
+        cadf::comms::dom::StateEncoder encoder;
+        cadf::comms::dom::StateDecoder decoder;
+
+        decoder.decode(encoder.encode(StateDeltaTest::buildState(1)));
+        encoder.acknowledge(decoder.getSequence());
+
+        // The second update never arrives, the third is still against the acknowledged state
+        encoder.encode(StateDeltaTest::buildState(2));
+        cadf::comms::dom::StateUpdate update = encoder.encode(StateDeltaTest::buildState(3));
+        BOOST_CHECK_EQUAL(1, update.base);
+        BOOST_CHECK(StateDeltaTest::buildState(3) == decoder.decode(update));
+        encoder.acknowledge(decoder.getSequence());
+        BOOST_CHECK_EQUAL(3, encoder.getAcknowledged());
+
+        // Acknowledging the lost (older) update has no effect
+        encoder.acknowledge(2);
+        BOOST_CHECK_EQUAL(3, encoder.getAcknowledged());
+        BOOST_CHECK(StateDeltaTest::buildState(4) == decoder.decode(encoder.encode(StateDeltaTest::buildState(4))));
+    }
+
+    BOOST_AUTO_TEST_CASE(ResetTest) {
+        cadf::comms::dom::StateEncoder encoder;
+        cadf::comms::dom::StateDecoder decoder;
+        decoder.decode(encoder.encode(StateDeltaTest::buildState(1)));
+        encoder.acknowledge(1);
+
+        // A new receiver does not know the base
+        cadf::comms::dom::StateDecoder newDecoder;
+        BOOST_CHECK_THROW(newDecoder.decode(encoder.encode(StateDeltaTest::buildState(2))), cadf::dom::PatchException);
+
+        encoder.reset();
+        cadf::comms::dom::StateUpdate update = encoder.encode(StateDeltaTest::buildState(3));
+        BOOST_CHECK_EQUAL(0, update.base);
+        BOOST_CHECK(StateDeltaTest::buildState(3) == newDecoder.decode(update));
+    }
+
+    BOOST_AUTO_TEST_CASE(MaxPendingTest) {
+        cadf::comms::dom::StateEncoder encoder(2);
+        encoder.encode(StateDeltaTest::buildState(1));
+        encoder.encode(StateDeltaTest::buildState(2));
+        encoder.encode(StateDeltaTest::buildState(3));
+        // No longer retained
+        encoder.acknowledge(1);
+        BOOST_CHECK_EQUAL(0, encoder.getAcknowledged());
+        encoder.acknowledge(2);
+        BOOST_CHECK_EQUAL(2, encoder.getAcknowledged());
+    }
+
+    BOOST_AUTO_TEST_CASE(DecoderWindowTest) {
+        cadf::comms::dom::StateEncoder encoder(4);
+        cadf::comms::dom::StateDecoder decoder(4);
+        decoder.decode(encoder.encode(StateDeltaTest::buildState(0)));
+        encoder.acknowledge(decoder.getSequence());
+
+        // Every acknowledgement is lost, so every update is against the same base, yet the decoder does not grow
+        for (int i = 1; i <= 1000; i++) {
+            cadf::comms::dom::StateUpdate update = encoder.encode(StateDeltaTest::buildState(i));
+            BOOST_REQUIRE_EQUAL(1, update.base);
+            BOOST_REQUIRE(StateDeltaTest::buildState(i) == decoder.decode(update));
+            BOOST_REQUIRE(decoder.getNumStates() <= 5);
+        }
+        BOOST_CHECK_EQUAL(5, decoder.getNumStates());
+
+        // Any state which the encoder can still use as a base is retained
+        encoder.acknowledge(decoder.getSequence() - 3);
+        BOOST_CHECK_EQUAL(decoder.getSequence() - 3, encoder.getAcknowledged());
+        cadf::comms::dom::StateUpdate update = encoder.encode(StateDeltaTest::buildState(1001));
+        BOOST_CHECK(StateDeltaTest::buildState(1001) == decoder.decode(update));
+        BOOST_CHECK(StateDeltaTest::buildState(1002) == decoder.decode(encoder.encode(StateDeltaTest::buildState(1002))));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,266 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "TestData.h"
+#include "TestMessage.h"
+#include "comms/network/serializer/json/Serializer.h"
+#include "comms/network/serializer/dom/JsonSerializer.h"
+#include "dom/DomException.h"
+
+/**
+ * Test suite for the streaming JSON serialization
+ */
+BOOST_AUTO_TEST_SUITE(SerializerJSONStream_Test_Suite)
+
+    /**
+     * Verify that the size of the data is properly determined and that the output matches that of the DOM based JSON.
+     */
+    BOOST_AUTO_TEST_CASE(TestSerializeDeserializeDataExactSize) {
+        TestData data { 123, 1.23 };
+        TestMessage1 msg(data);
+
+        cadf::comms::json::MessageSerializer<TestData> serializer(&msg, 1, 2);
+        BOOST_CHECK_EQUAL(81, serializer.getSize());
+        cadf::comms::OutputBuffer outBuffer(serializer.getSize());
+        serializer.serialize(&outBuffer);
+        BOOST_CHECK_EQUAL(81, outBuffer.getDataSize());
+        BOOST_CHECK_EQUAL("{\"data\":{\"val1\":123,\"val2\":1.23},\"instance\":2,\"message\":\"TestMessage1\",\"type\":1}", outBuffer.getData());
+
+        cadf::comms::InputBuffer inBuffer(outBuffer.getData(), outBuffer.getDataSize());
+        cadf::comms::json::MessageDeserializer deserializer(&inBuffer);
+        BOOST_CHECK_EQUAL("TestMessage1", deserializer.getMessageType());
+        BOOST_CHECK_EQUAL(1, deserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(2, deserializer.getRecipientInstance());
+
+        TestData newData = deserializer.getData<TestData>();
+        BOOST_CHECK_EQUAL(data, newData);
+    }
+
+    /**
+     * Verify that a buffer which is too small is reported
+     */
+    BOOST_AUTO_TEST_CASE(TestSerializeBufferTooSmall) {
+        TestData data { 123, 1.23 };
+        TestMessage1 msg(data);
+
+        cadf::comms::json::MessageSerializer<TestData> serializer(&msg, 1, 2);
+        cadf::comms::OutputBuffer outBuffer(serializer.getSize() - 1);
+        BOOST_CHECK_THROW(serializer.serialize(&outBuffer), cadf::comms::BufferOverflowException);
+    }
+
+    /**
+     * Verify that the streaming and DOM based JSON protocols can read each others messages
+     */
+    BOOST_AUTO_TEST_CASE(TestWireCompatibleWithDom) {
+        TestData data { -456, 0.123 };
+        TestMessage2 msg(data);
+
+        // Stream -> DOM
+        cadf::comms::json::MessageSerializer<TestData> streamSerializer(&msg, 3, 4);
+        cadf::comms::OutputBuffer streamOut(streamSerializer.getSize());
+        streamSerializer.serialize(&streamOut);
+        cadf::comms::InputBuffer streamIn(streamOut.getData(), streamOut.getDataSize());
+        cadf::comms::dom::json::JsonDeserializer domDeserializer(&streamIn);
+        BOOST_CHECK_EQUAL("TestMessage2", domDeserializer.getMessageType());
+        BOOST_CHECK_EQUAL(3, domDeserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(4, domDeserializer.getRecipientInstance());
+        BOOST_CHECK_EQUAL(data, domDeserializer.getData<TestData>());
+
+        // DOM -> Stream
+        cadf::comms::dom::json::JsonSerializer<TestData> domSerializer(&msg, 3, 4);
+        cadf::comms::OutputBuffer domOut(domSerializer.getSize());
+        domSerializer.serialize(&domOut);
+        BOOST_CHECK_EQUAL(std::string(domOut.getData()), std::string(streamOut.getData()));
+        cadf::comms::InputBuffer domIn(domOut.getData(), domOut.getDataSize());
+        cadf::comms::json::MessageDeserializer streamDeserializer(&domIn);
+        BOOST_CHECK_EQUAL("TestMessage2", streamDeserializer.getMessageType());
+        BOOST_CHECK_EQUAL(3, streamDeserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(4, streamDeserializer.getRecipientInstance());
+        BOOST_CHECK_EQUAL(data, streamDeserializer.getData<TestData>());
+    }
+
+    /**
+     * Verify that doubles requiring more than 6 significant digits are written identically by both protocols, without losing precision
+     */
+    BOOST_AUTO_TEST_CASE(TestFullPrecisionMatchesDom) {
+        TestData data { 1, 1.0 / 3 };
+        TestMessage1 msg(data);
+
+        cadf::comms::ISerializerFactory *streamFactory = cadf::comms::json::JSONStreamProtocol::createSerializerFactory(&msg);
+        cadf::comms::ISerializerFactory *domFactory = cadf::comms::dom::json::JSONProtocol::createSerializerFactory(&msg);
+        cadf::comms::ISerializer *streamSerializer = streamFactory->buildSerializer(&msg, 1, 2);
+        cadf::comms::ISerializer *domSerializer = domFactory->buildSerializer(&msg, 1, 2);
+        cadf::comms::OutputBuffer streamOut(streamSerializer->getSize());
+        streamSerializer->serialize(&streamOut);
+        cadf::comms::OutputBuffer domOut(domSerializer->getSize());
+        domSerializer->serialize(&domOut);
+
+        BOOST_CHECK_EQUAL("{\"data\":{\"val1\":1,\"val2\":0.3333333333333333},\"instance\":2,\"message\":\"TestMessage1\",\"type\":1}",
+                std::string(streamOut.getData()));
+        BOOST_CHECK_EQUAL(std::string(domOut.getData()), std::string(streamOut.getData()));
+
+        cadf::comms::InputBuffer in(streamOut.getData(), streamOut.getDataSize());
+        cadf::comms::json::MessageDeserializer deserializer(&in);
+        BOOST_CHECK_EQUAL(data, deserializer.getData<TestData>());
+
+        delete(streamSerializer);
+        delete(domSerializer);
+        delete(streamFactory);
+        delete(domFactory);
+    }
+
+    /**
+     * Verify that fields can appear in any order, with whitespace, and unknown fields are skipped
+     */
+    BOOST_AUTO_TEST_CASE(TestDeserializeUnorderedWithUnknownFields) {
+        std::string json = " { \"type\" : 7, \"extra\": [1, {\"a\": [\"]}\"]}, null], \"message\":\"Test\\\"Message\\u00e9\", "
+                "\"data\" : { \"other\": {}, \"val2\" : -1.5e2, \"val1\" : 42 }, \"instance\": 8 } ";
+        cadf::comms::InputBuffer inBuffer(json.c_str(), json.size());
+        cadf::comms::json::MessageDeserializer deserializer(&inBuffer);
+        BOOST_CHECK_EQUAL("Test\"Message\xC3\xA9", deserializer.getMessageType());
+        BOOST_CHECK_EQUAL(7, deserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(8, deserializer.getRecipientInstance());
+
+        TestData expected { 42, -150 };
+        BOOST_CHECK_EQUAL(expected, deserializer.getData<TestData>());
+    }
+
+    /**
+     * Verify that malformed JSON is reported
+     */
+    BOOST_AUTO_TEST_CASE(TestDeserializeMalformed) {
+        std::string missingComma = "{\"type\":1 \"instance\":2}";
+        cadf::comms::InputBuffer missingCommaBuffer(missingComma.c_str(), missingComma.size());
+        BOOST_CHECK_THROW(cadf::comms::json::MessageDeserializer deserializer(&missingCommaBuffer), cadf::dom::ParseException);
+
+        std::string unterminated = "{\"message\":\"abc";
+        cadf::comms::InputBuffer unterminatedBuffer(unterminated.c_str(), unterminated.size());
+        BOOST_CHECK_THROW(cadf::comms::json::MessageDeserializer deserializer(&unterminatedBuffer), cadf::dom::ParseException);
+
+        std::string notNumber = "{\"type\":abc}";
+        cadf::comms::InputBuffer notNumberBuffer(notNumber.c_str(), notNumber.size());
+        BOOST_CHECK_THROW(cadf::comms::json::MessageDeserializer deserializer(&notNumberBuffer), cadf::dom::ParseException);
+
+        std::string noData = "{\"type\":1,\"instance\":2,\"message\":\"abc\"}";
+        cadf::comms::InputBuffer noDataBuffer(noData.c_str(), noData.size());
+        cadf::comms::json::MessageDeserializer deserializer(&noDataBuffer);
+        BOOST_CHECK_THROW(deserializer.getData<TestData>(), cadf::dom::ParseException);
+    }
+
+    /**
+     * Verify that the reader decodes strings and field names as the DOM parser does, rejecting anything which is not JSON
+     */
+    BOOST_AUTO_TEST_CASE(TestReaderStrictDecoding) {
+        std::string escapedName = "{\"ty\\u0070e\":7,\"instance\":8,\"message\":\"Test\"}";
+        cadf::comms::InputBuffer escapedNameBuffer(escapedName.c_str(), escapedName.size());
+        cadf::comms::json::MessageDeserializer deserializer(&escapedNameBuffer);
+        BOOST_CHECK_EQUAL(7, deserializer.getRecipientType());
+        BOOST_CHECK_EQUAL(8, deserializer.getRecipientInstance());
+
+        std::string strings = "[\"\\q\", \"\\ud800x\", \"\\udc00\", \"\\ud83d\\ude00\", \"\\/\"]";
+        cadf::comms::json::JsonReader reader(strings.c_str(), strings.size());
+        reader.startArray();
+        BOOST_REQUIRE(reader.nextElement());
+        BOOST_CHECK_THROW(reader.readString(), cadf::dom::ParseException);
+        BOOST_REQUIRE(reader.nextElement());
+        BOOST_CHECK_EQUAL("\xEF\xBF\xBDx", reader.readString());
+        BOOST_REQUIRE(reader.nextElement());
+        BOOST_CHECK_EQUAL("\xEF\xBF\xBD", reader.readString());
+        BOOST_REQUIRE(reader.nextElement());
+        BOOST_CHECK_EQUAL("\xF0\x9F\x98\x80", reader.readString());
+        BOOST_REQUIRE(reader.nextElement());
+        BOOST_CHECK_EQUAL("/", reader.readString());
+        BOOST_CHECK(!reader.nextElement());
+
+        std::string bools = "[true,false,1,0]";
+        cadf::comms::json::JsonReader boolReader(bools.c_str(), bools.size());
+        boolReader.startArray();
+        BOOST_REQUIRE(boolReader.nextElement());
+        BOOST_CHECK_EQUAL(true, boolReader.readBool());
+        BOOST_REQUIRE(boolReader.nextElement());
+        BOOST_CHECK_EQUAL(false, boolReader.readBool());
+        BOOST_REQUIRE(boolReader.nextElement());
+        BOOST_CHECK_THROW(boolReader.readBool(), cadf::dom::ParseException);
+        BOOST_REQUIRE(boolReader.nextElement());
+        BOOST_CHECK_THROW(boolReader.readBool(), cadf::dom::ParseException);
+
+        std::string highBytes = "{\"\xC3\xA9\":\"\xA0\xC3\xA9\"}";
+        cadf::comms::json::JsonReader highBytesReader(highBytes.c_str(), highBytes.size());
+        highBytesReader.startObject();
+        std::string_view name;
+        BOOST_REQUIRE(highBytesReader.nextField(name));
+        BOOST_CHECK_EQUAL("\xC3\xA9", name);
+        BOOST_CHECK_EQUAL("\xA0\xC3\xA9", highBytesReader.readString());
+        BOOST_CHECK(!highBytesReader.nextField(name));
+    }
+
+    /**
+     * Verify that the writer properly separates and escapes values
+     */
+    BOOST_AUTO_TEST_CASE(TestWriterEscapeAndNesting) {
+        cadf::comms::json::JsonWriter sizer;
+        cadf::comms::OutputBuffer out(100);
+        cadf::comms::json::JsonWriter writer(&out);
+        for (cadf::comms::json::JsonWriter *w : { &sizer, &writer }) {
+            w->startObject();
+            w->writeKey("arr");
+            w->startArray();
+            w->writeValue(1);
+            w->startObject();
+            w->endObject();
+            w->writeNull();
+            w->writeValue(true);
+            w->endArray();
+            w->writeField("str", "a\"b\\c\nd\x01");
+            w->endObject();
+        }
+
+        std::string expected = "{\"arr\":[1,{},null,true],\"str\":\"a\\\"b\\\\c\\nd\\u0001\"}";
+        BOOST_CHECK_EQUAL(expected.size(), sizer.getSize());
+        BOOST_CHECK_EQUAL(expected.size(), writer.getSize());
+        BOOST_CHECK_EQUAL(expected, std::string(out.getData(), out.getDataSize()));
+
+        cadf::comms::json::JsonReader reader(out.getData(), out.getDataSize());
+        std::string_view name;
+        reader.startObject();
+        BOOST_REQUIRE(reader.nextField(name));
+        BOOST_CHECK_EQUAL("arr", name);
+        reader.skipValue();
+        BOOST_REQUIRE(reader.nextField(name));
+        BOOST_CHECK_EQUAL("str", name);
+        BOOST_CHECK_EQUAL("a\"b\\c\nd\x01", reader.readString());
+        BOOST_CHECK(!reader.nextField(name));
+    }
+
+    /**
+     * Verify that a message can be serialized and deserialized when the protocol is employed
+     */
+    BOOST_AUTO_TEST_CASE(TestProtocolSerializeDeserialize) {
+        TestData data { 987, 4.321 };
+        TestMessage3 msg(data);
+
+        cadf::comms::ISerializerFactory *serializerFactory = cadf::comms::json::JSONStreamProtocol::createSerializerFactory(&msg);
+        cadf::comms::ISerializer *serializer = serializerFactory->buildSerializer(&msg, 5, 6);
+        cadf::comms::OutputBuffer out(serializer->getSize());
+        serializer->serialize(&out);
+        BOOST_CHECK_EQUAL("{\"data\":{\"val1\":987,\"val2\":4.321},\"instance\":6,\"message\":\"TestMessage3\",\"type\":5}", out.getData());
+
+        cadf::comms::InputBuffer in(out.getData(), out.getDataSize());
+        cadf::comms::IDeserializer *deserializer = cadf::comms::json::JSONStreamProtocol::createDeserializer(&in);
+        BOOST_CHECK_EQUAL("TestMessage3", deserializer->getMessageType());
+        BOOST_CHECK_EQUAL(5, deserializer->getRecipientType());
+        BOOST_CHECK_EQUAL(6, deserializer->getRecipientInstance());
+        TestMessage3 received;
+        serializerFactory->deserializeTo(&received, deserializer);
+        BOOST_CHECK_EQUAL(data, received.getData());
+
+        delete(serializer);
+        delete(deserializer);
+        delete(serializerFactory);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,8 @@
 
 #include "comms/network/serializer/binary/Serializer.h"
 #include "comms/network/serializer/dom/JsonSerializer.h"
+#include "comms/network/serializer/dom/CborSerializer.h"
+#include "comms/network/serializer/json/Serializer.h"
 
 #include "TestServer.h"
 #include "TestNetNode.h"
@@ -29,8 +31,8 @@ namespace ClientConnectionIT {
     /**
      * Helper to pause the test for a moment to give the thread being tested a moment in which to progress its execution.
      */
-    void giveThreadSomeTime() {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    void giveThreadSomeTime(int millis = 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(millis));
     }
 
     /**
@@ -69,8 +71,8 @@ namespace ClientConnectionIT {
         BOOST_CHECK(client2.connect());
         BOOST_CHECK(client2.isConnected());
 
-        // Wait for handshaking to complete
-        giveThreadSomeTime();
+        // Wait for handshaking to complete (this takes several round trips, so allow for plenty of time)
+        giveThreadSomeTime(200);
 
         // Send a test message from Client1 to Client2
         TestData data1 = {1, 1.23};
@@ -129,4 +131,18 @@ BOOST_AUTO_TEST_SUITE(ClientConnectionIT_Test_Suite)
         ClientConnectionIT::performTest<cadf::comms::dom::json::JSONProtocol>(1234);
     }
 
+    /**
+     * Verify that it is possible to send and receive messages when using the streaming JSON protocol
+     */
+    BOOST_AUTO_TEST_CASE(JSONStreamConnectAndMessageTest) {
+        ClientConnectionIT::performTest<cadf::comms::json::JSONStreamProtocol>(2345);
+    }
+
+    /**
+     * Verify that it is possible to send and receive messages when using the CBOR protocol
+     */
+    BOOST_AUTO_TEST_CASE(CBORConnectAndMessageTest) {
+        ClientConnectionIT::performTest<cadf::comms::dom::cbor::CBORProtocol>(3456);
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,61 @@
+#ifndef DOM_DOMBUILDER_H_
+#define DOM_DOMBUILDER_H_
+
+#include "dom/DomNode.h"
+
+#include <string>
+
+namespace cadf::dom {
+
+    /**
+     * Builds up a single DomNode (either an object or an array) without copying any of the values that are added to it. Values provided
+     * as rvalues are moved into the node, and the children of an object are appended in linear time with the sorted order only being
+     * restored once, when the node is built.
+     *
+     * DomNode node = DomBuilder().add("name", "value").add("list", std::move(list)).add("child", DomBuilder().add("x", 1).build()).build();
+     */
+    class DomBuilder {
+        public:
+            /**
+             * CTOR
+             *
+             * @param &alloc const DomNode::allocator_type from which the node is to be allocated (defaults to the default memory resource)
+             */
+            DomBuilder(const DomNode::allocator_type &alloc = DomNode::allocator_type());
+
+            /**
+             * DTOR
+             */
+            virtual ~DomBuilder() = default;
+
+            /**
+             * Add a named child to the node. If the same name is added multiple times, the last value added is retained.
+             *
+             * @param &name const std::string the name of the child
+             * @param value DomNode the value of the child (move it in to avoid copying it)
+             * @return DomBuilder& this builder
+             */
+            DomBuilder& add(const std::string &name, DomNode value);
+
+            /**
+             * Add an element to the end of the node's array.
+             *
+             * @param value DomNode the element (move it in to avoid copying it)
+             * @return DomBuilder& this builder
+             */
+            DomBuilder& addElement(DomNode value);
+
+            /**
+             * Complete the node, handing it over to the caller. The builder is left empty, ready to build another node.
+             *
+             * @return DomNode that was built
+             */
+            DomNode build();
+
+        private:
+            /** The node being built */
+            DomNode m_node;
+    };
+}
+
+#endif /* DOM_DOMBUILDER_H_ */
@@ -2,6 +2,10 @@
 #define DOM_DOMCONVERTER_H_
 
 #include "dom/DomNode.h"
+#include "dom/DomDocument.h"
+#include "dom/OutputSink.h"
+
+#include <string_view>
 
 namespace cadf::dom {
 
@@ -38,6 +42,19 @@ namespace cadf::dom {
              */
             virtual std::string toString(const DomNode &node) = 0;
 
+            /**
+             * Write the representation of the specified node (including any nested and child nodes)
+             * directly into the sink. By default this writes the result of toString, converters are
+             * expected to override this to write in place.
+             *
+             * @param &node const DomNode to convert
+             * @param *sink OutputSink where the representation is to be written
+             */
+            virtual void write(const DomNode &node, OutputSink *sink) {
+                std::string conv = toString(node);
+                sink->write(conv.data(), conv.size());
+            }
+
             /**
              * Generate a tree of DomNodes to reflect the data contained within the
              * specified string.
@@ -47,6 +64,77 @@ namespace cadf::dom {
              * @throws ParseException if there is a problem performing the conversion
              */
             virtual DomNode fromString(const std::string &dataString) = 0;
+
+            /**
+             * Generate a tree of DomNodes within the document, to reflect the data contained within the specified string. The
+             * tree replaces the current root of the document. By default the tree is converted as per fromString(dataString) and
+             * then copied into the document.
+             *
+             * @param &dataString const std::string containing the string representation to convert
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws ParseException if there is a problem performing the conversion
+             */
+            virtual void fromString(const std::string &dataString, DomDocument *document) {
+                document->getRoot() = fromString(dataString);
+            }
+
+            /**
+             * Generate a tree of DomNodes to reflect the data contained within the specified view. By default the data is copied
+             * into a string and converted as per fromString(dataString), converters are expected to override this to convert the
+             * data in place.
+             *
+             * @param data std::string_view over the representation to convert
+             * @return DomNode the root of the converted DOM tree
+             * @throws ParseException if there is a problem performing the conversion
+             */
+            virtual DomNode fromData(std::string_view data) {
+                return fromString(std::string(data));
+            }
+
+            /**
+             * Generate a tree of DomNodes within the document, to reflect the data contained within the specified view. By default
+             * the data is copied into a string and converted as per fromString(dataString, document).
+             *
+             * @param data std::string_view over the representation to convert
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws ParseException if there is a problem performing the conversion
+             */
+            virtual void fromData(std::string_view data, DomDocument *document) {
+                fromString(std::string(data), document);
+            }
+
+            /**
+             * Generate a tree of DomNodes to reflect the contents of the file. The file is memory mapped and converted via
+             * fromData(data), such that its contents are never copied into an intermediate buffer.
+             *
+             * @param &path const std::string path to the file containing the representation to convert
+             * @return DomNode the root of the converted DOM tree
+             * @throws std::system_error if the file cannot be read
+             * @throws ParseException if there is a problem performing the conversion
+             */
+            DomNode fromFile(const std::string &path);
+
+            /**
+             * Generate a tree of DomNodes within the document, to reflect the contents of the file. The file is memory mapped and
+             * converted via fromData(data, document).
+             *
+             * @param &path const std::string path to the file containing the representation to convert
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws std::system_error if the file cannot be read
+             * @throws ParseException if there is a problem performing the conversion
+             */
+            void fromFile(const std::string &path, DomDocument *document);
+
+            /**
+             * Write the representation of the specified node (including any nested and child nodes) to the file, replacing any
+             * existing contents. The representation is written via write(node, sink) through a buffer directly to the file, without
+             * first being converted to a string.
+             *
+             * @param &node const DomNode to convert
+             * @param &path const std::string path to the file to write
+             * @throws std::system_error if the file cannot be written
+             */
+            void toFile(const DomNode &node, const std::string &path);
     };
 }
 
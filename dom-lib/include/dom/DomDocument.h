@@ -0,0 +1,68 @@
+#ifndef DOM_DOMDOCUMENT_H_
+#define DOM_DOMDOCUMENT_H_
+
+#include "dom/DomNode.h"
+
+#include <memory_resource>
+
+namespace cadf::dom {
+
+    /**
+     * A DOM tree whose nodes are all allocated from a single arena owned by the document. Building the tree only ever grows the arena,
+     * and all of the memory is released in one shot when the document is cleared or destroyed, rather than node by node.
+     *
+     * Nodes copied out of the document are allocated from the default memory resource and are independent of it. Nodes moved out of
+     * the document however still refer to its arena, and as such must not outlive it.
+     */
+    class DomDocument {
+        public:
+            /**
+             * CTOR
+             *
+             * @param initialSize size_t the size of the first block of the arena (defaults to 4k), subsequent blocks grow geometrically
+             */
+            DomDocument(size_t initialSize = 4096);
+
+            /**
+             * DTOR
+             */
+            virtual ~DomDocument() = default;
+
+            DomDocument(const DomDocument&) = delete;
+            DomDocument& operator=(const DomDocument&) = delete;
+
+            /**
+             * Get the root of the tree.
+             *
+             * @return DomNode& the root node
+             */
+            DomNode& getRoot();
+
+            /**
+             * Get the root of the tree.
+             *
+             * @return const DomNode& the root node
+             */
+            const DomNode& getRoot() const;
+
+            /**
+             * Get the allocator for the arena, to allow for nodes to be created in it prior to being added to the tree.
+             *
+             * @return DomNode::allocator_type allocating from the document's arena
+             */
+            DomNode::allocator_type getAllocator();
+
+            /**
+             * Reset the tree to a null root, releasing all of the memory allocated for it.
+             */
+            void clear();
+
+        private:
+            /** The arena from which all nodes are allocated */
+            std::pmr::monotonic_buffer_resource m_arena;
+            /** The root of the tree */
+            DomNode m_root;
+    };
+}
+
+#endif /* DOM_DOMDOCUMENT_H_ */
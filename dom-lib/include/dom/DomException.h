@@ -20,6 +20,21 @@ namespace cadf::dom {
             ParseException(const std::string &expected, int index) : std::runtime_error("Error parsing: '" + expected + "' expected at " + std::to_string(index)) {
             }
     };
+
+    /**
+     * Exception to be used when a patch cannot be applied to a DomNode tree
+     */
+    struct PatchException: public std::runtime_error {
+
+            /**
+             * CTOR
+             *
+             * @param &reason const std::string why the patch could not be applied
+             * @param &path const std::string JSON Pointer of the operation which could not be applied
+             */
+            PatchException(const std::string &reason, const std::string &path) : std::runtime_error("Error patching '" + path + "': " + reason) {
+            }
+    };
 }
 
 #endif /* DOM_DOMEXCEPTION_H_ */
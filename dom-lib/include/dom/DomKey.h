@@ -0,0 +1,258 @@
+#ifndef DOM_DOMKEY_H_
+#define DOM_DOMKEY_H_
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <ostream>
+
+namespace cadf::dom {
+
+    /**
+     * Interned name of a child within a DomNode tree. The text of every key is stored exactly once, within a process wide pool,
+     * and the key itself is only a pointer to it. As such keys are cheap to copy, two keys are equal if and only if they point to
+     * the same pooled string, and the many trees which use the same names (i.e.: messages of the same type) do not each allocate
+     * their own copy of them.
+     *
+     * The pool is shared by all threads. Each thread keeps a small cache of the keys it has recently interned, so that interning a
+     * frequently used name does not require any locking. Pooled names are never released, as such the pool is bounded: names longer
+     * than MAX_POOLED_LENGTH, and any new names once the pool holds getPoolLimit() names, are not interned. Such keys instead own a
+     * reference counted copy of their text, released along with the last copy of the key, and are compared by their text. Keys
+     * taken from untrusted input (i.e.: the names within a received message) therefore cannot grow the pool without limit.
+     */
+    class DomKey {
+        public:
+            /** The length beyond which names are never pooled */
+            static const size_t MAX_POOLED_LENGTH = 128;
+
+            /**
+             * CTOR - the empty key
+             */
+            DomKey();
+
+            /**
+             * CTOR - intern the name, adding it to the pool if it is not there yet
+             *
+             * @param name std::string_view the text of the key
+             */
+            explicit DomKey(std::string_view name);
+
+            /**
+             * Copy CTOR
+             *
+             * @param &other const DomKey to copy
+             */
+            DomKey(const DomKey &other): m_name(other.m_name) {
+                retain();
+            }
+
+            /**
+             * DTOR
+             */
+            ~DomKey() {
+                release();
+            }
+
+            /**
+             * Copy assignment
+             *
+             * @param &other const DomKey to copy
+             * @return DomKey& this key
+             */
+            DomKey& operator=(const DomKey &other) {
+                other.retain();
+                release();
+                m_name = other.m_name;
+                return *this;
+            }
+
+            /**
+             * Find the key for the name, without adding it to the pool.
+             *
+             * @param name std::string_view the text of the key
+             * @return std::optional<DomKey> the key, or empty if the name cannot be the name of any child (it was never interned,
+             *         and no name was ever rejected by the pool)
+             */
+            static std::optional<DomKey> find(std::string_view name);
+
+            /**
+             * Get the number of distinct names within the pool.
+             *
+             * @return size_t the number of pooled names
+             */
+            static size_t poolSize();
+
+            /**
+             * Get the maximum number of names within the pool.
+             *
+             * @return size_t the limit
+             */
+            static size_t getPoolLimit();
+
+            /**
+             * Set the maximum number of names within the pool (65536 by default). Names which are already pooled remain pooled
+             * should the limit be lowered below the current size of the pool.
+             *
+             * @param limit size_t the maximum number of names
+             */
+            static void setPoolLimit(size_t limit);
+
+            /**
+             * Check whether the key's text is pooled.
+             *
+             * @return bool true if pooled, false if the key owns its text
+             */
+            bool isPooled() const {
+                return m_name->pooled;
+            }
+
+            /**
+             * Get the text of the key.
+             *
+             * @return const std::string& the text, which remains valid for the lifetime of the process if pooled, otherwise for as
+             *         long as the key (or a copy of it) exists
+             */
+            const std::string& str() const {
+                return m_name->text;
+            }
+
+            /**
+             * Get the characters of the key.
+             *
+             * @return const char* pointer to the text
+             */
+            const char* data() const {
+                return m_name->text.data();
+            }
+
+            /**
+             * Get the length of the key.
+             *
+             * @return size_t the number of characters in the key
+             */
+            size_t size() const {
+                return m_name->text.size();
+            }
+
+            /**
+             * Get a view of the text of the key.
+             *
+             * @return std::string_view of the text
+             */
+            operator std::string_view() const {
+                return m_name->text;
+            }
+
+            /**
+             * Keys are equal when they refer to the same pooled text, or when either is not pooled, when their text is the same.
+             *
+             * @param &other const DomKey to compare against
+             * @return bool true if the keys are the same
+             */
+            bool operator==(const DomKey &other) const {
+                return m_name == other.m_name || ((!m_name->pooled || !other.m_name->pooled) && m_name->text == other.m_name->text);
+            }
+
+            /**
+             * Keys are different when they are not equal.
+             *
+             * @param &other const DomKey to compare against
+             * @return bool true if the keys are different
+             */
+            bool operator!=(const DomKey &other) const {
+                return !operator==(other);
+            }
+
+            /**
+             * Keys are ordered by their text.
+             *
+             * @param &other const DomKey to compare against
+             * @return bool true if this key sorts before the other
+             */
+            bool operator<(const DomKey &other) const {
+                return m_name != other.m_name && m_name->text < other.m_name->text;
+            }
+
+        private:
+            /**
+             * The text of a key, either pooled or shared by the copies of the key which created it
+             */
+            struct Name {
+                    /**
+                     * CTOR
+                     *
+                     * @param text std::string_view the text
+                     * @param pooled bool whether the text is pooled
+                     */
+                    Name(std::string_view text, bool pooled): text(text), pooled(pooled), refs(1) {
+                    }
+
+                    /** The text */
+                    std::string text;
+                    /** Whether the text is pooled, in which case it is never released */
+                    bool pooled;
+                    /** The number of keys referring to the text, only counted when it is not pooled */
+                    mutable std::atomic<size_t> refs;
+            };
+
+            // The text of the key
+            const Name *m_name;
+
+            /**
+             * Add a reference to the text, should it not be pooled
+             */
+            void retain() const {
+                if (!m_name->pooled)
+                    m_name->refs.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /**
+             * Remove a reference to the text, should it not be pooled, releasing it along with the last reference
+             */
+            void release() {
+                if (!m_name->pooled && m_name->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    delete m_name;
+            }
+
+            // The pool creates the names
+            friend struct KeyPool;
+    };
+
+    /**
+     * Compare the text of the key against a string.
+     */
+    inline bool operator==(const DomKey &key, std::string_view name) {
+        return std::string_view(key) == name;
+    }
+
+    /**
+     * Compare the text of the key against a string.
+     */
+    inline bool operator==(std::string_view name, const DomKey &key) {
+        return std::string_view(key) == name;
+    }
+
+    /**
+     * Compare the text of the key against a string.
+     */
+    inline bool operator!=(const DomKey &key, std::string_view name) {
+        return std::string_view(key) != name;
+    }
+
+    /**
+     * Compare the text of the key against a string.
+     */
+    inline bool operator!=(std::string_view name, const DomKey &key) {
+        return std::string_view(key) != name;
+    }
+
+    /**
+     * Write the text of the key to the stream.
+     */
+    inline std::ostream& operator<<(std::ostream &os, const DomKey &key) {
+        return os << key.str();
+    }
+}
+
+#endif /* DOM_DOMKEY_H_ */
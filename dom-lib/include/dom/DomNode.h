@@ -1,26 +1,59 @@
 #ifndef DOM_DOMNODE_H_
 #define DOM_DOMNODE_H_
 
-#include <map>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <variant>
+#include <utility>
+#include <memory>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <memory_resource>
 #include <initializer_list>
 
+#include "dom/DomKey.h"
+
 namespace cadf::dom {
 
     /**
      * Representation of a single value in a DOM tree. The node can be either an object (where it contains nested nodes), value (where it
      * contains a single value), or array (where it contain multiple values). The node has no concept of its own name, as that information
      * is stored with the parent. Thus, by definition, the root node has no name.
+     *
+     * Integral, floating point, and boolean values are stored natively rather than as strings, so that reading them back does not require
+     * them to be parsed. They are only converted to/from text when required (i.e.: when converting to/from a textual format like JSON).
+     *
+     * A node only carries the storage required for what it contains. The children of an object are stored in a flat vector sorted by name,
+     * as such adding a child invalidates any references to the other children of the same node. All storage is allocated from the node's
+     * allocator, which is passed down to all children, allowing for a whole tree to be allocated from a single arena (see DomDocument).
+     * The names of the children are interned (see DomKey), so that trees do not allocate any storage for them.
+     * As with the std::pmr containers, the allocator is not propagated on copy (a copy uses the default memory resource) nor on assignment.
+     *
+     * The elements of an array and the children of an object are reference counted, and shared between copies of the node (copy on
+     * write), provided the copy uses the same allocator. Copying a tree is therefore constant time regardless of its size, and modifying
+     * a copy only duplicates the containers along the path to the modification, the rest of the tree remaining shared. Copying into a
+     * different allocator (i.e.: out of a DomDocument) copies the whole tree, so that the copy remains independent of the original's
+     * storage. Copies may be handed to other threads, provided that each thread only modifies its own copy. Once a non-const accessor
+     * (i.e.: operator[]) has handed out a reference to a child or element, the node's container is no longer shared, such that copies
+     * made afterwards copy it rather than share it, and modifying the node via the reference cannot affect them.
      */
     class DomNode {
 
         public:
+            /** The allocator from which the node and its children allocate their storage */
+            typedef std::pmr::polymorphic_allocator<DomNode> allocator_type;
+            /** A named child of the node */
+            typedef std::pair<DomKey, DomNode> Child;
             /** Helper when iterating through the children of this node */
-            typedef typename std::map<std::string, DomNode>::const_iterator ChildIterator;
+            typedef typename std::pmr::vector<Child>::const_iterator ChildIterator;
             /** Helper when iterating through the values of this node's value array */
-            typedef typename std::vector<DomNode>::const_iterator ArrayIterator;
+            typedef typename std::pmr::vector<DomNode>::const_iterator ArrayIterator;
+
+            /** The maximum number of characters required to format a numeric or boolean value */
+            static const size_t MAX_FORMATTED_SIZE = 32;
 
             /**
              * CTOR - initializing without any value (null node)
@@ -28,16 +61,71 @@ namespace cadf::dom {
             DomNode();
 
             /**
-             * CTOR - initializing with a string convertible value
+             * CTOR - initializing without any value (null node), using the specified allocator
+             *
+             * @param &alloc const std::pmr::polymorphic_allocator<U> from which to allocate the node's storage
+             * @template U the type of the allocator (any polymorphic_allocator is converted to allocator_type)
+             */
+            template<typename U>
+            explicit DomNode(const std::pmr::polymorphic_allocator<U> &alloc): m_allocator(alloc), m_type(NONE) {
+            }
+
+            /**
+             * Copy CTOR - the copy uses the default memory resource
+             *
+             * @param &other const DomNode to copy
+             */
+            DomNode(const DomNode &other);
+
+            /**
+             * Copy CTOR - the copy uses the specified allocator
+             *
+             * @param &other const DomNode to copy
+             * @param &alloc const allocator_type from which to allocate the copy
+             */
+            DomNode(const DomNode &other, const allocator_type &alloc);
+
+            /**
+             * Move CTOR - the storage (and allocator) of the other node is taken over
+             *
+             * @param &&other DomNode to move
+             */
+            DomNode(DomNode &&other) noexcept;
+
+            /**
+             * Move CTOR - the storage is taken over if the allocators are equal, otherwise it is copied
+             *
+             * @param &&other DomNode to move
+             * @param &alloc const allocator_type from which to allocate the node
+             */
+            DomNode(DomNode &&other, const allocator_type &alloc);
+
+            /**
+             * CTOR - initializing with a value. Integral and floating point values are stored natively, anything else must be string
+             * convertible (via operator<<). As when parsing, unsigned values too large to be stored as a signed 64 bit integer are
+             * stored as doubles (rather than wrapping around to negative values).
              *
              * @param val T the value to store in the node
-             * @template T the type of value that is being stored
+             * @template T the type of value that is being stored (std::allocator_arg_t is excluded, to prevent it from appearing to
+             *           be a leading allocator argument when the node is constructed within a container)
              */
-            template<typename T>
+            template<typename T, typename = std::enable_if_t<!std::is_same_v<T, std::allocator_arg_t>>>
             DomNode(T val): m_type(BASIC_VALUE) {
-                std::stringstream ss;
-                ss << val;
-                m_value = ss.str();
+                if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T> && sizeof(T) >= sizeof(int64_t)) {
+                    if (val > uint64_t(std::numeric_limits<int64_t>::max()))
+                        m_value = double(val);
+                    else
+                        m_value = int64_t(val);
+                } else if constexpr (std::is_integral_v<T>) {
+                    m_value = int64_t(val);
+                } else if constexpr (std::is_floating_point_v<T>) {
+                    m_value = double(val);
+                } else {
+                    std::stringstream ss;
+                    ss << val;
+                    std::string str = ss.str();
+                    m_value.template emplace<String>(str.data(), str.size(), m_allocator);
+                }
             }
 
             /**
@@ -47,9 +135,24 @@ namespace cadf::dom {
              * @param vals std::vector containing the elements
              */
             template<typename T>
-            DomNode(const std::vector<T> &vals): m_type(ARRAY), m_value("") {
-                for(T v: vals)
-                    m_arrayElements.push_back(v);
+            DomNode(const std::vector<T> &vals): m_type(ARRAY) {
+                Array &elements = initArray(vals.size());
+                for (const T &v : vals)
+                    elements.emplace_back(DomNode(v));
+            }
+
+            /**
+             * CTOR - initializing with an array of elements taken from the specified vector. Elements are moved out of the vector
+             * rather than copied, so a vector of DomNodes is taken over without copying any of the subtrees.
+             *
+             * @template T the type of values to be stored in the array
+             * @param &&vals std::vector containing the elements
+             */
+            template<typename T>
+            DomNode(std::vector<T> &&vals): m_type(ARRAY) {
+                Array &elements = initArray(vals.size());
+                for (T &v : vals)
+                    elements.emplace_back(DomNode(std::move(v)));
             }
 
             /**
@@ -59,9 +162,10 @@ namespace cadf::dom {
              * @param vals std::intializer_list of the elements
              */
             template<typename T>
-            DomNode(std::initializer_list<T> vals): m_type(ARRAY), m_value("") {
-                for(T v: vals)
-                    m_arrayElements.push_back(v);
+            DomNode(std::initializer_list<T> vals): m_type(ARRAY) {
+                Array &elements = initArray(vals.size());
+                for (const T &v : vals)
+                    elements.emplace_back(DomNode(v));
             }
 
             /**
@@ -76,8 +180,18 @@ namespace cadf::dom {
              *
              * @param &val const std::string value
              * @param treatAsString bool true (default) is the string is to be treated as a string value
+             * @param &alloc const allocator_type from which to allocate the node's storage (defaults to the default memory resource)
              */
-            DomNode(const std::string &val, bool treatAsString = true);
+            DomNode(const std::string &val, bool treatAsString = true, const allocator_type &alloc = allocator_type());
+
+            /**
+             * CTOR - taking over an already allocated string. The node uses the allocator of the string, so that the string's
+             * storage can be taken over rather than copied.
+             *
+             * @param &&val std::pmr::string value
+             * @param treatAsString bool true (default) is the string is to be treated as a string value
+             */
+            DomNode(std::pmr::string &&val, bool treatAsString = true);
 
             /**
              * CTOR - initializing with a boolean
@@ -100,6 +214,68 @@ namespace cadf::dom {
              */
             virtual ~DomNode() = default;
 
+            /**
+             * Copy assignment - the node retains its own allocator, copying the other node's content into it
+             *
+             * @param &other const DomNode to copy
+             * @return DomNode& this node
+             */
+            DomNode& operator=(const DomNode &other);
+
+            /**
+             * Move assignment - the node retains its own allocator, taking over the other node's storage if they share the allocator,
+             * otherwise copying it
+             *
+             * @param &&other DomNode to move
+             * @return DomNode& this node
+             */
+            DomNode& operator=(DomNode &&other);
+
+            /**
+             * Compare the content of the nodes (including any nested and child nodes). Values must be of the same type to be equal,
+             * and all null nodes are equal. The allocators of the nodes are not considered.
+             *
+             * @param &other const DomNode to compare against
+             * @return bool true if the nodes contain the same tree
+             */
+            bool operator==(const DomNode &other) const;
+
+            /**
+             * Compare the content of the nodes (including any nested and child nodes).
+             *
+             * @param &other const DomNode to compare against
+             * @return bool true if the nodes contain different trees
+             */
+            bool operator!=(const DomNode &other) const;
+
+            /**
+             * Create an empty array node.
+             *
+             * @param &alloc const allocator_type from which to allocate the node's storage (defaults to the default memory resource)
+             * @return DomNode containing an empty array
+             */
+            static DomNode makeArray(const allocator_type &alloc = allocator_type());
+
+            /**
+             * Create a node from the textual representation of a non-string value (i.e.: a value as it appears within JSON). null
+             * produces a null node, true/false a boolean, and numbers are stored as integers where possible, otherwise as doubles.
+             * Anything else is stored as is.
+             *
+             * @param literal std::string_view the textual representation of the value
+             * @param &alloc const allocator_type from which to allocate the node's storage (defaults to the default memory resource)
+             * @return DomNode containing the value
+             */
+            static DomNode fromLiteral(std::string_view literal, const allocator_type &alloc = allocator_type());
+
+            /**
+             * Get the allocator from which the node allocates its storage
+             *
+             * @return allocator_type of the node
+             */
+            allocator_type getAllocator() const {
+                return m_allocator;
+            }
+
             /**
              * Access the child node with the given name. Children are dynamically added when they are access for the first time
              *
@@ -128,6 +304,162 @@ namespace cadf::dom {
              */
             const DomNode& operator[](const char *name) const;
 
+            /**
+             * Access the child node with the given interned name. Children are dynamically added when they are access for the first time
+             *
+             * @param &key const DomKey of the desired child node.
+             */
+            DomNode& operator[](const DomKey &key);
+
+            /**
+             * Access the child node with the given interned name.
+             *
+             * @throws std::out_of_range if there is no such child
+             * @param &key const DomKey of the desired child node.
+             */
+            const DomNode& operator[](const DomKey &key) const;
+
+            /**
+             * Check whether the node has a child with the given name.
+             *
+             * @param name std::string_view the name of the child
+             * @return bool true if there is such a child
+             */
+            bool hasChild(std::string_view name) const;
+
+            /**
+             * Find the child with the given name, without throwing should there be no such child.
+             *
+             * @param name std::string_view the name of the child
+             * @return const DomNode* the child, or nullptr if there is no such child
+             */
+            const DomNode* findChild(std::string_view name) const;
+
+            /**
+             * Find the child with the given interned name, without throwing should there be no such child.
+             *
+             * @param &key const DomKey the name of the child
+             * @return const DomNode* the child, or nullptr if there is no such child
+             */
+            const DomNode* findChild(const DomKey &key) const;
+
+            /**
+             * Find the child with the given name for modification, without throwing should there be no such child. Should the
+             * children be shared with a copy of the node, they are copied first.
+             *
+             * @param name std::string_view the name of the child
+             * @return DomNode* the child, or nullptr if there is no such child
+             */
+            DomNode* findChild(std::string_view name);
+
+            /**
+             * Find the child with the given interned name for modification, without throwing should there be no such child. Should
+             * the children be shared with a copy of the node, they are copied first.
+             *
+             * @param &key const DomKey the name of the child
+             * @return DomNode* the child, or nullptr if there is no such child
+             */
+            DomNode* findChild(const DomKey &key);
+
+            /**
+             * Find the element at the given index of the node's value array, without throwing should there be no such element.
+             *
+             * @param index size_t the index of the element
+             * @return const DomNode* the element, or nullptr if the node is not an array or the index is out of bounds
+             */
+            const DomNode* findArrayElement(size_t index) const;
+
+            /**
+             * Find the element at the given index of the node's value array for modification, without throwing should there be no such
+             * element. Should the elements be shared with a copy of the node, they are copied first.
+             *
+             * @param index size_t the index of the element
+             * @return DomNode* the element, or nullptr if the node is not an array or the index is out of bounds
+             */
+            DomNode* findArrayElement(size_t index);
+
+            /**
+             * Add a child to the end of the children, without looking for an existing child of the same name nor maintaining the sorted
+             * order. This allows for a large number of children to be added in linear time, but sortChildren() must be called once all
+             * have been added, before the node is accessed in any other way. If the node is not an object, it is converted into one.
+             *
+             * @param &name const std::string the name of the child
+             * @param &&value DomNode to move into the child
+             */
+            void appendChild(const std::string &name, DomNode &&value);
+
+            /**
+             * Add a child with an already interned name to the end of the children. As with appendChild(const std::string&,
+             * DomNode&&), sortChildren() must be called once all children have been added.
+             *
+             * @param &key const DomKey the name of the child
+             * @param &&value DomNode to move into the child
+             */
+            void appendChild(const DomKey &key, DomNode &&value);
+
+            /**
+             * Restore the sorted order of the children after they were added via appendChild(). Where multiple children were added with
+             * the same name, only the last one added is retained.
+             */
+            void sortChildren();
+
+            /**
+             * Remove the child with the given name.
+             *
+             * @param &key const DomKey the name of the child
+             * @return bool true if there was such a child to remove
+             */
+            bool removeChild(const DomKey &key);
+
+            /**
+             * Add an element to the end of the node's value array. If the node does not contain an array, it is converted into one.
+             *
+             * @param &value const DomNode to copy into the array
+             */
+            void addArrayElement(const DomNode &value);
+
+            /**
+             * Add an element to the end of the node's value array. If the node does not contain an array, it is converted into one.
+             *
+             * @param &&value DomNode to move into the array
+             */
+            void addArrayElement(DomNode &&value);
+
+            /**
+             * Insert an element into the node's value array, before the element currently at the index. If the node does not contain
+             * an array, it is converted into one.
+             *
+             * @throws std::out_of_range if the index is beyond the end of the array
+             * @param index size_t where to insert the element (the number of elements appends it)
+             * @param &&value DomNode to move into the array
+             */
+            void insertArrayElement(size_t index, DomNode &&value);
+
+            /**
+             * Remove an element from the node's value array.
+             *
+             * @throws std::out_of_range if the node is not an array, or there is no element at the index
+             * @param index size_t of the element to remove
+             */
+            void removeArrayElement(size_t index);
+
+            /**
+             * Get the stored string value, without copying it. Only nodes which contain a string or a literal that could not be
+             * stored natively have one, for all others it is empty.
+             *
+             * @return std::string_view of the stored string value
+             */
+            std::string_view getValue() const;
+
+            /**
+             * Format the stored value as text without allocating. Strings are not copied, the returned view refers to the stored
+             * value directly. A null node produces an empty view.
+             *
+             * @param buffer char[MAX_FORMATTED_SIZE] into which numeric and boolean values are formatted
+             * @return std::string_view of the formatted value
+             */
+            std::string_view formatValue(char (&buffer)[MAX_FORMATTED_SIZE]) const;
+
             /**
              * Get the value of the node as a string.
              *
@@ -185,10 +517,31 @@ namespace cadf::dom {
              * @return std::vector<T> containing the values within the node's array
              */
             template<typename T>
-            operator std::vector<T>() const {
+            operator std::vector<T>() const & {
                  std::vector<T> values;
-                 for (const DomNode &n : m_arrayElements)
-                     values.push_back(n);
+                 values.reserve(numArrayElements());
+                 for (ArrayIterator it = beginArray(); it != endArray(); ++it)
+                     values.push_back(*it);
+                 return values;
+            }
+
+            /**
+             * Get the values stored within the node's array as the desired type, moving them out of the node. When retrieving
+             * DomNodes the elements are taken over rather than copied (unless they are shared with a copy of the node). The array of
+             * the node is left empty.
+             *
+             * @template T the type of data to retrieve from the internal array
+             * @return std::vector<T> containing the values within the node's array
+             */
+            template<typename T>
+            operator std::vector<T>() && {
+                 std::vector<T> values;
+                 if (Array *elements = mutableArray()) {
+                     values.reserve(elements->size());
+                     for (DomNode &element : *elements)
+                         values.push_back(std::move(element));
+                     elements->clear();
+                 }
                  return values;
             }
 
@@ -213,6 +566,27 @@ namespace cadf::dom {
              */
             virtual bool isString() const;
 
+            /**
+             * Check if the node contains a natively stored integral value
+             *
+             * @return true if the node has an integer value
+             */
+            virtual bool isInteger() const;
+
+            /**
+             * Check if the node contains a natively stored floating point value
+             *
+             * @return true if the node has a double value
+             */
+            virtual bool isDouble() const;
+
+            /**
+             * Check if the node contains a natively stored boolean value
+             *
+             * @return true if the node has a boolean value
+             */
+            virtual bool isBool() const;
+
             /**
              * Check if the node has a null value. To be considered null, it must be a leaf to which no value was ever applied.
              * Note: an empty string is not a null value
@@ -229,7 +603,7 @@ namespace cadf::dom {
             size_t numChildren() const;
 
             /**
-             * Get the iterator for the beginning of the children.
+             * Get the iterator for the beginning of the children. The children are sorted by name.
              *
              * for (ChildInterator it = domNode.beginChildren(); it != domNode.endChildren(); ++it) {
              *     it->first // The name of the child
@@ -274,18 +648,82 @@ namespace cadf::dom {
 
         private:
             // Enumeration to indicate what type of value is stored within
-            enum VAL_TYPE {
-                NONE, ARRAY, STRING, BASIC_VALUE
+            enum VAL_TYPE : uint8_t {
+                NONE, ARRAY, STRING, BASIC_VALUE, OBJECT
             };
 
+            /** Storage for string values */
+            typedef std::pmr::string String;
+            /** Storage for the elements of an array */
+            typedef std::pmr::vector<DomNode> Array;
+            /** Storage for the children of an object, sorted by name */
+            typedef std::pmr::vector<Child> Object;
+
+            /** The allocator from which all storage is allocated */
+            allocator_type m_allocator;
             /** The type of value stored within the node */
             VAL_TYPE m_type;
-            /** The string representation of the value */
-            std::string m_value;
-            /** The node's children associated to their name */
-            std::map<std::string, DomNode> m_children;
-            /** The array of values */
-            std::vector<DomNode> m_arrayElements;
+            /** Whether the container may be shared with copies, false once a reference to a child or element has been handed out */
+            bool m_shareable = true;
+            /** The value itself, only one of which is ever present. Containers are shared between copies until modified */
+            std::variant<std::monostate, int64_t, double, bool, String, std::shared_ptr<Array>, std::shared_ptr<Object>> m_value;
+
+            /**
+             * Get the array storage for reading
+             *
+             * @return const Array* the storage for the array elements, or nullptr if the node is not an array
+             */
+            const Array* array() const;
+
+            /**
+             * Get the child storage for reading
+             *
+             * @return const Object* the storage for the children, or nullptr if the node is not an object
+             */
+            const Object* object() const;
+
+            /**
+             * Get the array storage for modification, copying it first if it is shared
+             *
+             * @return Array* the storage for the array elements, or nullptr if the node is not an array
+             */
+            Array* mutableArray();
+
+            /**
+             * Get the child storage for modification, copying it first if it is shared
+             *
+             * @return Object* the storage for the children, or nullptr if the node is not an object
+             */
+            Object* mutableObject();
+
+            /**
+             * Turn the node into an empty array
+             *
+             * @param reserve size_t the number of elements for which to reserve space
+             * @return Array& the storage for the array elements
+             */
+            Array& initArray(size_t reserve);
+
+            /**
+             * Get the array storage, turning the node into an array if it is not one already
+             *
+             * @return Array& the storage for the array elements
+             */
+            Array& asArray();
+
+            /**
+             * Get the child storage, turning the node into an object if it is not one already
+             *
+             * @return Object& the storage for the children
+             */
+            Object& asObject();
+
+            /**
+             * Replace the value of the node with a copy of the value of the other node, allocated from this node's allocator
+             *
+             * @param &other const DomNode whose value to copy
+             */
+            void copyValue(const DomNode &other);
     };
 
     /**
@@ -293,12 +731,12 @@ namespace cadf::dom {
      *
      * @template T the type of value to assign to the subnode
      * @param &valueName const std::string the name of the value
-     * @param &value T const the actual value
+     * @param &&value T the actual value (moved into the node when provided as an rvalue)
      */
     template<typename T>
-    DomNode buildNode(const std::string &valueName, const T &value) {
+    DomNode buildNode(const std::string &valueName, T &&value) {
         DomNode node;
-        node[valueName] = value;
+        node[valueName] = std::forward<T>(value);
         return node;
     }
 
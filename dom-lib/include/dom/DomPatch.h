@@ -0,0 +1,84 @@
+#ifndef DOM_DOMPATCH_H_
+#define DOM_DOMPATCH_H_
+
+#include "dom/DomNode.h"
+
+#include <string>
+
+namespace cadf::dom {
+
+    /**
+     * Structural differences between DomNode trees, expressed as a JSON Patch (RFC 6902). The patch is itself a DomNode (an array of
+     * operations), such that it can be converted and transferred like any other tree:
+     *
+     * [ { "op": "replace", "path": "/a/b", "value": 2 }, { "op": "remove", "path": "/c/1" }, { "op": "add", "path": "/d", "value": {} } ]
+     *
+     * Only the "add", "remove", "replace", and "test" operations are supported. The operations of a patch produced by diff() are always
+     * ordered such that they can be applied one after the other.
+     */
+    class DomPatch {
+        public:
+            /**
+             * Determine the operations required to turn one tree into the other. Objects are compared child by child, and arrays element
+             * by element once any common leading and trailing elements are skipped, so that the patch only contains the parts of the tree
+             * which actually changed.
+             *
+             * @param &from const DomNode root of the original tree
+             * @param &to const DomNode root of the changed tree
+             * @return DomNode array of the operations (empty if the trees are equal)
+             */
+            static DomNode diff(const DomNode &from, const DomNode &to);
+
+            /**
+             * Apply the operations of the patch to the tree, one after the other. Should an operation fail, the operations preceding it
+             * remain applied.
+             *
+             * @throws PatchException if the patch is malformed or one of its operations cannot be applied to the tree
+             * @param &root DomNode root of the tree to patch
+             * @param &patch const DomNode array of the operations to apply
+             */
+            static void apply(DomNode &root, const DomNode &patch);
+
+        private:
+            /**
+             * Add the operations turning the (sub)tree into the other to the patch.
+             *
+             * @param &from const DomNode the original (sub)tree
+             * @param &to const DomNode the changed (sub)tree
+             * @param &path std::string JSON Pointer to the (sub)tree, restored to its original value on return
+             * @param &patch DomNode to which the operations are added
+             */
+            static void diffNode(const DomNode &from, const DomNode &to, std::string &path, DomNode &patch);
+
+            /**
+             * Add the operations turning the array into the other to the patch.
+             *
+             * @param &from const DomNode the original array
+             * @param &to const DomNode the changed array
+             * @param &path std::string JSON Pointer to the array, restored to its original value on return
+             * @param &patch DomNode to which the operations are added
+             */
+            static void diffArray(const DomNode &from, const DomNode &to, std::string &path, DomNode &patch);
+
+            /**
+             * Add the operations turning the object into the other to the patch.
+             *
+             * @param &from const DomNode the original object
+             * @param &to const DomNode the changed object
+             * @param &path std::string JSON Pointer to the object, restored to its original value on return
+             * @param &patch DomNode to which the operations are added
+             */
+            static void diffObject(const DomNode &from, const DomNode &to, std::string &path, DomNode &patch);
+
+            /**
+             * Apply a single operation to the tree.
+             *
+             * @throws PatchException if the operation is malformed or cannot be applied
+             * @param &root DomNode root of the tree to patch
+             * @param &operation const DomNode the operation to apply
+             */
+            static void applyOperation(DomNode &root, const DomNode &operation);
+    };
+}
+
+#endif /* DOM_DOMPATCH_H_ */
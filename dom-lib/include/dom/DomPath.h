@@ -0,0 +1,141 @@
+#ifndef DOM_DOMPATH_H_
+#define DOM_DOMPATH_H_
+
+#include "dom/DomNode.h"
+#include "dom/DomKey.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cadf::dom {
+
+    /**
+     * Precompiled path to a node within a DomNode tree, expressed as a JSON Pointer (RFC 6901), such as "/a/b/3/c". The pointer is
+     * parsed and its names interned once, when the path is created, such that resolving it against any number of trees only performs
+     * a key lookup (or array index) per step. Resolving never throws, a path which does not exist within the tree simply produces no
+     * result.
+     *
+     * Each step selects the child of that name for an object, or the element at that index for an array (where the step is a valid
+     * array index), so that the same path can be resolved against trees of the same shape.
+     */
+    class DomPath {
+        public:
+            /**
+             * A single step along the path
+             */
+            struct Step {
+                /** The name of the child to select */
+                DomKey key;
+                /** Whether the step can also select an array element */
+                bool isIndex;
+                /** The index of the array element to select */
+                size_t index;
+            };
+
+            /**
+             * CTOR - compile the JSON Pointer
+             *
+             * @throws ParseException if the pointer is not valid (it must either be empty, or start with "/", and "~" must only appear
+             *         as part of the "~0" and "~1" escapes)
+             * @param pointer std::string_view the JSON Pointer to the node (the empty pointer refers to the root itself)
+             */
+            DomPath(std::string_view pointer);
+
+            /**
+             * Find the node at the path within the tree.
+             *
+             * @param &root const DomNode root of the tree
+             * @return const DomNode* the node, or nullptr if the path does not exist within the tree
+             */
+            const DomNode* resolve(const DomNode &root) const;
+
+            /**
+             * Find the node at the path within the tree, for the purpose of modifying it. Any containers along the path which are
+             * shared with a copy of the tree are copied first, so that modifying the node does not affect the copy.
+             *
+             * @param &root DomNode root of the tree
+             * @return DomNode* the node, or nullptr if the path does not exist within the tree
+             */
+            DomNode* resolve(DomNode &root) const;
+
+            /**
+             * Find the node at the path within the tree, and retrieve its value.
+             *
+             * @template T the type of value to retrieve
+             * @param &root const DomNode root of the tree
+             * @return std::optional<T> containing the value, or empty if the path does not exist within the tree
+             */
+            template<typename T>
+            std::optional<T> find(const DomNode &root) const {
+                const DomNode *node = resolve(root);
+                if (node == nullptr)
+                    return std::nullopt;
+                return static_cast<T>(*node);
+            }
+
+            /**
+             * Get the node at the path within the tree.
+             *
+             * @throws std::out_of_range if the path does not exist within the tree
+             * @param &root const DomNode root of the tree
+             * @return const DomNode& the node
+             */
+            const DomNode& get(const DomNode &root) const;
+
+            /**
+             * Get the number of steps in the path.
+             *
+             * @return size_t the number of steps (0 for the root itself)
+             */
+            size_t size() const;
+
+            /**
+             * Get a step of the path.
+             *
+             * @param index size_t of the step (must be less than size())
+             * @return const Step& the step
+             */
+            const Step& operator[](size_t index) const;
+
+            /**
+             * Get the path to the parent of the node at this path.
+             *
+             * @return DomPath with the last step removed (the path to the root remains the path to the root)
+             */
+            DomPath parent() const;
+
+            /**
+             * Escape a name for use as a step of a JSON Pointer ("~" becoming "~0" and "/" becoming "~1").
+             *
+             * @param name std::string_view the name to escape
+             * @return std::string the escaped name
+             */
+            static std::string escape(std::string_view name);
+
+            /**
+             * Get the JSON Pointer from which the path was compiled.
+             *
+             * @return const std::string& the JSON Pointer
+             */
+            const std::string& toString() const;
+
+        private:
+            // The JSON Pointer from which the path was compiled
+            std::string m_pointer;
+            // The steps to follow
+            std::vector<Step> m_steps;
+
+            /**
+             * Compile a single (still escaped) step of the pointer.
+             *
+             * @throws ParseException if an escape sequence is invalid
+             * @param token std::string_view the text of the step
+             * @param offset size_t where within the pointer the step starts, for the purpose of error reporting
+             */
+            void addStep(std::string_view token, size_t offset);
+    };
+}
+
+#endif /* DOM_DOMPATH_H_ */
@@ -0,0 +1,54 @@
+#ifndef DOM_MAPPEDFILE_H_
+#define DOM_MAPPEDFILE_H_
+
+#include <string>
+#include <string_view>
+
+namespace cadf::dom {
+
+    /**
+     * Read only memory mapping of the full contents of a file. The contents are paged in by the kernel as they are accessed, rather
+     * than being copied into a buffer up front, and the kernel is advised that the contents will be read sequentially so that it can
+     * read ahead aggressively and drop pages once they have been read. The mapping is released when the MappedFile is destroyed.
+     */
+    class MappedFile {
+        public:
+            /**
+             * CTOR - maps the file
+             *
+             * @throws std::system_error if the file cannot be opened or mapped
+             * @param &path const std::string path to the file to map
+             */
+            MappedFile(const std::string &path);
+
+            /**
+             * DTOR - unmaps the file
+             */
+            virtual ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            /**
+             * Get the contents of the file.
+             *
+             * @return std::string_view over the mapped contents, only valid for as long as the MappedFile exists
+             */
+            std::string_view data() const;
+
+            /**
+             * Get the size of the file.
+             *
+             * @return size_t the number of bytes in the file
+             */
+            size_t size() const;
+
+        private:
+            // Start of the mapping (nullptr if the file is empty)
+            void *m_data;
+            // The size of the mapping
+            size_t m_size;
+    };
+}
+
+#endif /* DOM_MAPPEDFILE_H_ */
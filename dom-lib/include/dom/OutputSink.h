@@ -0,0 +1,122 @@
+#ifndef DOM_OUTPUTSINK_H_
+#define DOM_OUTPUTSINK_H_
+
+#include <string>
+#include <vector>
+
+namespace cadf::dom {
+
+    /**
+     * Destination into which a DomConverter can write the representation of a DomNode tree, without first having to
+     * build it up as a string.
+     */
+    class OutputSink {
+        public:
+            /**
+             * DTOR
+             */
+            virtual ~OutputSink() = default;
+
+            /**
+             * Prepare the sink for the total amount of data that is about to be written. By default this does nothing.
+             *
+             * @param size size_t the number of bytes that will be written
+             */
+            virtual void reserve(size_t /*size*/) {
+            }
+
+            /**
+             * Write data into the sink, after any previously written data.
+             *
+             * @param *data const char pointer to the data to write
+             * @param size size_t the number of bytes to write
+             */
+            virtual void write(const char *data, size_t size) = 0;
+    };
+
+    /**
+     * Sink which appends the data to a string.
+     */
+    class StringSink: public OutputSink {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *str std::string to which the data is to be appended
+             */
+            StringSink(std::string *str);
+
+            /**
+             * Reserve the space in the string.
+             *
+             * @param size size_t the number of bytes that will be written
+             */
+            void reserve(size_t size);
+
+            /**
+             * Append the data to the string.
+             *
+             * @param *data const char pointer to the data to write
+             * @param size size_t the number of bytes to write
+             */
+            void write(const char *data, size_t size);
+
+        private:
+            // Where the data is written to
+            std::string *m_str;
+    };
+
+    /**
+     * Sink which writes the data to a file descriptor. The data is buffered, and only written out to the file descriptor
+     * when the buffer fills up, when flush() is called, or when the sink is destroyed.
+     */
+    class FileDescriptorSink: public OutputSink {
+        public:
+            /**
+             * CTOR
+             *
+             * @param fd int the file descriptor to write to (ownership is not taken, it is not closed)
+             * @param bufferSize size_t how much data to buffer prior to writing it out (defaults to 64k)
+             */
+            FileDescriptorSink(int fd, size_t bufferSize = 64 * 1024);
+
+            /**
+             * DTOR - flushes any buffered data
+             */
+            virtual ~FileDescriptorSink();
+
+            /**
+             * Write the data, via the buffer.
+             *
+             * @throws std::system_error if writing to the file descriptor fails
+             * @param *data const char pointer to the data to write
+             * @param size size_t the number of bytes to write
+             */
+            void write(const char *data, size_t size);
+
+            /**
+             * Write out any buffered data.
+             *
+             * @throws std::system_error if writing to the file descriptor fails
+             */
+            void flush();
+
+        private:
+            // The file descriptor to write to
+            int m_fd;
+            // The buffered data
+            std::vector<char> m_buffer;
+            // How much data is currently buffered
+            size_t m_buffered;
+
+            /**
+             * Write the data directly to the file descriptor.
+             *
+             * @param *data const char pointer to the data to write
+             * @param size size_t the number of bytes to write
+             */
+            void writeOut(const char *data, size_t size);
+    };
+}
+
+#endif /* DOM_OUTPUTSINK_H_ */
@@ -0,0 +1,107 @@
+#ifndef DOM_CBORCONVERTER_H_
+#define DOM_CBORCONVERTER_H_
+
+#include "dom/DomNode.h"
+#include "dom/DomConverter.h"
+
+namespace cadf::dom::cbor {
+
+    /**
+     * DomConverter for CBOR (RFC 8949), a compact binary representation of the same data model as JSON. Integers, floating point
+     * values and booleans are written in their native binary form, and strings are written without any escaping, so that neither
+     * the conversion to nor from CBOR requires any text formatting or parsing.
+     *
+     * Objects are written as maps with text keys (in sorted order), arrays as arrays, and strings as text strings. Doubles are
+     * written in single precision where this does not lose any precision. The "string" representation of the tree is binary, and
+     * can contain null characters.
+     */
+    class CborConverter: public DomConverter {
+
+        public:
+
+            static CborConverter* instance();
+
+            /**
+             * Determine the number of bytes the CBOR representation of the DomNode tree will require
+             *
+             * @param &root const DomNode root of the tree to calculate
+             * @return size_t the number of bytes in the generated CBOR
+             */
+            virtual size_t size(const DomNode &root);
+
+            /**
+             * Convert the DomNode tree to its CBOR representation
+             *
+             * @param &root const DomNode root of the tree
+             * @return std::string containing the CBOR representation
+             */
+            virtual std::string toString(const DomNode &root);
+
+            /**
+             * Write the CBOR representation of the DomNode tree directly into the sink.
+             *
+             * @param &root const DomNode root of the tree
+             * @param *sink OutputSink where the CBOR is to be written
+             */
+            virtual void write(const DomNode &root, OutputSink *sink);
+
+            /**
+             * Generate a DomNode tree based on the specified CBOR. Any data following the first data item is ignored.
+             *
+             * @param &cborString const std::string containing the CBOR representation
+             * @return DomNode root of the created DomNode tree
+             * @throws ParseException if there is a problem with the provided CBOR representation
+             */
+            virtual DomNode fromString(const std::string &cborString);
+
+            /**
+             * Generate a DomNode tree within the document based on the specified CBOR. All nodes are allocated directly
+             * from the document's arena.
+             *
+             * @param &cborString const std::string containing the CBOR representation
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws ParseException if there is a problem with the provided CBOR representation
+             */
+            virtual void fromString(const std::string &cborString, DomDocument *document);
+
+            /**
+             * Generate a DomNode tree based on the CBOR within the view, parsing it in place.
+             *
+             * @param data std::string_view over the CBOR representation
+             * @return DomNode root of the created DomNode tree
+             * @throws ParseException if there is a problem with the provided CBOR representation
+             */
+            virtual DomNode fromData(std::string_view data);
+
+            /**
+             * Generate a DomNode tree within the document based on the CBOR within the view, parsing it in place. All nodes are
+             * allocated directly from the document's arena.
+             *
+             * @param data std::string_view over the CBOR representation
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws ParseException if there is a problem with the provided CBOR representation
+             */
+            virtual void fromData(std::string_view data, DomDocument *document);
+
+        private:
+            /**
+             * CTOR
+             */
+            CborConverter() = default;
+
+            /**
+             * DTOR
+             */
+            virtual ~CborConverter() = default;
+
+            /**
+             * Write the CBOR representation of the (sub)tree into the sink.
+             *
+             * @param &node const DomNode root of the (sub)tree
+             * @param *sink OutputSink where the CBOR is to be written
+             */
+            void writeNode(const DomNode &node, OutputSink *sink);
+    };
+}
+
+#endif /* DOM_CBORCONVERTER_H_ */
@@ -0,0 +1,106 @@
+#ifndef DOM_CBORPARSER_H_
+#define DOM_CBORPARSER_H_
+
+#include "dom/DomNode.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace cadf::dom::cbor {
+
+    /**
+     * Decodes a single CBOR data item into a DomNode tree. Definite and indefinite length items are supported, tags are skipped
+     * (only the tagged item is retained), and byte strings are treated the same as text strings. The keys of maps must be text
+     * strings.
+     */
+    class CborParser {
+        public:
+            /**
+             * CTOR
+             *
+             * @param data std::string_view containing the CBOR to decode
+             * @param &alloc const DomNode::allocator_type from which to allocate the tree (defaults to the default memory resource)
+             */
+            CborParser(std::string_view data, const DomNode::allocator_type &alloc = DomNode::allocator_type());
+
+            /**
+             * Decode the first data item
+             *
+             * @throws ParseException if the data is not valid CBOR
+             * @return DomNode at the root of the decoded tree
+             */
+            DomNode parse();
+
+        private:
+            // The data to decode
+            std::string_view m_data;
+            // The position of the next byte to decode
+            size_t m_currIndex;
+            // The allocator from which the tree is allocated
+            DomNode::allocator_type m_allocator;
+
+            /**
+             * Decode the next data item.
+             *
+             * @return DomNode containing the data item
+             */
+            DomNode loadItem();
+
+            /**
+             * Decode a text (or byte) string, the initial byte of which was already consumed.
+             *
+             * @param initial uint8_t the initial byte of the string
+             * @return std::pmr::string the content of the string
+             */
+            std::pmr::string loadString(uint8_t initial);
+
+            /**
+             * Decode a text string key, the initial byte of which was already consumed. Definite length keys are interned directly
+             * from the data.
+             *
+             * @param initial uint8_t the initial byte of the key
+             * @return DomKey the interned key
+             */
+            DomKey loadKey(uint8_t initial);
+
+            /**
+             * Decode the argument (length or value) which follows the initial byte.
+             *
+             * @param initial uint8_t the initial byte of the data item
+             * @return uint64_t the argument
+             */
+            uint64_t loadArgument(uint8_t initial);
+
+            /**
+             * Check whether the indefinite length item has been terminated, consuming the terminator if so.
+             *
+             * @return bool true if the break code was reached
+             */
+            bool checkBreak();
+
+            /**
+             * Read the next bytes as a big-endian unsigned integer.
+             *
+             * @param size size_t the number of bytes to read
+             * @return uint64_t the value read
+             */
+            uint64_t loadBigEndian(size_t size);
+
+            /**
+             * Get the next byte and advance.
+             *
+             * @return uint8_t the next byte
+             */
+            uint8_t nextByte();
+
+            /**
+             * Make sure that the specified number of bytes remain.
+             *
+             * @throws ParseException if there are fewer bytes remaining
+             * @param size uint64_t the number of bytes required
+             */
+            void require(uint64_t size);
+    };
+}
+
+#endif /* DOM_CBORPARSER_H_ */
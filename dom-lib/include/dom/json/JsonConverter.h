@@ -3,6 +3,7 @@
 
 #include "dom/DomNode.h"
 #include "dom/DomConverter.h"
+#include "dom/json/JsonParser.h"
 
 namespace cadf::dom::json {
 
@@ -31,6 +32,15 @@ namespace cadf::dom::json {
              */
             virtual std::string toString(const DomNode &root);
 
+            /**
+             * Write the JSON representation of the DomNode tree directly into the sink, appending it in place.
+             * Should the sink need to be prepared, size() provides the exact size of the output.
+             *
+             * @param &root const DomNode root of the tree
+             * @param *sink OutputSink where the JSON is to be written
+             */
+            virtual void write(const DomNode &root, OutputSink *sink);
+
             /**
              * Generate a DomNode tree based on the specified JSON string
              *
@@ -40,7 +50,74 @@ namespace cadf::dom::json {
              */
             virtual DomNode fromString(const std::string &jsonString);
 
+            /**
+             * Generate a DomNode tree within the document based on the specified JSON string. All nodes are allocated directly
+             * from the document's arena.
+             *
+             * @param &jsonString const std::string containing the JSON representation
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws ParseException if there is a problem with the provided JSON representation
+             */
+            virtual void fromString(const std::string &jsonString, DomDocument *document);
+
+            /**
+             * Generate a DomNode tree based on the JSON within the view, parsing it in place.
+             *
+             * @param data std::string_view over the JSON representation
+             * @return DomNode root of the created DomNode tree
+             * @throws ParseException if there is a problem with the provided JSON representation
+             */
+            virtual DomNode fromData(std::string_view data);
+
+            /**
+             * Generate a DomNode tree within the document based on the JSON within the view, parsing it in place. All nodes are
+             * allocated directly from the document's arena.
+             *
+             * @param data std::string_view over the JSON representation
+             * @param *document DomDocument into which the tree is to be placed
+             * @throws ParseException if there is a problem with the provided JSON representation
+             */
+            virtual void fromData(std::string_view data, DomDocument *document);
+
+            /**
+             * Set how the JSON is to be parsed by fromString.
+             *
+             * @param mode JsonParser::Mode to employ (INDEXED by default)
+             */
+            void setParseMode(JsonParser::Mode mode) {
+                m_parseMode = mode;
+            }
+
+            /**
+             * Get how the JSON is parsed by fromString.
+             *
+             * @return JsonParser::Mode that is employed
+             */
+            JsonParser::Mode getParseMode() const {
+                return m_parseMode;
+            }
+
+            /**
+             * Determine the number of characters the string requires once quoted and escaped as a JSON string.
+             *
+             * @param str std::string_view the string
+             * @return size_t the number of characters written by writeQuoted()
+             */
+            static size_t quotedSize(std::string_view str);
+
+            /**
+             * Write the string as a JSON string, surrounded by quotes and escaping any characters which cannot appear within it as is.
+             * This is the escaping employed for all JSON output, including that which is written without a DOM.
+             *
+             * @param str std::string_view the string
+             * @param *sink OutputSink where the string is to be written
+             */
+            static void writeQuoted(std::string_view str, OutputSink *sink);
+
         private:
+            // How fromString parses the JSON
+            JsonParser::Mode m_parseMode = JsonParser::Mode::INDEXED;
+
             /**
              * CTOR
              */
@@ -51,6 +128,14 @@ namespace cadf::dom::json {
              */
             virtual ~JsonConverter() = default;
 
+            /**
+             * Write the JSON representation of the (sub)tree into the sink.
+             *
+             * @param &node const DomNode root of the (sub)tree
+             * @param *sink OutputSink where the JSON is to be written
+             */
+            void writeNode(const DomNode &node, OutputSink *sink);
+
     };
 }
 
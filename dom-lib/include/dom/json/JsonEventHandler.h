@@ -0,0 +1,102 @@
+#ifndef DOM_JSON_JSONEVENTHANDLER_H_
+#define DOM_JSON_JSONEVENTHANDLER_H_
+
+#include <cstdint>
+#include <string_view>
+
+namespace cadf::dom::json {
+
+    /**
+     * Handler which is notified by the JsonEventParser of the content of the JSON as it is parsed, without a DomNode tree ever being
+     * built. By default all events are ignored, so only those of interest need to be overridden.
+     *
+     * The views that are provided are only valid for the duration of the call, their content must be copied should it be required
+     * afterwards.
+     */
+    class JsonEventHandler {
+        public:
+            /**
+             * DTOR
+             */
+            virtual ~JsonEventHandler() = default;
+
+            /**
+             * Called when an object is opened ("{")
+             */
+            virtual void startObject() {
+            }
+
+            /**
+             * Called when an object is closed ("}")
+             */
+            virtual void endObject() {
+            }
+
+            /**
+             * Called when an array is opened ("[")
+             */
+            virtual void startArray() {
+            }
+
+            /**
+             * Called when an array is closed ("]")
+             */
+            virtual void endArray() {
+            }
+
+            /**
+             * Called with the name of a value within an object, the value itself follows.
+             *
+             * @param name std::string_view the name, with any escape sequences decoded
+             */
+            virtual void key(std::string_view /*name*/) {
+            }
+
+            /**
+             * Called for a null value
+             */
+            virtual void nullValue() {
+            }
+
+            /**
+             * Called for a boolean value
+             *
+             * @param value bool the value
+             */
+            virtual void boolValue(bool /*value*/) {
+            }
+
+            /**
+             * Called for a numeric value which can be stored as an integer
+             *
+             * @param value int64_t the value
+             */
+            virtual void integerValue(int64_t /*value*/) {
+            }
+
+            /**
+             * Called for any other numeric value
+             *
+             * @param value double the value
+             */
+            virtual void doubleValue(double /*value*/) {
+            }
+
+            /**
+             * Called for a string value
+             *
+             * @param value std::string_view the value, with any escape sequences decoded
+             */
+            virtual void stringValue(std::string_view /*value*/) {
+            }
+
+            /**
+             * Called once a top level value has been completely parsed. Where the input contains a sequence of documents (such as
+             * newline-delimited JSON), this is called once for each of them.
+             */
+            virtual void endDocument() {
+            }
+    };
+}
+
+#endif /* DOM_JSON_JSONEVENTHANDLER_H_ */
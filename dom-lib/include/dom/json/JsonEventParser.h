@@ -0,0 +1,186 @@
+#ifndef DOM_JSON_JSONEVENTPARSER_H_
+#define DOM_JSON_JSONEVENTPARSER_H_
+
+#include "dom/json/JsonEventHandler.h"
+
+#include <cstdint>
+#include <istream>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cadf::dom::json {
+
+    /**
+     * Event driven (SAX style) JSON parser. Rather than building a DomNode tree, the JsonEventHandler is notified of the content of the
+     * JSON as it is encountered. The input is provided incrementally in chunks of any size, split at any point, so that arbitrarily
+     * large inputs can be processed without them ever having to be held in memory. The only memory that is retained is the nesting of
+     * the current position and the content of a single string or literal that straddles chunks.
+     *
+     * Any JSON value is accepted at the top level, and any number of them can follow one another (separated by whitespace), allowing
+     * for newline-delimited JSON feeds. JsonEventHandler::endDocument() is called as each of them is completed.
+     *
+     * Once a ParseException has been thrown, the parser must be reset() before it can be used again.
+     */
+    class JsonEventParser {
+        public:
+            /**
+             * CTOR
+             *
+             * @param *handler JsonEventHandler to notify of the parsed content
+             */
+            JsonEventParser(JsonEventHandler *handler);
+
+            /**
+             * DTOR
+             */
+            virtual ~JsonEventParser() = default;
+
+            /**
+             * Parse the next chunk of the input. Events are generated for everything that can be determined from the input provided
+             * so far.
+             *
+             * @throws ParseException if the input is not valid JSON
+             * @param *data const char pointer to the chunk
+             * @param size size_t the number of bytes in the chunk
+             */
+            void feed(const char *data, size_t size);
+
+            /**
+             * Parse the next chunk of the input.
+             *
+             * @throws ParseException if the input is not valid JSON
+             * @param data std::string_view the chunk
+             */
+            void feed(std::string_view data) {
+                feed(data.data(), data.size());
+            }
+
+            /**
+             * Indicate that the end of the input has been reached. Any pending top level literal is completed, and the input
+             * must not end in the middle of a value.
+             *
+             * @throws ParseException if the input ends in the middle of a value
+             */
+            void finish();
+
+            /**
+             * Parse the entire content of the stream, chunk by chunk, followed by finish().
+             *
+             * @throws ParseException if the input is not valid JSON
+             * @param &in std::istream from which to read the input
+             * @param chunkSize size_t how much to read at a time (defaults to 64k)
+             */
+            void parse(std::istream &in, size_t chunkSize = 64 * 1024);
+
+            /**
+             * Discard any partially parsed input, to start again from scratch.
+             */
+            void reset();
+
+            /**
+             * Get the current nesting depth (the number of objects and arrays that are currently open).
+             *
+             * @return size_t the depth
+             */
+            size_t depth() const {
+                return m_containers.size();
+            }
+
+        private:
+            // What the parser expects to see next
+            enum class State : uint8_t {
+                VALUE, FIRST_VALUE, KEY, FIRST_KEY, COLON, NEXT, STRING, LITERAL
+            };
+
+            /** Handler to notify */
+            JsonEventHandler *m_handler;
+            /** The currently open containers ('{' or '[') */
+            std::vector<char> m_containers;
+            /** What is expected next */
+            State m_state;
+            /** Whether the current string is the name of a value */
+            bool m_stringIsKey;
+            /** Whether the current string contains any escape sequences */
+            bool m_hasEscape;
+            /** Whether the last character of the previous chunk was an escaping backslash */
+            bool m_escaped;
+            /** The content of the current string or literal, when it straddles chunks */
+            std::string m_token;
+            /** Where the current string or literal started in the overall input */
+            size_t m_tokenStart;
+            /** Buffer into which strings with escape sequences are decoded */
+            std::pmr::string m_decoded;
+            /** The number of bytes in all of the previously fed chunks */
+            size_t m_offset;
+
+            /**
+             * Process a structural character, or the start of a value.
+             *
+             * @param *data const char pointer to the chunk
+             * @param index size_t the position of the character within the chunk
+             * @return size_t the position from which to continue
+             */
+            size_t processStructural(const char *data, size_t index);
+
+            /**
+             * Continue loading the current string.
+             *
+             * @param *data const char pointer to the chunk
+             * @param size size_t the number of bytes in the chunk
+             * @param index size_t the position from which to continue
+             * @return size_t the position from which to continue
+             */
+            size_t continueString(const char *data, size_t size, size_t index);
+
+            /**
+             * Continue loading the current literal.
+             *
+             * @param *data const char pointer to the chunk
+             * @param size size_t the number of bytes in the chunk
+             * @param index size_t the position from which to continue
+             * @return size_t the position from which to continue
+             */
+            size_t continueLiteral(const char *data, size_t size, size_t index);
+
+            /**
+             * Start loading a string or literal.
+             *
+             * @param state State indicating which
+             * @param start size_t where it starts within the overall input
+             */
+            void startToken(State state, size_t start);
+
+            /**
+             * Notify the handler of the completed string.
+             *
+             * @param raw std::string_view the raw content of the string
+             */
+            void emitString(std::string_view raw);
+
+            /**
+             * Notify the handler of the completed literal.
+             *
+             * @throws ParseException if the literal is not valid
+             * @param literal std::string_view the literal
+             */
+            void emitLiteral(std::string_view literal);
+
+            /**
+             * Close the current container.
+             *
+             * @throws ParseException if the closing character does not match the container
+             * @param c char the closing character
+             * @param offset size_t the position of the character in the overall input
+             */
+            void endContainer(char c, size_t offset);
+
+            /**
+             * Move on once a value has been completed.
+             */
+            void valueComplete();
+    };
+}
+
+#endif /* DOM_JSON_JSONEVENTPARSER_H_ */
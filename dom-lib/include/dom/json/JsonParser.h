@@ -2,19 +2,33 @@
 #define DOM_JSONPARSER_H_
 
 #include "dom/DomNode.h"
+#include "dom/json/StructuralIndex.h"
 
 #include <string>
+#include <string_view>
 
 namespace cadf::dom::json {
 
     class JsonParser {
         public:
+            /**
+             * How the parse is to be performed.
+             */
+            enum class Mode {
+                /** Walk through the input one character at a time */
+                SEQUENTIAL,
+                /** Build a StructuralIndex of the input first, then build the tree by jumping from one structural character to the next */
+                INDEXED
+            };
+
             /**
              * CTOR
              *
              * @param &json const std::string containing the JSON representation to parse
+             * @param mode Mode how to parse the input (defaults to SEQUENTIAL)
+             * @param &alloc const DomNode::allocator_type from which to allocate the tree (defaults to the default memory resource)
              */
-            JsonParser(const std::string &json);
+            JsonParser(std::string_view json, Mode mode = Mode::SEQUENTIAL, const DomNode::allocator_type &alloc = DomNode::allocator_type());
 
             /**
              * Parse the JSON string and create a DOM tree for the data
@@ -23,11 +37,39 @@ namespace cadf::dom::json {
              */
             DomNode parse();
 
+            /**
+             * Decode the escape sequences within the raw content of a JSON string, appending the result.
+             *
+             * @throws ParseException if an escape sequence is invalid
+             * @param raw std::string_view the raw content of the string (without the surrounding quotes)
+             * @param &decoded std::pmr::string to which the decoded content is appended
+             * @param offset size_t the position of the raw content within the overall input, for the purpose of error reporting
+             */
+            static void decodeEscapes(std::string_view raw, std::pmr::string &decoded, size_t offset);
+
+            /**
+             * Decode the escape sequences within the raw content of a JSON string, appending the result.
+             *
+             * @throws ParseException if an escape sequence is invalid
+             * @param raw std::string_view the raw content of the string (without the surrounding quotes)
+             * @param &decoded std::string to which the decoded content is appended
+             * @param offset size_t the position of the raw content within the overall input, for the purpose of error reporting
+             */
+            static void decodeEscapes(std::string_view raw, std::string &decoded, size_t offset);
+
         private:
-            // The input string that is parsed
-            const std::string &m_input;
+            // The input that is parsed
+            std::string_view m_input;
             // The current index of the parse
             size_t m_currIndex;
+            // How the parse is performed
+            Mode m_mode;
+            // The index of structural characters (INDEXED mode only)
+            StructuralIndex m_index;
+            // The current entry within the structural index (INDEXED mode only)
+            size_t m_currEntry;
+            // The allocator from which the tree is allocated
+            DomNode::allocator_type m_allocator;
 
             /**
              * Load the next key value pair from the input string.
@@ -53,18 +95,43 @@ namespace cadf::dom::json {
             /**
              * Load a string from the input. String being denoted in the input by being surrounded by ".
              *
-             * @return std::string loaded from the input
+             * @return std::pmr::string loaded from the input (allocated from the tree's allocator), with any escape sequences decoded
              */
-            std::string loadString();
+            std::pmr::string loadString();
 
             /**
-             * Load an element from the input until a terminator is reached. The presence of the terminator is validated by the checkEnd function (i.e.: load until checkEnd returns true).
-             * Whitespace is treated as a valid part of the input.
+             * Load the name of a value pair from the input, interning it directly from the input where it contains no escape sequences.
              *
-             * @param &terminators const std::string array of potential terminator characters
-             * @return std::string containing the retrieved element
+             * @return DomKey the interned name
+             */
+            DomKey loadKey();
+
+            /**
+             * Slice the content of a string out of the input, up to the closing (unescaped) quote. The opening quote must already have been consumed.
+             *
+             * @param &hasEscape bool set to indicate whether the string contains any escape sequences
+             * @return std::string_view referencing the raw content of the string within the input
+             */
+            std::string_view sliceString(bool &hasEscape);
+
+            /**
+             * Materialize the raw content of a string into the tree's allocator, decoding the escape sequences only if there are any.
+             * The result can then be moved into the tree without being copied again.
+             *
+             * @param raw std::string_view the raw content of the string
+             * @param hasEscape bool whether the content contains any escape sequences
+             * @return std::pmr::string the decoded string
+             */
+            std::pmr::string decodeString(std::string_view raw, bool hasEscape) const;
+
+            /**
+             * Intern the raw content of a name, decoding the escape sequences only if there are any.
+             *
+             * @param raw std::string_view the raw content of the name
+             * @param hasEscape bool whether the content contains any escape sequences
+             * @return DomKey the interned name
              */
-            std::string loadUntilWithSpace(const std::string &terminators);
+            DomKey decodeKey(std::string_view raw, bool hasEscape) const;
 
             /**
              * Load an element from the input until a terminator is reached. The presence of the terminator is validated by the checkEnd function (i.e.: load until checkEnd returns true).
@@ -73,9 +140,9 @@ namespace cadf::dom::json {
              *
              * @throws JSONParseException if there is whitespace within the element
              * @param &terminators const std::string array of potential terminator characters
-             * @return std::string containing the retrieved element
+             * @return std::string_view referencing the element within the input
              */
-            std::string loadUntilNoSpace(const std::string &terminators);
+            std::string_view loadUntilNoSpace(const std::string &terminators);
 
             /**
              * Check if the character is within the terminator array.
@@ -114,6 +181,70 @@ namespace cadf::dom::json {
              */
             void prevChar();
 
+            /**
+             * Parse the input by way of the structural index.
+             *
+             * @return DomNode at the root of the DOM tree
+             */
+            DomNode parseIndexed();
+
+            /**
+             * Load an object, starting at the current structural "{".
+             *
+             * @return DomNode containing the loaded object
+             */
+            DomNode loadIndexedObject();
+
+            /**
+             * Load an array, starting at the current structural "[".
+             *
+             * @return DomNode containing the loaded array of elements
+             */
+            DomNode loadIndexedArray();
+
+            /**
+             * Load a single value, which either starts at the current structural character or is a literal (number, true, false, null) preceding it.
+             *
+             * @return DomNode containing the loaded value
+             */
+            DomNode loadIndexedValue();
+
+            /**
+             * Load a string, starting at the current structural quote.
+             *
+             * @return std::pmr::string the content of the string
+             */
+            std::pmr::string loadIndexedString();
+
+            /**
+             * Load the name of a value pair, starting at the current structural quote.
+             *
+             * @return DomKey the interned name
+             */
+            DomKey loadIndexedKey();
+
+            /**
+             * Get the current structural character.
+             *
+             * @return char the current structural character ('\0' once the end of the input is reached)
+             */
+            char currentStructural() const;
+
+            /**
+             * Consume the current structural character, verifying that it is one of the expected characters and that only whitespace precedes it.
+             *
+             * @param &expected const std::string the characters which are allowed
+             * @return char the consumed character
+             */
+            char consumeStructural(const std::string &expected);
+
+            /**
+             * Check whether there is anything other than whitespace between the parse position and the current structural character.
+             *
+             * @return bool true if only whitespace (or nothing) is present
+             */
+            bool isGapEmpty() const;
+
             /**
              * Throw an exception to indicate that invalid or malformed input was detected.
              *
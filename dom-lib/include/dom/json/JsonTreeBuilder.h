@@ -0,0 +1,57 @@
+#ifndef DOM_JSON_JSONTREEBUILDER_H_
+#define DOM_JSON_JSONTREEBUILDER_H_
+
+#include "dom/DomNode.h"
+#include "dom/json/JsonEventHandler.h"
+
+#include <functional>
+#include <vector>
+
+namespace cadf::dom::json {
+
+    /**
+     * JsonEventHandler which builds a DomNode tree for each top level document. Combined with the JsonEventParser, this allows for a
+     * sequence of documents (such as newline-delimited JSON) to be processed one at a time, with only the current one ever being held
+     * in memory.
+     */
+    class JsonTreeBuilder: public JsonEventHandler {
+        public:
+            /**
+             * CTOR
+             *
+             * @param callback std::function<void(DomNode&&)> called with each completed document, the tree can be moved out of it
+             * @param &alloc const DomNode::allocator_type from which the trees are allocated (defaults to the default memory resource)
+             */
+            JsonTreeBuilder(std::function<void(DomNode&&)> callback, const DomNode::allocator_type &alloc = DomNode::allocator_type());
+
+            void startObject();
+            void endObject();
+            void startArray();
+            void endArray();
+            void key(std::string_view name);
+            void nullValue();
+            void boolValue(bool value);
+            void integerValue(int64_t value);
+            void doubleValue(double value);
+            void stringValue(std::string_view value);
+
+        private:
+            /** Called with each completed document */
+            std::function<void(DomNode&&)> m_callback;
+            /** The allocator for the nodes */
+            DomNode::allocator_type m_allocator;
+            /** The objects and arrays which are currently being built */
+            std::vector<DomNode> m_containers;
+            /** The names under which the values are to be added to the objects being built */
+            std::vector<DomKey> m_keys;
+
+            /**
+             * Add the completed value to the container being built, or hand it over if it is the whole document.
+             *
+             * @param &&value DomNode which was completed
+             */
+            void addValue(DomNode &&value);
+    };
+}
+
+#endif /* DOM_JSON_JSONTREEBUILDER_H_ */
@@ -0,0 +1,147 @@
+#ifndef DOM_JSON_LAZYJSONDOCUMENT_H_
+#define DOM_JSON_LAZYJSONDOCUMENT_H_
+
+#include "dom/DomNode.h"
+#include "dom/json/StructuralIndex.h"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cadf::dom::json {
+
+    /**
+     * JSON object which is only parsed on demand. On construction only the top level of the object is processed, indexing the name
+     * of each child along with where its value lies within the input, skipping over any nested objects and arrays without parsing
+     * them. The value of a child is only parsed into a DomNode the first time that it is accessed, after which it is retained.
+     * As such, reading a handful of small values from a large object costs next to nothing beyond a scan of the input.
+     *
+     * Only the top level is validated on construction, any errors within a nested value are only detected when it is accessed.
+     *
+     * The document refers to the input rather than copying it, the input must outlive the document. Accessing the children is not
+     * thread safe, as the first access modifies the document.
+     */
+    class LazyJsonDocument {
+        public:
+            /**
+             * CTOR - index the top level of the object
+             *
+             * @throws ParseException if the input is not an object, or the top level of the object is malformed
+             * @param json std::string_view containing the JSON object
+             */
+            LazyJsonDocument(std::string_view json);
+
+            /**
+             * DTOR
+             */
+            virtual ~LazyJsonDocument() = default;
+
+            /**
+             * Check whether the object has a child with the given name
+             *
+             * @param name std::string_view of the child
+             * @return bool true if it is present
+             */
+            bool hasChild(std::string_view name) const;
+
+            /**
+             * Get the number of children the object has
+             *
+             * @return size_t the number of children
+             */
+            size_t numChildren() const {
+                return m_children.size();
+            }
+
+            /**
+             * Access the child with the given name, parsing its value if this is the first time that it is accessed
+             *
+             * @throws std::out_of_range if there is no such child
+             * @throws ParseException if the value of the child is malformed
+             * @param &name const std::string of the child
+             * @return const DomNode& the value of the child
+             */
+            const DomNode& operator[](const std::string &name) const;
+
+            /**
+             * Access the child with the given name, parsing its value if this is the first time that it is accessed
+             *
+             * @throws std::out_of_range if there is no such child
+             * @throws ParseException if the value of the child is malformed
+             * @param *name const char of the child
+             * @return const DomNode& the value of the child
+             */
+            const DomNode& operator[](const char *name) const;
+
+            /**
+             * Get the raw JSON of the value of a child, without parsing it
+             *
+             * @throws std::out_of_range if there is no such child
+             * @param name std::string_view of the child
+             * @return std::string_view referencing the value within the input
+             */
+            std::string_view getRaw(std::string_view name) const;
+
+            /**
+             * Check whether the value of the child was parsed already
+             *
+             * @throws std::out_of_range if there is no such child
+             * @param name std::string_view of the child
+             * @return bool true if it has been parsed
+             */
+            bool isParsed(std::string_view name) const;
+
+            /**
+             * Parse all remaining children, producing the complete tree
+             *
+             * @throws ParseException if the value of any child is malformed
+             * @return DomNode containing the whole object
+             */
+            DomNode toDomNode() const;
+
+        private:
+            /**
+             * Indexed child of the object
+             */
+            struct Child {
+                /** The name of the child */
+                std::string name;
+                /** Where the value lies within the input */
+                std::string_view raw;
+                /** The value once it is parsed */
+                mutable std::optional<DomNode> value;
+            };
+
+            /** The input */
+            std::string_view m_json;
+            /** The children, sorted by name */
+            std::vector<Child> m_children;
+
+            /**
+             * Find the child with the given name
+             *
+             * @throws std::out_of_range if there is no such child
+             * @param name std::string_view of the child
+             * @return const Child& the child
+             */
+            const Child& findChild(std::string_view name) const;
+
+            /**
+             * Get the value of the child, parsing it if it was not yet
+             *
+             * @param &child const Child to parse
+             * @return const DomNode& the value
+             */
+            const DomNode& parseChild(const Child &child) const;
+
+            /**
+             * Index the top level of the object
+             *
+             * @param &index const StructuralIndex of the input
+             */
+            void indexChildren(const StructuralIndex &index);
+    };
+}
+
+#endif /* DOM_JSON_LAZYJSONDOCUMENT_H_ */
@@ -0,0 +1,88 @@
+#ifndef DOM_JSON_STRUCTURALINDEX_H_
+#define DOM_JSON_STRUCTURALINDEX_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cadf::dom::json {
+
+    /**
+     * Index of the structural characters within a JSON string. This is the first stage of the indexed parse, where the input
+     * is scanned in blocks of 64 bytes to classify the quotes, escapes and structural characters ({, }, [, ], :, ,) contained
+     * within. The scan is vectorized (SSE2/AVX2) where the CPU allows for it, with a scalar fallback otherwise.
+     *
+     * The index contains the position of every unescaped quote (both opening and closing), as well as of every structural
+     * character which is not within a string. It is terminated with the size of the input, such that a lookup past the final
+     * structural character always yields the end of the input.
+     */
+    class StructuralIndex {
+        public:
+            /**
+             * The implementation to use for the classification of the input.
+             */
+            enum class Kernel {
+                /** Use the fastest kernel that the CPU supports */
+                AUTO,
+                /** Process one character at a time */
+                SCALAR,
+                /** Process 16 characters at a time */
+                SSE2,
+                /** Process 32 characters at a time */
+                AVX2
+            };
+
+            /**
+             * The largest input that can be indexed
+             */
+            static const size_t MAX_SIZE = UINT32_MAX - 1;
+
+            /**
+             * CTOR - creates an empty index
+             */
+            StructuralIndex() = default;
+
+            /**
+             * Check whether the kernel is supported by the CPU (and compiler).
+             *
+             * @param kernel Kernel to check
+             * @return bool true if it can be used
+             */
+            static bool isSupported(Kernel kernel);
+
+            /**
+             * Build the index for the input, replacing any previously built index.
+             *
+             * @throws std::length_error if the input is larger than MAX_SIZE
+             * @param *data const char pointer to the start of the input
+             * @param size size_t the size of the input
+             * @param kernel Kernel the implementation to use (defaults to AUTO, an unsupported kernel is replaced by AUTO)
+             */
+            void build(const char *data, size_t size, Kernel kernel = Kernel::AUTO);
+
+            /**
+             * Get the number of entries within the index (including the terminating entry).
+             *
+             * @return size_t the number of entries
+             */
+            size_t size() const {
+                return m_positions.size();
+            }
+
+            /**
+             * Get the position within the input of the indexed entry.
+             *
+             * @param entry size_t the entry to retrieve (must be less than size())
+             * @return size_t the position of the structural character within the input
+             */
+            size_t operator[](size_t entry) const {
+                return m_positions[entry];
+            }
+
+        private:
+            // The positions of the structural characters
+            std::vector<uint32_t> m_positions;
+    };
+}
+
+#endif /* DOM_JSON_STRUCTURALINDEX_H_ */
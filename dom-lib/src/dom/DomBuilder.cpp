@@ -0,0 +1,38 @@
+#include "dom/DomBuilder.h"
+
+#include <utility>
+
+namespace cadf::dom {
+
+    /*
+     * CTOR
+     */
+    DomBuilder::DomBuilder(const DomNode::allocator_type &alloc): m_node(alloc) {
+    }
+
+    /*
+     * Append the child, it is put in its place when built
+     */
+    DomBuilder& DomBuilder::add(const std::string &name, DomNode value) {
+        m_node.appendChild(name, std::move(value));
+        return *this;
+    }
+
+    /*
+     * Append the element
+     */
+    DomBuilder& DomBuilder::addElement(DomNode value) {
+        m_node.addArrayElement(std::move(value));
+        return *this;
+    }
+
+    /*
+     * Sort the children and hand over the node
+     */
+    DomNode DomBuilder::build() {
+        m_node.sortChildren();
+        DomNode built = std::move(m_node);
+        m_node = DomNode(built.getAllocator());
+        return built;
+    }
+}
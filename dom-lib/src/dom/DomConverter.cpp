@@ -0,0 +1,47 @@
+#include "dom/DomConverter.h"
+#include "dom/MappedFile.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace cadf::dom {
+
+    /*
+     * Convert the mapped contents of the file
+     */
+    DomNode DomConverter::fromFile(const std::string &path) {
+        MappedFile file(path);
+        return fromData(file.data());
+    }
+
+    /*
+     * Convert the mapped contents of the file into the document
+     */
+    void DomConverter::fromFile(const std::string &path, DomDocument *document) {
+        MappedFile file(path);
+        fromData(file.data(), document);
+    }
+
+    /*
+     * Write the tree through a buffered sink directly into the file
+     */
+    void DomConverter::toFile(const DomNode &node, const std::string &path) {
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            throw std::system_error(errno, std::generic_category(), "unable to open " + path);
+
+        try {
+            FileDescriptorSink sink(fd);
+            write(node, &sink);
+            sink.flush();
+        } catch (...) {
+            ::close(fd);
+            throw;
+        }
+
+        if (::close(fd) < 0)
+            throw std::system_error(errno, std::generic_category(), "unable to close " + path);
+    }
+}
@@ -0,0 +1,39 @@
+#include "dom/DomDocument.h"
+
+namespace cadf::dom {
+
+    /*
+     * CTOR
+     */
+    DomDocument::DomDocument(size_t initialSize): m_arena(initialSize), m_root(DomNode::allocator_type(&m_arena)) {
+    }
+
+    /*
+     * Get the root
+     */
+    DomNode& DomDocument::getRoot() {
+        return m_root;
+    }
+
+    /*
+     * Get the root
+     */
+    const DomNode& DomDocument::getRoot() const {
+        return m_root;
+    }
+
+    /*
+     * Get the arena allocator
+     */
+    DomNode::allocator_type DomDocument::getAllocator() {
+        return DomNode::allocator_type(&m_arena);
+    }
+
+    /*
+     * Drop the tree and then the memory that held it
+     */
+    void DomDocument::clear() {
+        m_root = DomNode(getAllocator());
+        m_arena.release();
+    }
+}
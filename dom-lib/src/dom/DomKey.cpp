@@ -0,0 +1,145 @@
+#include "dom/DomKey.h"
+
+#include <array>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace cadf::dom {
+
+    /*
+     * The process wide pool of names. The names are stored within a deque so that they never move once added.
+     */
+    struct KeyPool {
+        std::shared_mutex mutex;
+        std::deque<DomKey::Name> names;
+        std::unordered_map<std::string_view, const DomKey::Name*> index;
+        // The maximum number of names
+        std::atomic<size_t> limit { 65536 };
+        // Whether a name was ever left out of the pool, after which names which are not pooled may still be the names of children
+        std::atomic<bool> overflowed { false };
+
+        // Number of entries in the per thread cache (must be a power of two)
+        static const size_t CACHE_SIZE = 256;
+        // The most recently interned names of the thread, indexed by hash
+        static thread_local std::array<const DomKey::Name*, CACHE_SIZE> cache;
+
+        static KeyPool& instance() {
+            static KeyPool myPool;
+            return myPool;
+        }
+
+        /*
+         * Shared by all empty keys, so that they too compare equal
+         */
+        static const DomKey::Name* emptyName() {
+            static const DomKey::Name myEmptyName("", true);
+            return &myEmptyName;
+        }
+
+        /*
+         * Look for the name within the pool, without adding it
+         */
+        const DomKey::Name* lookup(std::string_view name) {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            std::unordered_map<std::string_view, const DomKey::Name*>::const_iterator it = index.find(name);
+            return it == index.end() ? nullptr : it->second;
+        }
+
+        /*
+         * Find the name via the cache of the thread first, then the pool. If it is not there it is added to the pool if required
+         * and there is room for it, otherwise it is returned unpooled (or nullptr if not required).
+         */
+        static const DomKey::Name* intern(std::string_view name, bool add);
+    };
+
+    thread_local std::array<const DomKey::Name*, KeyPool::CACHE_SIZE> KeyPool::cache {};
+
+    /*
+     * Only pooled names are cached, as the unpooled ones may be released at any time
+     */
+    const DomKey::Name* KeyPool::intern(std::string_view name, bool add) {
+        if (name.empty())
+            return emptyName();
+
+        const DomKey::Name *&cached = cache[std::hash<std::string_view>()(name) & (CACHE_SIZE - 1)];
+        if (cached != nullptr && cached->text == name)
+            return cached;
+
+        KeyPool &keys = instance();
+        const DomKey::Name *pooled = keys.lookup(name);
+        if (pooled == nullptr) {
+            if (!add)
+                return keys.overflowed ? new DomKey::Name(name, false) : nullptr;
+            if (name.size() > DomKey::MAX_POOLED_LENGTH) {
+                keys.overflowed = true;
+                return new DomKey::Name(name, false);
+            }
+
+            std::unique_lock<std::shared_mutex> lock(keys.mutex);
+            // Another thread may have added it in the meantime
+            std::unordered_map<std::string_view, const DomKey::Name*>::const_iterator it = keys.index.find(name);
+            if (it != keys.index.end()) {
+                pooled = it->second;
+            } else if (keys.names.size() >= keys.limit) {
+                keys.overflowed = true;
+                return new DomKey::Name(name, false);
+            } else {
+                pooled = &keys.names.emplace_back(name, true);
+                keys.index.emplace(pooled->text, pooled);
+            }
+        }
+
+        cached = pooled;
+        return pooled;
+    }
+
+    /*
+     * CTOR
+     */
+    DomKey::DomKey(): m_name(KeyPool::emptyName()) {
+    }
+
+    /*
+     * CTOR
+     */
+    DomKey::DomKey(std::string_view name): m_name(KeyPool::intern(name, true)) {
+    }
+
+    /*
+     * Find the already interned name
+     */
+    std::optional<DomKey> DomKey::find(std::string_view name) {
+        const Name *found = KeyPool::intern(name, false);
+        if (found == nullptr)
+            return std::nullopt;
+
+        DomKey key;
+        key.m_name = found;
+        return key;
+    }
+
+    /*
+     * Number of pooled names
+     */
+    size_t DomKey::poolSize() {
+        KeyPool &keys = KeyPool::instance();
+        std::shared_lock<std::shared_mutex> lock(keys.mutex);
+        return keys.names.size();
+    }
+
+    /*
+     * The limit
+     */
+    size_t DomKey::getPoolLimit() {
+        return KeyPool::instance().limit;
+    }
+
+    /*
+     * Set the limit
+     */
+    void DomKey::setPoolLimit(size_t limit) {
+        KeyPool::instance().limit = limit;
+    }
+}
@@ -1,17 +1,96 @@
 #include "dom/DomNode.h"
 
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
 namespace cadf::dom {
 
+    /*
+     * Order the children by name
+     */
+    static bool childNameLess(const DomNode::Child &child, const DomKey &key) {
+        return child.first < key;
+    }
+
+    /*
+     * Allocate a container, which along with its content uses the same allocator as the node
+     */
+    template<typename T, typename... Args>
+    static std::shared_ptr<T> makeShared(const DomNode::allocator_type &alloc, Args&&... args) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(alloc.resource()), std::forward<Args>(args)...);
+    }
+
+    /*
+     * Copy the container if it is shared with another node. Its content is copied into the same allocator, and as such continues
+     * to share the storage of the nested containers.
+     */
+    template<typename T>
+    static T* detach(std::shared_ptr<T> &storage, const DomNode::allocator_type &alloc) {
+        if (storage.use_count() > 1)
+            storage = makeShared<T>(alloc, std::as_const(*storage));
+        return storage.get();
+    }
+
     /*
      * Initializes with no stored value
      */
-    DomNode::DomNode(): m_type(NONE), m_value("") {
+    DomNode::DomNode(): m_type(NONE) {
+    }
+
+    /*
+     * Copy into the default memory resource
+     */
+    DomNode::DomNode(const DomNode &other): DomNode(other, allocator_type()) {
+    }
+
+    /*
+     * Copy into the specified allocator
+     */
+    DomNode::DomNode(const DomNode &other, const allocator_type &alloc): m_allocator(alloc), m_type(NONE) {
+        copyValue(other);
+    }
+
+    /*
+     * Take over the storage of the other node
+     */
+    DomNode::DomNode(DomNode &&other) noexcept: m_allocator(other.m_allocator), m_type(other.m_type), m_shareable(other.m_shareable),
+            m_value(std::move(other.m_value)) {
+    }
+
+    /*
+     * Take over the storage of the other node, if it comes from the same allocator
+     */
+    DomNode::DomNode(DomNode &&other, const allocator_type &alloc): m_allocator(alloc), m_type(NONE) {
+        if (m_allocator == other.m_allocator) {
+            m_type = other.m_type;
+            m_shareable = other.m_shareable;
+            m_value = std::move(other.m_value);
+        } else {
+            copyValue(other);
+        }
     }
 
     /*
      * Initialize with a standard string
      */
-    DomNode::DomNode(const std::string &val, bool treatAsString): m_value(val) {
+    DomNode::DomNode(const std::string &val, bool treatAsString, const allocator_type &alloc): m_allocator(alloc) {
+        m_value.emplace<String>(val.data(), val.size(), m_allocator);
+        if(treatAsString)
+            m_type = STRING;
+        else
+            m_type = BASIC_VALUE;
+    }
+
+    /*
+     * Take over the string, along with its allocator
+     */
+    DomNode::DomNode(std::pmr::string &&val, bool treatAsString): m_allocator(val.get_allocator()) {
+        m_value.emplace<String>(std::move(val));
         if(treatAsString)
             m_type = STRING;
         else
@@ -27,97 +106,379 @@ namespace cadf::dom {
     /*
      * Initialize with a boolean
      */
-    DomNode::DomNode(bool val): m_type(BASIC_VALUE) {
-       m_value = val ? "true": "false";
+    DomNode::DomNode(bool val): m_type(BASIC_VALUE), m_value(val) {
     }
 
     /*
      * Initialize with a char
      */
     DomNode::DomNode(char val): m_type(STRING) {
-        std::stringstream ss;
-        ss << val;
-        m_value = ss.str();
+        m_value.emplace<String>(1, val, m_allocator);
     }
 
     /*
-     * Access a child node
+     * Copy the other node into this node's allocator
+     */
+    DomNode& DomNode::operator=(const DomNode &other) {
+        if (this != &other) {
+            DomNode copy(other, m_allocator);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /*
+     * Take over the storage of the other node if possible, copying it otherwise
+     */
+    DomNode& DomNode::operator=(DomNode &&other) {
+        if (this == &other)
+            return *this;
+
+        if (m_allocator == other.m_allocator) {
+            // The other node may be a descendant of this one, so take its value before releasing the current one
+            VAL_TYPE type = other.m_type;
+            bool shareable = other.m_shareable;
+            auto value = std::move(other.m_value);
+            m_type = type;
+            m_shareable = shareable;
+            m_value = std::move(value);
+        } else {
+            DomNode copy(other, m_allocator);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /*
+     * Compare the type and value, all nulls being equal regardless of how they came to be
+     */
+    bool DomNode::operator==(const DomNode &other) const {
+        if (isNull() && other.isNull())
+            return true;
+        if (m_type != other.m_type || m_value.index() != other.m_value.index())
+            return false;
+
+        // Shared containers are equal without having to look at their content
+        if (const Array *elements = array())
+            return elements == other.array() || *elements == *other.array();
+        if (const Object *children = object())
+            return children == other.object() || *children == *other.object();
+        return m_value == other.m_value;
+    }
+
+    /*
+     * Compare the type and value
+     */
+    bool DomNode::operator!=(const DomNode &other) const {
+        return !(*this == other);
+    }
+
+    /*
+     * Create an array without any elements
+     */
+    DomNode DomNode::makeArray(const allocator_type &alloc) {
+        DomNode node(alloc);
+        node.initArray(0);
+        return node;
+    }
+
+    /*
+     * Parse the literal into its native type, keeping it as is if it is not recognized
+     */
+    DomNode DomNode::fromLiteral(std::string_view literal, const allocator_type &alloc) {
+        DomNode node(alloc);
+        if (literal == "null")
+            return node;
+
+        node.m_type = BASIC_VALUE;
+        if (literal == "true") {
+            node.m_value = true;
+            return node;
+        }
+        if (literal == "false") {
+            node.m_value = false;
+            return node;
+        }
+
+        const char *begin = literal.data();
+        const char *end = begin + literal.size();
+        int64_t intVal;
+        std::from_chars_result result = std::from_chars(begin, end, intVal);
+        if (result.ec == std::errc() && result.ptr == end) {
+            node.m_value = intVal;
+            return node;
+        }
+
+        // Either a floating point value, or an integer too large to be stored as one
+        double doubleVal;
+        result = std::from_chars(begin, end, doubleVal);
+        if (result.ec == std::errc() && result.ptr == end) {
+            node.m_value = doubleVal;
+            return node;
+        }
+
+        node.m_value.emplace<String>(literal.data(), literal.size(), node.m_allocator);
+        return node;
+    }
+
+    /*
+     * Get the stored string
+     */
+    std::string_view DomNode::getValue() const {
+        const String *str = std::get_if<String>(&m_value);
+        return str ? std::string_view(*str) : std::string_view();
+    }
+
+    /*
+     * Format the value, using the shortest representation which round trips for doubles
+     */
+    std::string_view DomNode::formatValue(char (&buffer)[MAX_FORMATTED_SIZE]) const {
+        if (const String *str = std::get_if<String>(&m_value))
+            return *str;
+        if (const bool *boolVal = std::get_if<bool>(&m_value))
+            return *boolVal ? "true" : "false";
+
+        std::to_chars_result result;
+        if (const int64_t *intVal = std::get_if<int64_t>(&m_value))
+            result = std::to_chars(buffer, buffer + MAX_FORMATTED_SIZE, *intVal);
+        else if (const double *doubleVal = std::get_if<double>(&m_value))
+            result = std::to_chars(buffer, buffer + MAX_FORMATTED_SIZE, *doubleVal);
+        else
+            return std::string_view();
+
+        return std::string_view(buffer, result.ptr - buffer);
+    }
+
+    /*
+     * Access a child node, adding it in its sorted position if not yet present
      */
     DomNode& DomNode::operator[](const std::string &name) {
-        return m_children[name];
+        return operator[](DomKey(name));
     }
 
     /*
      * Access a child node
      */
     DomNode& DomNode::operator[](const char *name) {
-        return m_children[name];
+        return operator[](std::string(name));
     }
 
     /*
      * Access a child node
      */
     const DomNode& DomNode::operator[](const std::string &name) const {
-        return m_children.at(name);
+        const DomNode *child = findChild(name);
+        if (child == nullptr)
+            throw std::out_of_range("No child named " + name);
+        return *child;
     }
 
     /*
      * Access a child node
      */
     const DomNode& DomNode::operator[](const char *name) const {
-        return m_children.at(name);
+        return operator[](std::string(name));
+    }
+
+    /*
+     * Access a child node, adding it in its sorted position if not yet present. The children are no longer shared, as the reference
+     * may be used to modify them after the node is copied.
+     */
+    DomNode& DomNode::operator[](const DomKey &key) {
+        Object &children = asObject();
+        m_shareable = false;
+        Object::iterator it = std::lower_bound(children.begin(), children.end(), key, childNameLess);
+        if (it == children.end() || it->first != key)
+            it = children.emplace(it, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+        return it->second;
+    }
+
+    /*
+     * Access a child node
+     */
+    const DomNode& DomNode::operator[](const DomKey &key) const {
+        const DomNode *child = findChild(key);
+        if (child == nullptr)
+            throw std::out_of_range("No child named " + key.str());
+        return *child;
+    }
+
+    /*
+     * Check for the child
+     */
+    bool DomNode::hasChild(std::string_view name) const {
+        return findChild(name) != nullptr;
+    }
+
+    /*
+     * Add the child at the end, the order is restored by sortChildren()
+     */
+    void DomNode::appendChild(const std::string &name, DomNode &&value) {
+        appendChild(DomKey(name), std::move(value));
+    }
+
+    /*
+     * Add the child at the end
+     */
+    void DomNode::appendChild(const DomKey &key, DomNode &&value) {
+        Object &children = asObject();
+        children.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::move(value)));
+    }
+
+    /*
+     * Sort the children, keeping only the last of any duplicates (as would be the case if they were assigned via operator[])
+     */
+    void DomNode::sortChildren() {
+        if (numChildren() < 2)
+            return;
+        Object *children = mutableObject();
+
+        auto nameLess = [](const Child &lhs, const Child &rhs) {
+            return lhs.first < rhs.first;
+        };
+        // The children are frequently added in order already
+        if (!std::is_sorted(children->begin(), children->end(), nameLess))
+            std::stable_sort(children->begin(), children->end(), nameLess);
+
+        Object::iterator out = children->begin();
+        for (Object::iterator it = children->begin(); it != children->end(); ++it) {
+            Object::iterator next = it + 1;
+            if (next != children->end() && next->first == it->first)
+                continue;
+            if (out != it)
+                *out = std::move(*it);
+            ++out;
+        }
+        children->erase(out, children->end());
+    }
+
+    /*
+     * Remove the child, keeping the rest sorted
+     */
+    bool DomNode::removeChild(const DomKey &key) {
+        const Object *shared = object();
+        if (shared == nullptr)
+            return false;
+
+        Object::const_iterator it = std::lower_bound(shared->begin(), shared->end(), key, childNameLess);
+        if (it == shared->end() || it->first != key)
+            return false;
+
+        // The position is the same once the children are no longer shared
+        size_t index = it - shared->begin();
+        Object *children = mutableObject();
+        children->erase(children->begin() + index);
+        return true;
+    }
+
+    /*
+     * Copy the element into the array
+     */
+    void DomNode::addArrayElement(const DomNode &value) {
+        asArray().emplace_back(value);
+    }
+
+    /*
+     * Move the element into the array
+     */
+    void DomNode::addArrayElement(DomNode &&value) {
+        asArray().emplace_back(std::move(value));
+    }
+
+    /*
+     * Move the element into its position within the array
+     */
+    void DomNode::insertArrayElement(size_t index, DomNode &&value) {
+        Array &elements = asArray();
+        if (index > elements.size())
+            throw std::out_of_range("Array index " + std::to_string(index) + " is beyond the end of the array");
+        elements.emplace(elements.begin() + index, std::move(value));
+    }
+
+    /*
+     * Remove the element from the array
+     */
+    void DomNode::removeArrayElement(size_t index) {
+        if (index >= numArrayElements())
+            throw std::out_of_range("No array element at index " + std::to_string(index));
+        Array *elements = mutableArray();
+        elements->erase(elements->begin() + index);
     }
 
     /*
      * Get the value as a string
      */
     DomNode::operator std::string() const {
-        return m_value;
+        char buffer[MAX_FORMATTED_SIZE];
+        return std::string(formatValue(buffer));
     }
 
     /*
      * Get the value as an int
      */
     DomNode::operator int() const {
-        return atoi(m_value.c_str());
+        return (int) operator long();
     }
 
     /*
      * Get the value as an unsigned int
      */
     DomNode::operator unsigned int() const {
-        return (unsigned int) operator int();
+        return (unsigned int) operator long();
     }
 
     /*
-     * Get the value as an long
+     * Get the value as an long. Booleans are not numeric, and as such are 0. Doubles beyond the range of a long are clamped to it.
      */
     DomNode::operator long() const {
-        return atol(m_value.c_str());
+        if (const int64_t *intVal = std::get_if<int64_t>(&m_value))
+            return *intVal;
+        if (const double *doubleVal = std::get_if<double>(&m_value)) {
+            if (*doubleVal >= double(std::numeric_limits<long>::max()))
+                return std::numeric_limits<long>::max();
+            if (*doubleVal <= double(std::numeric_limits<long>::min()))
+                return std::numeric_limits<long>::min();
+            return (long) *doubleVal;
+        }
+        if (const String *str = std::get_if<String>(&m_value))
+            return atol(str->c_str());
+        return 0;
     }
 
     /*
-     * Get the value as a double
+     * Get the value as a double. Booleans are not numeric, and as such are 0
      */
     DomNode::operator double() const {
-        return atof(m_value.c_str());
+        if (const double *doubleVal = std::get_if<double>(&m_value))
+            return *doubleVal;
+        if (const int64_t *intVal = std::get_if<int64_t>(&m_value))
+            return (double) *intVal;
+        if (const String *str = std::get_if<String>(&m_value))
+            return atof(str->c_str());
+        return 0;
     }
 
     /*
-     * Get the value as a boolean
+     * Get the value as a boolean. Only true (or the string "true") is considered to be true
      */
     DomNode::operator bool() const {
-        return m_value == "true";
+        if (const bool *boolVal = std::get_if<bool>(&m_value))
+            return *boolVal;
+        if (const String *str = std::get_if<String>(&m_value))
+            return *str == "true";
+        return false;
     }
 
     /*
      * Get the value as a char
      */
     DomNode::operator char() const {
-        if (m_value.empty())
+        char buffer[MAX_FORMATTED_SIZE];
+        std::string_view formatted = formatValue(buffer);
+        if (formatted.empty())
             return '\0';
 
-        return m_value.at(0);
+        return formatted[0];
     }
 
     /*
@@ -142,51 +503,239 @@ namespace cadf::dom {
     }
 
     /*
-     * Check if the node is null
+     * Check if the node is an integer
+     */
+    bool DomNode::isInteger() const {
+        return std::holds_alternative<int64_t>(m_value);
+    }
+
+    /*
+     * Check if the node is a double
+     */
+    bool DomNode::isDouble() const {
+        return std::holds_alternative<double>(m_value);
+    }
+
+    /*
+     * Check if the node is a boolean
+     */
+    bool DomNode::isBool() const {
+        return std::holds_alternative<bool>(m_value);
+    }
+
+    /*
+     * Check if the node is null (an object without any children is also considered to be null)
      */
     bool DomNode::isNull() const {
-        return isLeaf() && !isArray() && !isString() && m_value.size() == 0;
+        if (!isLeaf() || isArray() || isString())
+            return false;
+
+        const String *str = std::get_if<String>(&m_value);
+        return std::holds_alternative<std::monostate>(m_value) || object() != nullptr || (str && str->empty());
     }
 
     /*
      * Get the number of children
      */
     size_t DomNode::numChildren() const {
-        return m_children.size();
+        const Object *children = object();
+        return children ? children->size() : 0;
     }
 
     /*
      * Get the beginning child iterator
      */
     DomNode::ChildIterator DomNode::beginChildren() const {
-        return m_children.cbegin();
+        static const Object noChildren;
+        const Object *children = object();
+        return children ? children->cbegin() : noChildren.cbegin();
     }
 
     /*
      * Get the end child iterator
      */
     DomNode::ChildIterator DomNode::endChildren() const {
-        return m_children.cend();
+        static const Object noChildren;
+        const Object *children = object();
+        return children ? children->cend() : noChildren.cend();
     }
 
     /*
      * Get the number of elements in the value array
      */
     size_t DomNode::numArrayElements() const {
-        return m_arrayElements.size();
+        const Array *elements = array();
+        return elements ? elements->size() : 0;
     }
 
     /*
      * Get the beginning array iterator
      */
     DomNode::ArrayIterator DomNode::beginArray() const {
-        return m_arrayElements.cbegin();
+        static const Array noElements;
+        const Array *elements = array();
+        return elements ? elements->cbegin() : noElements.cbegin();
     }
 
     /*
      * Get the end array iterator
      */
     DomNode::ArrayIterator DomNode::endArray() const {
-        return m_arrayElements.cend();
+        static const Array noElements;
+        const Array *elements = array();
+        return elements ? elements->cend() : noElements.cend();
+    }
+
+    /*
+     * Replace the current value with an empty array
+     */
+    DomNode::Array& DomNode::initArray(size_t reserve) {
+        m_type = ARRAY;
+        Array &elements = *m_value.emplace<std::shared_ptr<Array>>(makeShared<Array>(m_allocator));
+        elements.reserve(reserve);
+        return elements;
+    }
+
+    /*
+     * Get the array, replacing the current value if it is not one
+     */
+    DomNode::Array& DomNode::asArray() {
+        if (Array *elements = mutableArray())
+            return *elements;
+        return initArray(0);
+    }
+
+    /*
+     * Get the children, replacing the current value if it is not an object
+     */
+    DomNode::Object& DomNode::asObject() {
+        if (Object *children = mutableObject())
+            return *children;
+
+        m_type = OBJECT;
+        return *m_value.emplace<std::shared_ptr<Object>>(makeShared<Object>(m_allocator));
+    }
+
+    /*
+     * Get the array, if the node is one
+     */
+    const DomNode::Array* DomNode::array() const {
+        const std::shared_ptr<Array> *elements = std::get_if<std::shared_ptr<Array>>(&m_value);
+        return elements ? elements->get() : nullptr;
+    }
+
+    /*
+     * Get the children, if the node is an object
+     */
+    const DomNode::Object* DomNode::object() const {
+        const std::shared_ptr<Object> *children = std::get_if<std::shared_ptr<Object>>(&m_value);
+        return children ? children->get() : nullptr;
+    }
+
+    /*
+     * Get the array, no longer sharing it
+     */
+    DomNode::Array* DomNode::mutableArray() {
+        std::shared_ptr<Array> *elements = std::get_if<std::shared_ptr<Array>>(&m_value);
+        return elements ? detach(*elements, m_allocator) : nullptr;
+    }
+
+    /*
+     * Get the children, no longer sharing them
+     */
+    DomNode::Object* DomNode::mutableObject() {
+        std::shared_ptr<Object> *children = std::get_if<std::shared_ptr<Object>>(&m_value);
+        return children ? detach(*children, m_allocator) : nullptr;
+    }
+
+    /*
+     * Look up the interned name of the child
+     */
+    const DomNode* DomNode::findChild(std::string_view name) const {
+        // A name which was never interned cannot be the name of any child
+        std::optional<DomKey> key = DomKey::find(name);
+        return key ? findChild(*key) : nullptr;
+    }
+
+    /*
+     * Binary search for the child
+     */
+    const DomNode* DomNode::findChild(const DomKey &key) const {
+        const Object *children = object();
+        if (children == nullptr)
+            return nullptr;
+
+        Object::const_iterator it = std::lower_bound(children->begin(), children->end(), key, childNameLess);
+        if (it == children->end() || it->first != key)
+            return nullptr;
+        return &it->second;
+    }
+
+    /*
+     * Look up the interned name of the child
+     */
+    DomNode* DomNode::findChild(std::string_view name) {
+        std::optional<DomKey> key = DomKey::find(name);
+        return key ? findChild(*key) : nullptr;
+    }
+
+    /*
+     * Find the child in the shared children, only detaching them (for good, as the pointer may outlive a copy) if it is there
+     */
+    DomNode* DomNode::findChild(const DomKey &key) {
+        const Object *shared = object();
+        if (shared == nullptr)
+            return nullptr;
+
+        Object::const_iterator it = std::lower_bound(shared->begin(), shared->end(), key, childNameLess);
+        if (it == shared->end() || it->first != key)
+            return nullptr;
+        size_t index = it - shared->begin();
+        Object *children = mutableObject();
+        m_shareable = false;
+        return &(*children)[index].second;
+    }
+
+    /*
+     * Bounds checked access to the element
+     */
+    const DomNode* DomNode::findArrayElement(size_t index) const {
+        const Array *elements = array();
+        if (elements == nullptr || index >= elements->size())
+            return nullptr;
+        return &(*elements)[index];
+    }
+
+    /*
+     * Bounds checked access to the element, detaching the elements (for good, as the pointer may outlive a copy) if it is there
+     */
+    DomNode* DomNode::findArrayElement(size_t index) {
+        if (index >= numArrayElements())
+            return nullptr;
+        Array *elements = mutableArray();
+        m_shareable = false;
+        return &(*elements)[index];
+    }
+
+    /*
+     * Copy the value, allocating any storage from this node's allocator
+     */
+    void DomNode::copyValue(const DomNode &other) {
+        m_type = other.m_type;
+        if (const String *str = std::get_if<String>(&other.m_value)) {
+            m_value.emplace<String>(*str, m_allocator);
+        } else if (m_allocator == other.m_allocator && other.m_shareable) {
+            // Containers are shared, anything else is trivially copied
+            m_value = other.m_value;
+        } else if (const Array *elements = other.array()) {
+            // The elements are copied into this node's allocator (each of which decides for itself whether to share its own content
+            // when the allocator is the same)
+            m_value.emplace<std::shared_ptr<Array>>(makeShared<Array>(m_allocator, *elements));
+        } else if (const Object *children = other.object()) {
+            m_value.emplace<std::shared_ptr<Object>>(makeShared<Object>(m_allocator, *children));
+        } else {
+            // Nothing to allocate for the remaining types
+            m_value = other.m_value;
+        }
     }
 }
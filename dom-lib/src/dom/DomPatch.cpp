@@ -0,0 +1,209 @@
+#include "dom/DomPatch.h"
+#include "dom/DomPath.h"
+#include "dom/DomException.h"
+
+#include <algorithm>
+#include <optional>
+
+namespace cadf::dom {
+
+    namespace {
+        // The names of the fields of an operation
+        const DomKey& opKey() {
+            static const DomKey myKey("op");
+            return myKey;
+        }
+
+        const DomKey& pathKey() {
+            static const DomKey myKey("path");
+            return myKey;
+        }
+
+        const DomKey& valueKey() {
+            static const DomKey myKey("value");
+            return myKey;
+        }
+
+        /*
+         * Add an operation to the patch, copying the value into it (if there is one)
+         */
+        void addOperation(DomNode &patch, const char *op, const std::string &path, const DomNode *value) {
+            DomNode operation;
+            operation[opKey()] = op;
+            operation[pathKey()] = path;
+            if (value != nullptr)
+                operation[valueKey()] = *value;
+            patch.addArrayElement(std::move(operation));
+        }
+
+        /*
+         * Get the element of the array
+         */
+        const DomNode& element(const DomNode &array, size_t index) {
+            return *(array.beginArray() + index);
+        }
+    }
+
+    /*
+     * Diff from the root
+     */
+    DomNode DomPatch::diff(const DomNode &from, const DomNode &to) {
+        DomNode patch = DomNode::makeArray();
+        std::string path;
+        diffNode(from, to, path, patch);
+        return patch;
+    }
+
+    /*
+     * Descend into containers of the same kind, anything else is replaced as a whole if it changed
+     */
+    void DomPatch::diffNode(const DomNode &from, const DomNode &to, std::string &path, DomNode &patch) {
+        if (from.isArray() && to.isArray())
+            diffArray(from, to, path, patch);
+        else if (!from.isLeaf() && !to.isLeaf())
+            diffObject(from, to, path, patch);
+        else if (from != to)
+            addOperation(patch, "replace", path, &to);
+    }
+
+    /*
+     * Skip the common leading and trailing elements, diff the elements in between pairwise, and add or remove the remainder
+     */
+    void DomPatch::diffArray(const DomNode &from, const DomNode &to, std::string &path, DomNode &patch) {
+        size_t fromSize = from.numArrayElements();
+        size_t toSize = to.numArrayElements();
+
+        size_t prefix = 0;
+        while (prefix < fromSize && prefix < toSize && element(from, prefix) == element(to, prefix))
+            prefix++;
+        size_t suffix = 0;
+        while (suffix < fromSize - prefix && suffix < toSize - prefix && element(from, fromSize - 1 - suffix) == element(to, toSize - 1 - suffix))
+            suffix++;
+
+        size_t fromCount = fromSize - prefix - suffix;
+        size_t toCount = toSize - prefix - suffix;
+        size_t common = std::min(fromCount, toCount);
+        size_t pathLength = path.size();
+
+        for (size_t i = prefix; i < prefix + common; i++) {
+            path += '/';
+            path += std::to_string(i);
+            diffNode(element(from, i), element(to, i), path, patch);
+            path.resize(pathLength);
+        }
+
+        // Only one of the two applies, inserting in ascending order or removing in descending order keeps the indices valid
+        for (size_t i = prefix + common; i < prefix + toCount; i++)
+            addOperation(patch, "add", path + "/" + std::to_string(i), &element(to, i));
+        for (size_t i = prefix + fromCount; i > prefix + common; i--)
+            addOperation(patch, "remove", path + "/" + std::to_string(i - 1), nullptr);
+    }
+
+    /*
+     * Walk the sorted children of both objects side by side
+     */
+    void DomPatch::diffObject(const DomNode &from, const DomNode &to, std::string &path, DomNode &patch) {
+        DomNode::ChildIterator fromIt = from.beginChildren();
+        DomNode::ChildIterator toIt = to.beginChildren();
+        size_t pathLength = path.size();
+
+        while (fromIt != from.endChildren() || toIt != to.endChildren()) {
+            bool removed = toIt == to.endChildren() || (fromIt != from.endChildren() && fromIt->first < toIt->first);
+            bool added = !removed && (fromIt == from.endChildren() || toIt->first < fromIt->first);
+
+            path += '/';
+            path += DomPath::escape(removed ? fromIt->first : toIt->first);
+            if (removed) {
+                addOperation(patch, "remove", path, nullptr);
+                ++fromIt;
+            } else if (added) {
+                addOperation(patch, "add", path, &toIt->second);
+                ++toIt;
+            } else {
+                diffNode(fromIt->second, toIt->second, path, patch);
+                ++fromIt;
+                ++toIt;
+            }
+            path.resize(pathLength);
+        }
+    }
+
+    /*
+     * Apply the operations in order
+     */
+    void DomPatch::apply(DomNode &root, const DomNode &patch) {
+        if (!patch.isArray())
+            throw PatchException("patch must be an array of operations", "");
+
+        for (DomNode::ArrayIterator it = patch.beginArray(); it != patch.endArray(); ++it)
+            applyOperation(root, *it);
+    }
+
+    /*
+     * Apply the operation, as per RFC 6902
+     */
+    void DomPatch::applyOperation(DomNode &root, const DomNode &operation) {
+        const DomNode *opNode = operation.findChild(opKey());
+        const DomNode *pathNode = operation.findChild(pathKey());
+        if (opNode == nullptr || pathNode == nullptr)
+            throw PatchException("operation requires an op and a path", pathNode ? pathNode->operator std::string() : "");
+
+        std::string op = *opNode;
+        std::string pointer = *pathNode;
+        const DomNode *value = operation.findChild(valueKey());
+        if (value == nullptr && op != "remove")
+            throw PatchException(op + " requires a value", pointer);
+
+        std::optional<DomPath> path;
+        try {
+            path.emplace(pointer);
+        } catch (const ParseException &e) {
+            throw PatchException("invalid path", pointer);
+        }
+
+        if (op == "replace" || op == "test") {
+            DomNode *target = path->resolve(root);
+            if (target == nullptr)
+                throw PatchException("no such node", pointer);
+            if (op == "replace")
+                *target = *value;
+            else if (*target != *value)
+                throw PatchException("test failed", pointer);
+            return;
+        }
+
+        if (op != "add" && op != "remove")
+            throw PatchException("unsupported op " + op, pointer);
+
+        // The root itself can only be replaced
+        if (path->size() == 0) {
+            if (op == "remove")
+                throw PatchException("cannot remove the root", pointer);
+            root = *value;
+            return;
+        }
+
+        DomNode *parent = path->parent().resolve(root);
+        if (parent == nullptr)
+            throw PatchException("no such parent", pointer);
+
+        const DomPath::Step &last = (*path)[path->size() - 1];
+        if (parent->isArray()) {
+            size_t size = parent->numArrayElements();
+            if (op == "add" && last.key == "-")
+                parent->addArrayElement(*value);
+            else if (!last.isIndex || last.index > size || (op == "remove" && last.index == size))
+                throw PatchException("invalid array index", pointer);
+            else if (op == "add")
+                parent->insertArrayElement(last.index, DomNode(*value, parent->getAllocator()));
+            else
+                parent->removeArrayElement(last.index);
+        } else if (parent->isLeaf() && !parent->isNull()) {
+            throw PatchException("parent is not an object", pointer);
+        } else if (op == "add") {
+            (*parent)[last.key] = *value;
+        } else if (!parent->removeChild(last.key)) {
+            throw PatchException("no such node", pointer);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+#include "dom/DomPath.h"
+#include "dom/DomException.h"
+
+#include <charconv>
+#include <stdexcept>
+
+namespace cadf::dom {
+
+    /*
+     * CTOR - split the pointer into its steps
+     */
+    DomPath::DomPath(std::string_view pointer): m_pointer(pointer) {
+        if (pointer.empty())
+            return;
+        if (pointer[0] != '/')
+            throw ParseException("/", 0);
+
+        size_t start = 1;
+        while (true) {
+            size_t end = pointer.find('/', start);
+            addStep(pointer.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start), start);
+            if (end == std::string_view::npos)
+                break;
+            start = end + 1;
+        }
+    }
+
+    /*
+     * Unescape the step, and determine whether it can serve as an array index
+     */
+    void DomPath::addStep(std::string_view token, size_t offset) {
+        std::string name;
+        name.reserve(token.size());
+        for (size_t i = 0; i < token.size(); i++) {
+            if (token[i] != '~') {
+                name += token[i];
+                continue;
+            }
+
+            if (i + 1 < token.size() && token[i + 1] == '0')
+                name += '~';
+            else if (i + 1 < token.size() && token[i + 1] == '1')
+                name += '/';
+            else
+                throw ParseException("~0 or ~1", offset + i);
+            i++;
+        }
+
+        // Array indices are decimal without any leading zeros
+        size_t index = 0;
+        bool isIndex = !name.empty() && (name == "0" || name[0] != '0');
+        if (isIndex) {
+            std::from_chars_result result = std::from_chars(name.data(), name.data() + name.size(), index);
+            isIndex = result.ec == std::errc() && result.ptr == name.data() + name.size();
+        }
+
+        m_steps.push_back(Step { DomKey(name), isIndex, index });
+    }
+
+    /*
+     * Follow the steps, stopping as soon as one cannot be taken
+     */
+    const DomNode* DomPath::resolve(const DomNode &root) const {
+        const DomNode *node = &root;
+        for (const Step &step : m_steps) {
+            if (node->isArray())
+                node = step.isIndex ? node->findArrayElement(step.index) : nullptr;
+            else
+                node = node->findChild(step.key);
+
+            if (node == nullptr)
+                return nullptr;
+        }
+        return node;
+    }
+
+    /*
+     * Follow the steps via the mutable accessors, so that any containers along the way which are shared with a copy of the tree are
+     * copied rather than modified
+     */
+    DomNode* DomPath::resolve(DomNode &root) const {
+        DomNode *node = &root;
+        for (const Step &step : m_steps) {
+            if (node->isArray())
+                node = step.isIndex ? node->findArrayElement(step.index) : nullptr;
+            else
+                node = node->findChild(step.key);
+
+            if (node == nullptr)
+                return nullptr;
+        }
+        return node;
+    }
+
+    /*
+     * Follow the steps, throwing if they cannot be taken
+     */
+    const DomNode& DomPath::get(const DomNode &root) const {
+        const DomNode *node = resolve(root);
+        if (node == nullptr)
+            throw std::out_of_range("No node at " + m_pointer);
+        return *node;
+    }
+
+    /*
+     * Number of steps
+     */
+    size_t DomPath::size() const {
+        return m_steps.size();
+    }
+
+    /*
+     * Access the step
+     */
+    const DomPath::Step& DomPath::operator[](size_t index) const {
+        return m_steps[index];
+    }
+
+    /*
+     * Drop the last step, along with its part of the pointer
+     */
+    DomPath DomPath::parent() const {
+        DomPath path(*this);
+        if (!path.m_steps.empty()) {
+            path.m_steps.pop_back();
+            path.m_pointer.erase(path.m_pointer.rfind('/'));
+        }
+        return path;
+    }
+
+    /*
+     * Escape the characters which have a special meaning within the pointer
+     */
+    std::string DomPath::escape(std::string_view name) {
+        std::string escaped;
+        escaped.reserve(name.size());
+        for (char c : name) {
+            if (c == '~')
+                escaped += "~0";
+            else if (c == '/')
+                escaped += "~1";
+            else
+                escaped += c;
+        }
+        return escaped;
+    }
+
+    /*
+     * The original pointer
+     */
+    const std::string& DomPath::toString() const {
+        return m_pointer;
+    }
+}
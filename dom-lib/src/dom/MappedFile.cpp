@@ -0,0 +1,71 @@
+#include "dom/MappedFile.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace cadf::dom {
+
+    /*
+     * Throw the error for the current errno, closing the file descriptor first
+     */
+    static void fail(int fd, const std::string &what) {
+        int error = errno;
+        if (fd >= 0)
+            ::close(fd);
+        throw std::system_error(error, std::generic_category(), what);
+    }
+
+    /*
+     * CTOR
+     */
+    MappedFile::MappedFile(const std::string &path) : m_data(nullptr), m_size(0) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            fail(fd, "unable to open " + path);
+
+        struct stat info;
+        if (::fstat(fd, &info) < 0)
+            fail(fd, "unable to stat " + path);
+
+        // An empty mapping is not allowed, nothing to map in the first place
+        m_size = info.st_size;
+        if (m_size > 0) {
+            m_data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (m_data == MAP_FAILED) {
+                m_data = nullptr;
+                fail(fd, "unable to map " + path);
+            }
+            // Only a hint, the mapping works regardless of whether it is taken
+            ::madvise(m_data, m_size, MADV_SEQUENTIAL);
+        }
+
+        // The mapping remains valid once the file is closed
+        ::close(fd);
+    }
+
+    /*
+     * DTOR
+     */
+    MappedFile::~MappedFile() {
+        if (m_data)
+            ::munmap(m_data, m_size);
+    }
+
+    /*
+     * Get the contents
+     */
+    std::string_view MappedFile::data() const {
+        return std::string_view(static_cast<const char*>(m_data), m_size);
+    }
+
+    /*
+     * Get the size
+     */
+    size_t MappedFile::size() const {
+        return m_size;
+    }
+}
@@ -0,0 +1,88 @@
+#include "dom/OutputSink.h"
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <unistd.h>
+
+namespace cadf::dom {
+
+    /*
+     * CTOR
+     */
+    StringSink::StringSink(std::string *str) : m_str(str) {
+    }
+
+    /*
+     * Make room for the data to come
+     */
+    void StringSink::reserve(size_t size) {
+        m_str->reserve(m_str->size() + size);
+    }
+
+    /*
+     * Append to the string
+     */
+    void StringSink::write(const char *data, size_t size) {
+        m_str->append(data, size);
+    }
+
+    /*
+     * CTOR
+     */
+    FileDescriptorSink::FileDescriptorSink(int fd, size_t bufferSize) : m_fd(fd), m_buffer(bufferSize), m_buffered(0) {
+    }
+
+    /*
+     * DTOR
+     */
+    FileDescriptorSink::~FileDescriptorSink() {
+        try {
+            flush();
+        } catch (const std::system_error &e) {
+            // Nothing can be done about it at this point, call flush() explicitly to see the error
+        }
+    }
+
+    /*
+     * Buffer the data, writing it out once the buffer is full
+     */
+    void FileDescriptorSink::write(const char *data, size_t size) {
+        if (m_buffered + size > m_buffer.size()) {
+            flush();
+            // Too large to be worth buffering
+            if (size >= m_buffer.size()) {
+                writeOut(data, size);
+                return;
+            }
+        }
+
+        memcpy(m_buffer.data() + m_buffered, data, size);
+        m_buffered += size;
+    }
+
+    /*
+     * Write out the buffered data
+     */
+    void FileDescriptorSink::flush() {
+        size_t buffered = m_buffered;
+        m_buffered = 0;
+        writeOut(m_buffer.data(), buffered);
+    }
+
+    /*
+     * Write to the file descriptor, until all data has been written
+     */
+    void FileDescriptorSink::writeOut(const char *data, size_t size) {
+        while (size > 0) {
+            ssize_t written = ::write(m_fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw std::system_error(errno, std::generic_category(), "error writing to file descriptor");
+            }
+            data += written;
+            size -= written;
+        }
+    }
+}
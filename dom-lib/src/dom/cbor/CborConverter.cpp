@@ -0,0 +1,219 @@
+#include "dom/cbor/CborConverter.h"
+#include "dom/cbor/CborParser.h"
+
+#include <cstring>
+
+namespace cadf::dom::cbor {
+
+    /** Initial bytes of the major types */
+    static const uint8_t UNSIGNED = 0x00;
+    static const uint8_t NEGATIVE = 0x20;
+    static const uint8_t TEXT = 0x60;
+    static const uint8_t ARRAY = 0x80;
+    static const uint8_t MAP = 0xa0;
+    /** Simple values */
+    static const uint8_t FALSE_VALUE = 0xf4;
+    static const uint8_t TRUE_VALUE = 0xf5;
+    static const uint8_t NULL_VALUE = 0xf6;
+    static const uint8_t FLOAT_VALUE = 0xfa;
+    static const uint8_t DOUBLE_VALUE = 0xfb;
+
+    CborConverter* CborConverter::instance() {
+        static CborConverter myInstance;
+        return &myInstance;
+    }
+
+    /*
+     * Determine the size of the initial byte along with the argument that follows it
+     */
+    static size_t headSize(uint64_t argument) {
+        if (argument < 24)
+            return 1;
+        if (argument <= UINT8_MAX)
+            return 2;
+        if (argument <= UINT16_MAX)
+            return 3;
+        if (argument <= UINT32_MAX)
+            return 5;
+        return 9;
+    }
+
+    /*
+     * Write the initial byte, with the argument either contained within it or following it in the fewest bytes possible
+     */
+    static void writeHead(uint8_t majorType, uint64_t argument, OutputSink *sink) {
+        char head[9];
+        size_t size = headSize(argument);
+        if (size == 1) {
+            head[0] = char(majorType | argument);
+        } else {
+            // 24, 25, 26, 27 indicate 1, 2, 4, 8 bytes respectively
+            static const uint8_t info[] = { 0, 24, 25, 0, 26, 0, 0, 0, 27 };
+            head[0] = char(majorType | info[size - 1]);
+            for (size_t i = size - 1; i > 0; i--) {
+                head[i] = char(argument & 0xff);
+                argument >>= 8;
+            }
+        }
+        sink->write(head, size);
+    }
+
+    /*
+     * Doubles are written as floats if they can be without losing precision
+     */
+    static bool fitsInFloat(double value) {
+        return double(float(value)) == value;
+    }
+
+    /*
+     * Determine the size of the encoded scalar value
+     */
+    static size_t scalarSize(const DomNode &node) {
+        if (node.isNull() || node.isBool())
+            return 1;
+        if (node.isInteger()) {
+            long value = node;
+            return headSize(value < 0 ? uint64_t(-1 - value) : uint64_t(value));
+        }
+        if (node.isDouble())
+            return fitsInFloat(node) ? 5 : 9;
+
+        std::string_view str = node.getValue();
+        return headSize(str.size()) + str.size();
+    }
+
+    /*
+     * Write the scalar value
+     */
+    static void writeScalar(const DomNode &node, OutputSink *sink) {
+        if (node.isNull()) {
+            const char value = char(NULL_VALUE);
+            sink->write(&value, 1);
+        } else if (node.isBool()) {
+            const char value = char(node.operator bool() ? TRUE_VALUE : FALSE_VALUE);
+            sink->write(&value, 1);
+        } else if (node.isInteger()) {
+            long value = node;
+            if (value < 0)
+                writeHead(NEGATIVE, uint64_t(-1 - value), sink);
+            else
+                writeHead(UNSIGNED, uint64_t(value), sink);
+        } else if (node.isDouble()) {
+            double value = node;
+            char encoded[9];
+            size_t size;
+            uint64_t bits;
+            if (fitsInFloat(value)) {
+                float single = float(value);
+                uint32_t singleBits;
+                memcpy(&singleBits, &single, sizeof(single));
+                encoded[0] = char(FLOAT_VALUE);
+                bits = singleBits;
+                size = 5;
+            } else {
+                memcpy(&bits, &value, sizeof(value));
+                encoded[0] = char(DOUBLE_VALUE);
+                size = 9;
+            }
+            for (size_t i = size - 1; i > 0; i--) {
+                encoded[i] = char(bits & 0xff);
+                bits >>= 8;
+            }
+            sink->write(encoded, size);
+        } else {
+            // Strings, as well as any literal which is not stored natively
+            std::string_view str = node.getValue();
+            writeHead(TEXT, str.size(), sink);
+            sink->write(str.data(), str.size());
+        }
+    }
+
+    /*
+     * Determine the size of the CBOR representation of the tree
+     */
+    size_t CborConverter::size(const DomNode &node) {
+        size_t mySize = 0;
+
+        if (node.isArray()) {
+            mySize = headSize(node.numArrayElements());
+            for (DomNode::ArrayIterator it = node.beginArray(); it != node.endArray(); ++it)
+                mySize += size(*it);
+        } else if (node.isLeaf()) {
+            mySize = scalarSize(node);
+        } else {
+            mySize = headSize(node.numChildren());
+            for (DomNode::ChildIterator it = node.beginChildren(); it != node.endChildren(); ++it)
+                mySize += headSize(it->first.size()) + it->first.size() + size(it->second);
+        }
+
+        return mySize;
+    }
+
+    /*
+     * Convert the tree to CBOR, allocating the string only once
+     */
+    std::string CborConverter::toString(const DomNode &node) {
+        std::string conv;
+        StringSink sink(&conv);
+        sink.reserve(size(node));
+        writeNode(node, &sink);
+        return conv;
+    }
+
+    /*
+     * Write the tree into the sink
+     */
+    void CborConverter::write(const DomNode &node, OutputSink *sink) {
+        writeNode(node, sink);
+    }
+
+    /*
+     * Write the (sub)tree into the sink
+     */
+    void CborConverter::writeNode(const DomNode &node, OutputSink *sink) {
+        if (node.isArray()) {
+            writeHead(ARRAY, node.numArrayElements(), sink);
+            for (DomNode::ArrayIterator it = node.beginArray(); it != node.endArray(); ++it)
+                writeNode(*it, sink);
+        } else if (node.isLeaf()) {
+            writeScalar(node, sink);
+        } else {
+            writeHead(MAP, node.numChildren(), sink);
+            for (DomNode::ChildIterator it = node.beginChildren(); it != node.endChildren(); ++it) {
+                writeHead(TEXT, it->first.size(), sink);
+                sink->write(it->first.data(), it->first.size());
+                writeNode(it->second, sink);
+            }
+        }
+    }
+
+    /*
+     * Create a tree from the CBOR
+     */
+    DomNode CborConverter::fromString(const std::string &cborString) {
+        return fromData(cborString);
+    }
+
+    /*
+     * Create a tree from the CBOR, allocated directly from the document's arena
+     */
+    void CborConverter::fromString(const std::string &cborString, DomDocument *document) {
+        fromData(cborString, document);
+    }
+
+    /*
+     * Create a tree from the CBOR in place
+     */
+    DomNode CborConverter::fromData(std::string_view data) {
+        CborParser parser(data);
+        return parser.parse();
+    }
+
+    /*
+     * Create a tree from the CBOR in place, allocated directly from the document's arena
+     */
+    void CborConverter::fromData(std::string_view data, DomDocument *document) {
+        CborParser parser(data, document->getAllocator());
+        document->getRoot() = parser.parse();
+    }
+}
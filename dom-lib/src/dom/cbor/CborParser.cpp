@@ -0,0 +1,230 @@
+#include "dom/cbor/CborParser.h"
+#include "dom/DomException.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace cadf::dom::cbor {
+
+    /** Major types (the top 3 bits of the initial byte) */
+    static const uint8_t UNSIGNED = 0;
+    static const uint8_t NEGATIVE = 1;
+    static const uint8_t BYTES = 2;
+    static const uint8_t TEXT = 3;
+    static const uint8_t ARRAY = 4;
+    static const uint8_t MAP = 5;
+    static const uint8_t TAG = 6;
+    static const uint8_t SIMPLE = 7;
+    /** Additional information indicating an indefinite length */
+    static const uint8_t INDEFINITE = 31;
+    /** Terminator of indefinite length items */
+    static const uint8_t BREAK = 0xff;
+
+    /*
+     * Decode an IEEE 754 half precision value
+     */
+    static double decodeHalf(uint16_t half) {
+        int exponent = (half >> 10) & 0x1f;
+        int mantissa = half & 0x3ff;
+        double value;
+        if (exponent == 0)
+            value = std::ldexp(mantissa, -24);
+        else if (exponent != 31)
+            value = std::ldexp(mantissa + 1024, exponent - 25);
+        else
+            value = mantissa == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+        return (half & 0x8000) ? -value : value;
+    }
+
+    /*
+     * CTOR
+     */
+    CborParser::CborParser(std::string_view data, const DomNode::allocator_type &alloc): m_data(data), m_currIndex(0), m_allocator(alloc) {
+    }
+
+    /*
+     * Decode the first item
+     */
+    DomNode CborParser::parse() {
+        m_currIndex = 0;
+        return loadItem();
+    }
+
+    /*
+     * Decode the item based on its major type
+     */
+    DomNode CborParser::loadItem() {
+        size_t start = m_currIndex;
+        uint8_t initial = nextByte();
+        uint8_t info = initial & 0x1f;
+
+        switch (initial >> 5) {
+            case UNSIGNED: {
+                uint64_t value = loadArgument(initial);
+                // As with JSON, integers which are too large are stored as doubles
+                if (value > uint64_t(std::numeric_limits<int64_t>::max()))
+                    return DomNode(double(value));
+                return DomNode(int64_t(value));
+            }
+            case NEGATIVE: {
+                uint64_t value = loadArgument(initial);
+                if (value > uint64_t(std::numeric_limits<int64_t>::max()))
+                    return DomNode(-1.0 - double(value));
+                return DomNode(-1 - int64_t(value));
+            }
+            case BYTES:
+            case TEXT:
+                return DomNode(loadString(initial));
+            case ARRAY: {
+                DomNode array = DomNode::makeArray(m_allocator);
+                if (info == INDEFINITE) {
+                    while (!checkBreak())
+                        array.addArrayElement(loadItem());
+                } else {
+                    for (uint64_t remaining = loadArgument(initial); remaining > 0; remaining--)
+                        array.addArrayElement(loadItem());
+                }
+                return array;
+            }
+            case MAP: {
+                DomNode object(m_allocator);
+                bool indefinite = info == INDEFINITE;
+                uint64_t remaining = indefinite ? 0 : loadArgument(initial);
+                while (indefinite ? !checkBreak() : remaining-- > 0) {
+                    size_t keyStart = m_currIndex;
+                    uint8_t keyInitial = nextByte();
+                    if ((keyInitial >> 5) != TEXT)
+                        throw ParseException("text string key", keyStart);
+                    DomKey key = loadKey(keyInitial);
+                    object.appendChild(key, loadItem());
+                }
+                object.sortChildren();
+                return object;
+            }
+            case TAG:
+                // The meaning of the tag is not retained, only the item it applies to
+                loadArgument(initial);
+                return loadItem();
+            default:
+                break;
+        }
+
+        // Simple values and floating point numbers
+        switch (info) {
+            case 20:
+                return DomNode(false);
+            case 21:
+                return DomNode(true);
+            case 22:
+            case 23:
+                return DomNode(m_allocator);
+            case 25:
+                return DomNode(decodeHalf(uint16_t(loadBigEndian(2))));
+            case 26: {
+                uint32_t bits = uint32_t(loadBigEndian(4));
+                float value;
+                memcpy(&value, &bits, sizeof(value));
+                return DomNode(double(value));
+            }
+            case 27: {
+                uint64_t bits = loadBigEndian(8);
+                double value;
+                memcpy(&value, &bits, sizeof(value));
+                return DomNode(value);
+            }
+            default:
+                throw ParseException("data item", start);
+        }
+    }
+
+    /*
+     * Load the string, joining the chunks of an indefinite length string together
+     */
+    std::pmr::string CborParser::loadString(uint8_t initial) {
+        std::pmr::string str(m_allocator);
+        if ((initial & 0x1f) == INDEFINITE) {
+            while (!checkBreak()) {
+                size_t chunkStart = m_currIndex;
+                uint8_t chunk = nextByte();
+                if ((chunk >> 5) != (initial >> 5) || (chunk & 0x1f) == INDEFINITE)
+                    throw ParseException("definite length string chunk", chunkStart);
+                uint64_t size = loadArgument(chunk);
+                require(size);
+                str.append(m_data.data() + m_currIndex, size);
+                m_currIndex += size;
+            }
+            return str;
+        }
+
+        uint64_t size = loadArgument(initial);
+        require(size);
+        str.assign(m_data.data() + m_currIndex, size);
+        m_currIndex += size;
+        return str;
+    }
+
+    /*
+     * Only indefinite length keys need to be put together prior to being interned
+     */
+    DomKey CborParser::loadKey(uint8_t initial) {
+        if ((initial & 0x1f) == INDEFINITE)
+            return DomKey(loadString(initial));
+
+        uint64_t size = loadArgument(initial);
+        require(size);
+        DomKey key(m_data.substr(m_currIndex, size));
+        m_currIndex += size;
+        return key;
+    }
+
+    /*
+     * The argument is either within the initial byte, or within the 1, 2, 4, or 8 bytes following it
+     */
+    uint64_t CborParser::loadArgument(uint8_t initial) {
+        uint8_t info = initial & 0x1f;
+        if (info < 24)
+            return info;
+        if (info > 27)
+            throw ParseException("argument", m_currIndex - 1);
+        return loadBigEndian(size_t(1) << (info - 24));
+    }
+
+    /*
+     * Check for the break code
+     */
+    bool CborParser::checkBreak() {
+        require(1);
+        if (uint8_t(m_data[m_currIndex]) != BREAK)
+            return false;
+        m_currIndex++;
+        return true;
+    }
+
+    /*
+     * Combine the bytes, most significant first
+     */
+    uint64_t CborParser::loadBigEndian(size_t size) {
+        require(size);
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; i++)
+            value = (value << 8) | uint8_t(m_data[m_currIndex++]);
+        return value;
+    }
+
+    /*
+     * Get the next byte
+     */
+    uint8_t CborParser::nextByte() {
+        require(1);
+        return uint8_t(m_data[m_currIndex++]);
+    }
+
+    /*
+     * Make sure that the data is long enough
+     */
+    void CborParser::require(uint64_t size) {
+        if (size > m_data.size() - m_currIndex)
+            throw ParseException(std::to_string(size) + " more bytes", m_data.size());
+    }
+}
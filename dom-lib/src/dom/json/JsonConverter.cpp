@@ -8,12 +8,84 @@ namespace cadf::dom::json {
         return &myInstance;
     }
 
+    /*
+     * Check whether the character must be escaped within a JSON string
+     */
+    static bool needsEscape(unsigned char c) {
+        return c == '"' || c == '\\' || c < 0x20;
+    }
+
+    /*
+     * Determine the size of the string once it is quoted and escaped
+     */
+    size_t JsonConverter::quotedSize(std::string_view str) {
+        size_t size = str.size() + 2;
+        for (unsigned char c : str) {
+            if (!needsEscape(c))
+                continue;
+            // \uXXXX for control characters without a short escape
+            size += (c == '"' || c == '\\' || c == '\n' || c == '\r' || c == '\t') ? 1 : 5;
+        }
+        return size;
+    }
+
+    /*
+     * Write the string surrounded by quotes, escaping any characters which cannot appear within a JSON string as is.
+     * Runs of characters which need no escaping are written in one go.
+     */
+    void JsonConverter::writeQuoted(std::string_view str, OutputSink *sink) {
+        static const char *hex = "0123456789abcdef";
 
-    std::string getValueString(const DomNode &node) {
-        if (node.isNull())
-            return "null";
-        std::string padding = node.isString() ? "\"" : "";
-        return padding + node.operator std::string() + padding;
+        sink->write("\"", 1);
+        size_t runStart = 0;
+        for (size_t i = 0; i < str.size(); i++) {
+            unsigned char c = str[i];
+            if (!needsEscape(c))
+                continue;
+
+            sink->write(str.data() + runStart, i - runStart);
+            runStart = i + 1;
+            switch (c) {
+                case '"':
+                    sink->write("\\\"", 2);
+                    break;
+                case '\\':
+                    sink->write("\\\\", 2);
+                    break;
+                case '\n':
+                    sink->write("\\n", 2);
+                    break;
+                case '\r':
+                    sink->write("\\r", 2);
+                    break;
+                case '\t':
+                    sink->write("\\t", 2);
+                    break;
+                default:
+                    char escaped[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+                    sink->write(escaped, sizeof(escaped));
+                    break;
+            }
+        }
+        sink->write(str.data() + runStart, str.size() - runStart);
+        sink->write("\"", 1);
+    }
+
+    /*
+     * Determine the size of a non-string value once formatted
+     */
+    static size_t formattedSize(const DomNode &node) {
+        char buffer[DomNode::MAX_FORMATTED_SIZE];
+        return node.formatValue(buffer).size();
+    }
+
+    /*
+     * Write a non-string value as is
+     */
+    static void writeFormatted(const DomNode &node, OutputSink *sink) {
+        char buffer[DomNode::MAX_FORMATTED_SIZE];
+        std::string_view formatted = node.formatValue(buffer);
+        sink->write(formatted.data(), formatted.size());
     }
 
     /*
@@ -27,56 +99,98 @@ namespace cadf::dom::json {
             for(DomNode::ArrayIterator it = node.beginArray(); it != node.endArray(); ++it)
                 mySize += size(*it);
         } else if (node.isLeaf()) {
-            mySize = getValueString(node).size();
+            if (node.isNull())
+                mySize = 4;
+            else if (node.isString())
+                mySize = quotedSize(node.getValue());
+            else
+                mySize = formattedSize(node);
         } else {
             mySize = node.numChildren() + 1;
             for(DomNode::ChildIterator it = node.beginChildren(); it != node.endChildren(); ++it)
-                mySize += it->first.size() + 3 + size(it->second);
+                mySize += quotedSize(it->first) + 1 + size(it->second);
         }
 
         return mySize;
     }
 
     /*
-     * Convert the tree to a JSON string
+     * Convert the tree to a JSON string, allocating the string only once
      */
     std::string JsonConverter::toString(const DomNode &node) {
-        std::string conv = "";
+        std::string conv;
+        StringSink sink(&conv);
+        sink.reserve(size(node));
+        writeNode(node, &sink);
+        return conv;
+    }
+
+    /*
+     * Write the tree into the sink
+     */
+    void JsonConverter::write(const DomNode &node, OutputSink *sink) {
+        writeNode(node, sink);
+    }
 
+    /*
+     * Write the (sub)tree into the sink
+     */
+    void JsonConverter::writeNode(const DomNode &node, OutputSink *sink) {
         if(node.isArray()) {
-            conv = "[";
-            size_t remaining = node.numArrayElements() - 1;
+            sink->write("[", 1);
             for (DomNode::ArrayIterator it = node.beginArray(); it != node.endArray(); ++it) {
-              conv += toString(*it);
-              if (remaining > 0) {
-                  remaining--;
-                  conv += ",";
-              }
+                if (it != node.beginArray())
+                    sink->write(",", 1);
+                writeNode(*it, sink);
             }
-            conv += "]";
+            sink->write("]", 1);
         } else if (node.isLeaf()) {
-            conv = getValueString(node);
+            if (node.isNull())
+                sink->write("null", 4);
+            else if (node.isString())
+                writeQuoted(node.getValue(), sink);
+            else
+                writeFormatted(node, sink);
         } else {
-            conv = "{";
-            size_t remaining = node.numChildren() - 1;
+            sink->write("{", 1);
             for (DomNode::ChildIterator it = node.beginChildren(); it != node.endChildren(); ++it) {
-                conv += "\"" + it->first + "\":" + toString(it->second);
-                if (remaining > 0) {
-                    remaining--;
-                    conv += ",";
-                }
+                if (it != node.beginChildren())
+                    sink->write(",", 1);
+                writeQuoted(it->first, sink);
+                sink->write(":", 1);
+                writeNode(it->second, sink);
             }
-            conv += "}";
+            sink->write("}", 1);
         }
-
-        return conv;
     }
 
     /*
      * Create a tree from the JSON string
      */
     DomNode JsonConverter::fromString(const std::string &jsonString) {
-        JsonParser parser(jsonString);
+        return fromData(jsonString);
+    }
+
+    /*
+     * Create a tree from the JSON string, allocated directly from the document's arena
+     */
+    void JsonConverter::fromString(const std::string &jsonString, DomDocument *document) {
+        fromData(jsonString, document);
+    }
+
+    /*
+     * Create a tree from the JSON in place
+     */
+    DomNode JsonConverter::fromData(std::string_view data) {
+        JsonParser parser(data, m_parseMode);
         return parser.parse();
     }
+
+    /*
+     * Create a tree from the JSON in place, allocated directly from the document's arena
+     */
+    void JsonConverter::fromData(std::string_view data, DomDocument *document) {
+        JsonParser parser(data, m_parseMode, document->getAllocator());
+        document->getRoot() = parser.parse();
+    }
 }
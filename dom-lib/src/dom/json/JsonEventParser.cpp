@@ -0,0 +1,288 @@
+#include "dom/json/JsonEventParser.h"
+#include "dom/json/JsonParser.h"
+#include "dom/DomException.h"
+#include "dom/DomNode.h"
+
+#include <cctype>
+
+namespace cadf::dom::json {
+
+    /*
+     * Check whether the character terminates a literal
+     */
+    static bool isLiteralEnd(char c) {
+        switch (c) {
+            case ',':
+            case ':':
+            case '{':
+            case '}':
+            case '[':
+            case ']':
+            case '"':
+                return true;
+            default:
+                return isspace((unsigned char) c);
+        }
+    }
+
+    /*
+     * CTOR
+     */
+    JsonEventParser::JsonEventParser(JsonEventHandler *handler): m_handler(handler), m_state(State::VALUE), m_stringIsKey(false),
+            m_hasEscape(false), m_escaped(false), m_tokenStart(0), m_offset(0) {
+    }
+
+    /*
+     * Work through the chunk, any string or literal which is not completed by the end of the chunk is retained for the next one
+     */
+    void JsonEventParser::feed(const char *data, size_t size) {
+        size_t index = 0;
+        while (index < size) {
+            if (m_state == State::STRING)
+                index = continueString(data, size, index);
+            else if (m_state == State::LITERAL)
+                index = continueLiteral(data, size, index);
+            else if (isspace((unsigned char) data[index]))
+                index++;
+            else
+                index = processStructural(data, index);
+        }
+        m_offset += size;
+    }
+
+    /*
+     * Complete any pending literal, and make sure that nothing is left open
+     */
+    void JsonEventParser::finish() {
+        if (m_state == State::LITERAL)
+            emitLiteral(m_token);
+
+        if (m_state == State::STRING)
+            throw ParseException("\"", m_offset);
+        if (!m_containers.empty())
+            throw ParseException(m_containers.back() == '{' ? "}" : "]", m_offset);
+    }
+
+    /*
+     * Feed the stream through chunk by chunk
+     */
+    void JsonEventParser::parse(std::istream &in, size_t chunkSize) {
+        std::vector<char> chunk(chunkSize);
+        while (in.read(chunk.data(), chunk.size()) || in.gcount() > 0)
+            feed(chunk.data(), in.gcount());
+        finish();
+    }
+
+    /*
+     * Start from scratch
+     */
+    void JsonEventParser::reset() {
+        m_containers.clear();
+        m_state = State::VALUE;
+        m_stringIsKey = false;
+        m_hasEscape = false;
+        m_escaped = false;
+        m_token.clear();
+        m_tokenStart = 0;
+        m_offset = 0;
+    }
+
+    /*
+     * Process the character based on what is expected at this point
+     */
+    size_t JsonEventParser::processStructural(const char *data, size_t index) {
+        char c = data[index];
+        size_t offset = m_offset + index;
+        switch (m_state) {
+            case State::FIRST_VALUE:
+                if (c == ']') {
+                    endContainer(c, offset);
+                    break;
+                }
+                // Otherwise it is the same as any other value
+                [[fallthrough]];
+            case State::VALUE:
+                switch (c) {
+                    case '{':
+                        m_containers.push_back(c);
+                        m_state = State::FIRST_KEY;
+                        m_handler->startObject();
+                        break;
+                    case '[':
+                        m_containers.push_back(c);
+                        m_state = State::FIRST_VALUE;
+                        m_handler->startArray();
+                        break;
+                    case '"':
+                        m_stringIsKey = false;
+                        startToken(State::STRING, offset + 1);
+                        break;
+                    case '}':
+                    case ']':
+                    case ':':
+                    case ',':
+                        throw ParseException("value", offset);
+                    default:
+                        // The literal itself is loaded from this character onwards
+                        startToken(State::LITERAL, offset);
+                        return index;
+                }
+                break;
+            case State::FIRST_KEY:
+                if (c == '}') {
+                    endContainer(c, offset);
+                    break;
+                }
+                [[fallthrough]];
+            case State::KEY:
+                if (c != '"')
+                    throw ParseException("\"", offset);
+                m_stringIsKey = true;
+                startToken(State::STRING, offset + 1);
+                break;
+            case State::COLON:
+                if (c != ':')
+                    throw ParseException(":", offset);
+                m_state = State::VALUE;
+                break;
+            case State::NEXT:
+                if (c == ',')
+                    m_state = m_containers.back() == '{' ? State::KEY : State::VALUE;
+                else if (c == '}' || c == ']')
+                    endContainer(c, offset);
+                else
+                    throw ParseException(m_containers.back() == '{' ? ",}" : ",]", offset);
+                break;
+            default:
+                break;
+        }
+        return index + 1;
+    }
+
+    /*
+     * Look for the closing quote, if found within the chunk and nothing was retained from the previous one, the string
+     * is passed on directly from the chunk
+     */
+    size_t JsonEventParser::continueString(const char *data, size_t size, size_t index) {
+        size_t start = index;
+        while (index < size) {
+            char c = data[index];
+            if (m_escaped) {
+                m_escaped = false;
+            } else if (c == '\\') {
+                m_escaped = true;
+                m_hasEscape = true;
+            } else if (c == '"') {
+                if (m_token.empty()) {
+                    emitString(std::string_view(data + start, index - start));
+                } else {
+                    m_token.append(data + start, index - start);
+                    emitString(m_token);
+                }
+                return index + 1;
+            }
+            index++;
+        }
+
+        m_token.append(data + start, size - start);
+        return size;
+    }
+
+    /*
+     * Look for the end of the literal, leaving the terminator to be processed as structural
+     */
+    size_t JsonEventParser::continueLiteral(const char *data, size_t size, size_t index) {
+        size_t start = index;
+        while (index < size && !isLiteralEnd(data[index]))
+            index++;
+
+        if (index == size) {
+            m_token.append(data + start, size - start);
+        } else if (m_token.empty()) {
+            emitLiteral(std::string_view(data + start, index - start));
+        } else {
+            m_token.append(data + start, index - start);
+            emitLiteral(m_token);
+        }
+        return index;
+    }
+
+    /*
+     * Prepare for the string or literal
+     */
+    void JsonEventParser::startToken(State state, size_t start) {
+        m_state = state;
+        m_token.clear();
+        m_tokenStart = start;
+        m_hasEscape = false;
+        m_escaped = false;
+    }
+
+    /*
+     * Decode the string only if required
+     */
+    void JsonEventParser::emitString(std::string_view raw) {
+        std::string_view value = raw;
+        if (m_hasEscape) {
+            m_decoded.clear();
+            JsonParser::decodeEscapes(raw, m_decoded, m_tokenStart);
+            value = m_decoded;
+        }
+
+        if (m_stringIsKey) {
+            m_state = State::COLON;
+            m_handler->key(value);
+        } else {
+            m_handler->stringValue(value);
+            valueComplete();
+        }
+    }
+
+    /*
+     * Determine the type of the literal in the same manner as it would be stored within a DomNode
+     */
+    void JsonEventParser::emitLiteral(std::string_view literal) {
+        if (literal == "null") {
+            m_handler->nullValue();
+        } else {
+            DomNode node = DomNode::fromLiteral(literal);
+            if (node.isBool())
+                m_handler->boolValue(node);
+            else if (node.isInteger())
+                m_handler->integerValue(node.operator long());
+            else if (node.isDouble())
+                m_handler->doubleValue(node);
+            else
+                throw ParseException("value", m_tokenStart);
+        }
+        valueComplete();
+    }
+
+    /*
+     * Make sure that the right container is closed
+     */
+    void JsonEventParser::endContainer(char c, size_t offset) {
+        char open = c == '}' ? '{' : '[';
+        if (m_containers.back() != open)
+            throw ParseException(m_containers.back() == '{' ? ",}" : ",]", offset);
+
+        m_containers.pop_back();
+        if (c == '}')
+            m_handler->endObject();
+        else
+            m_handler->endArray();
+        valueComplete();
+    }
+
+    /*
+     * Either another value or the end of the container follows, unless it was a top level value
+     */
+    void JsonEventParser::valueComplete() {
+        if (m_containers.empty()) {
+            m_state = State::VALUE;
+            m_handler->endDocument();
+        } else {
+            m_state = State::NEXT;
+        }
+    }
+}
@@ -1,18 +1,49 @@
 #include "dom/json/JsonParser.h"
 #include "dom/DomException.h"
 
+#include <charconv>
+
 namespace cadf::dom::json {
 
+    /*
+     * Append the code point to the string as UTF-8. Surrogates cannot be encoded, as such a lone surrogate is replaced by U+FFFD
+     */
+    template<typename String>
+    static void appendUtf8(String &str, unsigned long codePoint) {
+        if (codePoint >= 0xD800 && codePoint < 0xE000)
+            codePoint = 0xFFFD;
+
+        if (codePoint < 0x80) {
+            str += char(codePoint);
+        } else if (codePoint < 0x800) {
+            str += char(0xC0 | (codePoint >> 6));
+            str += char(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            str += char(0xE0 | (codePoint >> 12));
+            str += char(0x80 | ((codePoint >> 6) & 0x3F));
+            str += char(0x80 | (codePoint & 0x3F));
+        } else {
+            str += char(0xF0 | (codePoint >> 18));
+            str += char(0x80 | ((codePoint >> 12) & 0x3F));
+            str += char(0x80 | ((codePoint >> 6) & 0x3F));
+            str += char(0x80 | (codePoint & 0x3F));
+        }
+    }
+
     /*
      * CTOR
      */
-    JsonParser::JsonParser(const std::string &json): m_input(json), m_currIndex(0) {
+    JsonParser::JsonParser(std::string_view json, Mode mode, const DomNode::allocator_type &alloc): m_input(json), m_currIndex(0), m_mode(mode),
+            m_currEntry(0), m_allocator(alloc) {
     }
 
     /*
      * Parse the string and create a DOM tree
      */
     DomNode JsonParser::parse() {
+        if (m_mode == Mode::INDEXED && m_input.size() <= StructuralIndex::MAX_SIZE)
+            return parseIndexed();
+
         if (nextCharSkipSpace() != '{')
             throwExpectedCharException("{");
 
@@ -23,20 +54,21 @@ namespace cadf::dom::json {
      * Load the next value pair from the input.
      */
     DomNode JsonParser::loadNext() {
-        DomNode parent;
+        DomNode parent(m_allocator);
         do {
             // The pair must start with a string (name:value)
-            std::string name = loadString();
+            DomKey name = loadKey();
 
             // There must be a ":" separating the name and value
             if (nextCharSkipSpace() !=  ':')
                 throwExpectedCharException(":");
 
             // Load the actual value
-            parent[name] = loadValue();
+            parent.appendChild(name, loadValue());
 
             // Continue until no more values ("," denotes another value is coming up)
         } while(nextCharSkipSpace() == ',');
+        parent.sortChildren();
         // Since the above will "consume" the last seen char, return so that we can verify the input properly
         prevChar();
 
@@ -52,9 +84,9 @@ namespace cadf::dom::json {
      */
     DomNode JsonParser::loadArray() {
         // Same as loadNext except that it is just a comma separated list of values all under the previously determined name
-        std::vector<DomNode> arrVals;
+        DomNode arrVals = DomNode::makeArray(m_allocator);
         do {
-            arrVals.push_back(loadValue());
+            arrVals.addArrayElement(loadValue());
         } while(nextCharSkipSpace() == ',');
         prevChar();
 
@@ -62,7 +94,7 @@ namespace cadf::dom::json {
         if (nextCharSkipSpace() != ']')
             throwExpectedCharException("]");
 
-        return DomNode(arrVals);
+        return arrVals;
     }
 
     /*
@@ -91,13 +123,11 @@ namespace cadf::dom::json {
                 throwException("value");
                 break;
             case '"':
-                return DomNode(loadString(), true);
+                return DomNode(loadString());
             default:
-                std::string loaded = loadUntilNoSpace(",}]");
+                std::string_view loaded = loadUntilNoSpace(",}]");
                 prevChar();
-                if (loaded == "null")
-                    return DomNode();
-                return DomNode(loaded, false);
+                return DomNode::fromLiteral(loaded, m_allocator);
         }
 
         return DomNode();
@@ -106,32 +136,153 @@ namespace cadf::dom::json {
     /*
      * Load a string from the input
      */
-    std::string JsonParser::loadString() {
+    std::pmr::string JsonParser::loadString() {
         if (nextCharSkipSpace() != '"')
             throwExpectedCharException("\"");
 
-        return loadUntilWithSpace("\"");
+        bool hasEscape;
+        std::string_view raw = sliceString(hasEscape);
+        return decodeString(raw, hasEscape);
     }
 
     /*
-     * Load until a specified terminator has been reached
+     * Load a name from the input
      */
-    std::string JsonParser::loadUntilWithSpace(const std::string &terminators) {
-        std::stringstream ss;
-        char c = nextChar(false);
-        while (!checkIfTerminator(c, terminators)) {
-            ss << c;
-            c = nextChar();
+    DomKey JsonParser::loadKey() {
+        if (nextCharSkipSpace() != '"')
+            throwExpectedCharException("\"");
+
+        bool hasEscape;
+        std::string_view raw = sliceString(hasEscape);
+        return decodeKey(raw, hasEscape);
+    }
+
+    /*
+     * Slice the string out of the input, skipping over any escaped characters
+     */
+    std::string_view JsonParser::sliceString(bool &hasEscape) {
+        hasEscape = false;
+        size_t start = m_currIndex;
+        size_t end = m_input.find_first_of("\"\\", start);
+        while (end != std::string::npos && m_input[end] == '\\') {
+            hasEscape = true;
+            end = m_input.find_first_of("\"\\", end + 2);
+        }
+
+        if (end == std::string::npos) {
+            m_currIndex = m_input.size();
+            throwExpectedCharException("\"");
         }
-        return ss.str();
+
+        m_currIndex = end + 1;
+        return std::string_view(m_input).substr(start, end - start);
+    }
+
+    /*
+     * Materialize the string directly into the allocator of the tree, decoding it only when required
+     */
+    std::pmr::string JsonParser::decodeString(std::string_view raw, bool hasEscape) const {
+        if (!hasEscape)
+            return std::pmr::string(raw, m_allocator);
+
+        std::pmr::string decoded(m_allocator);
+        decoded.reserve(raw.size());
+        decodeEscapes(raw, decoded, raw.data() - m_input.data());
+        return decoded;
+    }
+
+    /*
+     * Intern the name straight from the input, only decoding it when required
+     */
+    DomKey JsonParser::decodeKey(std::string_view raw, bool hasEscape) const {
+        if (!hasEscape)
+            return DomKey(raw);
+
+        std::pmr::string decoded(m_allocator);
+        decoded.reserve(raw.size());
+        decodeEscapes(raw, decoded, raw.data() - m_input.data());
+        return DomKey(decoded);
+    }
+
+    /*
+     * Decode the escape sequences, copying the runs of plain characters between them as is
+     */
+    template<typename String>
+    static void decodeEscapesInto(std::string_view raw, String &decoded, size_t offset) {
+        size_t runStart = 0;
+        for (size_t i = 0; i < raw.size(); i++) {
+            if (raw[i] != '\\')
+                continue;
+
+            // Copy the run of plain characters preceding the escape in one go
+            decoded.append(raw, runStart, i - runStart);
+            switch (raw[++i]) {
+                case '"':
+                case '\\':
+                case '/':
+                    decoded += raw[i];
+                    break;
+                case 'b':
+                    decoded += '\b';
+                    break;
+                case 'f':
+                    decoded += '\f';
+                    break;
+                case 'n':
+                    decoded += '\n';
+                    break;
+                case 'r':
+                    decoded += '\r';
+                    break;
+                case 't':
+                    decoded += '\t';
+                    break;
+                case 'u': {
+                    unsigned long codePoint = 0;
+                    if (i + 4 >= raw.size() || std::from_chars(raw.data() + i + 1, raw.data() + i + 5, codePoint, 16).ptr != raw.data() + i + 5)
+                        throw ParseException("\\uXXXX", offset + i);
+                    i += 4;
+
+                    // Combine a surrogate pair into the single code point it represents
+                    unsigned long lowSurrogate = 0;
+                    if (codePoint >= 0xD800 && codePoint < 0xDC00 && i + 6 < raw.size() && raw[i + 1] == '\\' && raw[i + 2] == 'u'
+                            && std::from_chars(raw.data() + i + 3, raw.data() + i + 7, lowSurrogate, 16).ptr == raw.data() + i + 7
+                            && lowSurrogate >= 0xDC00 && lowSurrogate < 0xE000) {
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                        i += 6;
+                    }
+                    appendUtf8(decoded, codePoint);
+                    break;
+                }
+                default:
+                    throw ParseException("escape sequence", offset + i);
+            }
+            runStart = i + 1;
+        }
+        decoded.append(raw, runStart, raw.size() - runStart);
+    }
+
+    /*
+     * Decode into the tree's string
+     */
+    void JsonParser::decodeEscapes(std::string_view raw, std::pmr::string &decoded, size_t offset) {
+        decodeEscapesInto(raw, decoded, offset);
+    }
+
+    /*
+     * Decode into a standard string
+     */
+    void JsonParser::decodeEscapes(std::string_view raw, std::string &decoded, size_t offset) {
+        decodeEscapesInto(raw, decoded, offset);
     }
 
     /*
      * Load until a specified terminator has been reached
      */
-    std::string JsonParser::loadUntilNoSpace(const std::string &terminators) {
-        std::stringstream ss;
+    std::string_view JsonParser::loadUntilNoSpace(const std::string &terminators) {
         char c = nextChar(true);
+        size_t start = m_currIndex - 1;
+        size_t end = start;
 
         bool foundInnerSpace = false;
         while (true) {
@@ -142,11 +293,11 @@ namespace cadf::dom::json {
             } else {
                 if (foundInnerSpace)
                     throwExpectedCharException(terminators);
-                ss << c;
+                end = m_currIndex;
             }
             c = nextChar();
         }
-        return ss.str();
+        return std::string_view(m_input).substr(start, end - start);
     }
 
     /*
@@ -197,6 +348,156 @@ namespace cadf::dom::json {
         m_currIndex--;
     }
 
+    /*
+     * Parse via the structural index
+     */
+    DomNode JsonParser::parseIndexed() {
+        m_index.build(m_input.data(), m_input.size());
+        m_currEntry = 0;
+        m_currIndex = 0;
+
+        if (currentStructural() != '{' || !isGapEmpty())
+            throwExpectedCharException("{");
+
+        return loadIndexedObject();
+    }
+
+    /*
+     * Load an object from the index
+     */
+    DomNode JsonParser::loadIndexedObject() {
+        consumeStructural("{");
+
+        DomNode parent(m_allocator);
+        if (currentStructural() == '}' && isGapEmpty()) {
+            consumeStructural("}");
+            return parent;
+        }
+
+        do {
+            DomKey name = loadIndexedKey();
+            consumeStructural(":");
+            parent.appendChild(name, loadIndexedValue());
+        } while (consumeStructural(",}") == ',');
+        parent.sortChildren();
+
+        return parent;
+    }
+
+    /*
+     * Load an array from the index
+     */
+    DomNode JsonParser::loadIndexedArray() {
+        consumeStructural("[");
+
+        DomNode arrVals = DomNode::makeArray(m_allocator);
+        if (currentStructural() != ']' || !isGapEmpty()) {
+            do {
+                arrVals.addArrayElement(loadIndexedValue());
+            } while (consumeStructural(",]") == ',');
+        } else {
+            consumeStructural("]");
+        }
+
+        return arrVals;
+    }
+
+    /*
+     * Load a value from the index. Literals are not indexed, they are whatever lies between two structural characters.
+     */
+    DomNode JsonParser::loadIndexedValue() {
+        if (isGapEmpty()) {
+            switch (currentStructural()) {
+                case '{':
+                    return loadIndexedObject();
+                case '[':
+                    return loadIndexedArray();
+                case '"':
+                    return DomNode(loadIndexedString());
+                default:
+                    throwException("value");
+            }
+        }
+
+        size_t start = m_currIndex;
+        size_t end = m_index[m_currEntry];
+        while (isspace(m_input[start]))
+            start++;
+        while (isspace(m_input[end - 1]))
+            end--;
+        for (size_t i = start; i < end; i++) {
+            if (isspace(m_input[i])) {
+                m_currIndex = i;
+                throwException("',', '}', ']'");
+            }
+        }
+        m_currIndex = end;
+
+        std::string_view loaded = std::string_view(m_input).substr(start, end - start);
+        return DomNode::fromLiteral(loaded, m_allocator);
+    }
+
+    /*
+     * Load a string from the index
+     */
+    std::pmr::string JsonParser::loadIndexedString() {
+        consumeStructural("\"");
+        // Nothing within a string is indexed, so the next entry must be the closing quote
+        if (currentStructural() != '"')
+            throwExpectedCharException("\"");
+
+        std::string_view raw = std::string_view(m_input).substr(m_currIndex, m_index[m_currEntry] - m_currIndex);
+        m_currIndex = m_index[m_currEntry++] + 1;
+        return decodeString(raw, raw.find('\\') != std::string_view::npos);
+    }
+
+    /*
+     * Load a name from the index
+     */
+    DomKey JsonParser::loadIndexedKey() {
+        consumeStructural("\"");
+        // Nothing within a string is indexed, so the next entry must be the closing quote
+        if (currentStructural() != '"')
+            throwExpectedCharException("\"");
+
+        std::string_view raw = std::string_view(m_input).substr(m_currIndex, m_index[m_currEntry] - m_currIndex);
+        m_currIndex = m_index[m_currEntry++] + 1;
+        return decodeKey(raw, raw.find('\\') != std::string_view::npos);
+    }
+
+    /*
+     * Get the current structural character
+     */
+    char JsonParser::currentStructural() const {
+        if (m_currEntry >= m_index.size() - 1)
+            return '\0';
+        return m_input[m_index[m_currEntry]];
+    }
+
+    /*
+     * Consume the current structural character
+     */
+    char JsonParser::consumeStructural(const std::string &expected) {
+        char c = currentStructural();
+        if (c == '\0' || !checkIfTerminator(c, expected) || !isGapEmpty())
+            throwExpectedCharException(expected);
+
+        m_currIndex = m_index[m_currEntry++] + 1;
+        return c;
+    }
+
+    /*
+     * Check if only whitespace lies before the current structural character
+     */
+    bool JsonParser::isGapEmpty() const {
+        size_t end = m_index[m_currEntry < m_index.size() ? m_currEntry : m_index.size() - 1];
+        for (size_t i = m_currIndex; i < end; i++) {
+            if (!isspace(m_input[i]))
+                return false;
+        }
+        return true;
+    }
+
     /*
      * Throw an exception.
      */
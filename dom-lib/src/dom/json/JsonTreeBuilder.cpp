@@ -0,0 +1,106 @@
+#include "dom/json/JsonTreeBuilder.h"
+
+#include <utility>
+
+namespace cadf::dom::json {
+
+    /*
+     * CTOR
+     */
+    JsonTreeBuilder::JsonTreeBuilder(std::function<void(DomNode&&)> callback, const DomNode::allocator_type &alloc): m_callback(callback),
+            m_allocator(alloc) {
+    }
+
+    /*
+     * Start building the object
+     */
+    void JsonTreeBuilder::startObject() {
+        m_containers.emplace_back(m_allocator);
+    }
+
+    /*
+     * The children were appended as they came, sort them now that they are all present
+     */
+    void JsonTreeBuilder::endObject() {
+        DomNode object = std::move(m_containers.back());
+        m_containers.pop_back();
+        object.sortChildren();
+        addValue(std::move(object));
+    }
+
+    /*
+     * Start building the array
+     */
+    void JsonTreeBuilder::startArray() {
+        m_containers.push_back(DomNode::makeArray(m_allocator));
+    }
+
+    /*
+     * The array is complete
+     */
+    void JsonTreeBuilder::endArray() {
+        DomNode array = std::move(m_containers.back());
+        m_containers.pop_back();
+        addValue(std::move(array));
+    }
+
+    /*
+     * Intern the name, retaining it until the value is complete
+     */
+    void JsonTreeBuilder::key(std::string_view name) {
+        m_keys.emplace_back(name);
+    }
+
+    /*
+     * Add a null value
+     */
+    void JsonTreeBuilder::nullValue() {
+        addValue(DomNode(m_allocator));
+    }
+
+    /*
+     * Add a boolean value
+     */
+    void JsonTreeBuilder::boolValue(bool value) {
+        addValue(value);
+    }
+
+    /*
+     * Add an integer value
+     */
+    void JsonTreeBuilder::integerValue(int64_t value) {
+        addValue(value);
+    }
+
+    /*
+     * Add a double value
+     */
+    void JsonTreeBuilder::doubleValue(double value) {
+        addValue(value);
+    }
+
+    /*
+     * Add a string value
+     */
+    void JsonTreeBuilder::stringValue(std::string_view value) {
+        addValue(DomNode(std::pmr::string(value, m_allocator)));
+    }
+
+    /*
+     * Add the value to the current container, or hand it over if there is none
+     */
+    void JsonTreeBuilder::addValue(DomNode &&value) {
+        if (m_containers.empty()) {
+            m_callback(std::move(value));
+            return;
+        }
+
+        DomNode &container = m_containers.back();
+        if (container.isArray()) {
+            container.addArrayElement(std::move(value));
+        } else {
+            container.appendChild(m_keys.back(), std::move(value));
+            m_keys.pop_back();
+        }
+    }
+}
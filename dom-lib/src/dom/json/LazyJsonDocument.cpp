@@ -0,0 +1,213 @@
+#include "dom/json/LazyJsonDocument.h"
+#include "dom/json/JsonEventParser.h"
+#include "dom/json/JsonParser.h"
+#include "dom/json/JsonTreeBuilder.h"
+#include "dom/DomException.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace cadf::dom::json {
+
+    /*
+     * Check whether there is only whitespace in the specified range of the input
+     */
+    static bool isBlank(std::string_view json, size_t from, size_t to) {
+        for (size_t i = from; i < to; i++) {
+            if (!isspace((unsigned char) json[i]))
+                return false;
+        }
+        return true;
+    }
+
+    /*
+     * CTOR - only the top level is indexed
+     */
+    LazyJsonDocument::LazyJsonDocument(std::string_view json): m_json(json) {
+        StructuralIndex index;
+        index.build(m_json.data(), m_json.size());
+        indexChildren(index);
+    }
+
+    /*
+     * Look for the child
+     */
+    bool LazyJsonDocument::hasChild(std::string_view name) const {
+        std::vector<Child>::const_iterator it = std::lower_bound(m_children.begin(), m_children.end(), name, [](const Child &child, std::string_view name) {
+            return child.name < name;
+        });
+        return it != m_children.end() && it->name == name;
+    }
+
+    /*
+     * Access the child, parsing it on first access
+     */
+    const DomNode& LazyJsonDocument::operator[](const std::string &name) const {
+        return parseChild(findChild(name));
+    }
+
+    /*
+     * Access the child, parsing it on first access
+     */
+    const DomNode& LazyJsonDocument::operator[](const char *name) const {
+        return parseChild(findChild(name));
+    }
+
+    /*
+     * Get the raw value
+     */
+    std::string_view LazyJsonDocument::getRaw(std::string_view name) const {
+        return findChild(name).raw;
+    }
+
+    /*
+     * Check if the child was parsed
+     */
+    bool LazyJsonDocument::isParsed(std::string_view name) const {
+        return findChild(name).value.has_value();
+    }
+
+    /*
+     * Parse everything that was not yet parsed, copying the children into the tree. The children are already sorted
+     */
+    DomNode LazyJsonDocument::toDomNode() const {
+        DomNode root;
+        for (const Child &child : m_children)
+            root.appendChild(child.name, DomNode(parseChild(child)));
+        return root;
+    }
+
+    /*
+     * Binary search for the child
+     */
+    const LazyJsonDocument::Child& LazyJsonDocument::findChild(std::string_view name) const {
+        std::vector<Child>::const_iterator it = std::lower_bound(m_children.begin(), m_children.end(), name, [](const Child &child, std::string_view name) {
+            return child.name < name;
+        });
+        if (it == m_children.end() || it->name != name)
+            throw std::out_of_range("No child named " + std::string(name));
+        return *it;
+    }
+
+    /*
+     * Parse the raw value of the child via the event parser, as it can be any type of value
+     */
+    const DomNode& LazyJsonDocument::parseChild(const Child &child) const {
+        if (child.value)
+            return *child.value;
+
+        size_t offset = child.raw.data() - m_json.data();
+        std::optional<DomNode> value;
+        JsonTreeBuilder builder([&value, offset](DomNode &&parsed) {
+            // The value of a literal can contain whitespace, which would split it in two
+            if (value)
+                throw ParseException("',', '}'", offset);
+            value.emplace(std::move(parsed));
+        });
+        JsonEventParser parser(&builder);
+        parser.feed(child.raw);
+        parser.finish();
+
+        child.value = std::move(value);
+        return *child.value;
+    }
+
+    /*
+     * Walk through the structural characters of the top level, skipping over nested objects and arrays by tracking
+     * their depth. Strings do not require any special handling, as the index only contains their quotes.
+     */
+    void LazyJsonDocument::indexChildren(const StructuralIndex &index) {
+        size_t last = index.size() - 1;
+        size_t entry = 0;
+        size_t pos = 0;
+        auto current = [&]() {
+            return entry < last && isBlank(m_json, pos, index[entry]) ? m_json[index[entry]] : '\0';
+        };
+        auto consume = [&](const std::string &expected) {
+            char c = current();
+            if (c == '\0' || expected.find(c) == std::string::npos)
+                throw ParseException("'" + expected + "'", entry < last ? index[entry] : m_json.size());
+            pos = index[entry++] + 1;
+            return c;
+        };
+
+        consume("{");
+        if (current() == '}')
+            return;
+
+        do {
+            // Name
+            size_t nameStart = index[entry] + 1;
+            consume("\"");
+            if (entry >= last || m_json[index[entry]] != '"')
+                throw ParseException("'\"'", m_json.size());
+            std::string_view rawName = m_json.substr(nameStart, index[entry] - nameStart);
+            pos = index[entry++] + 1;
+            std::string name(rawName);
+            if (rawName.find('\\') != std::string_view::npos) {
+                std::pmr::string decoded;
+                JsonParser::decodeEscapes(rawName, decoded, nameStart);
+                name.assign(decoded.data(), decoded.size());
+            }
+            consume(":");
+
+            // Value
+            size_t valueStart = pos;
+            switch (current()) {
+                case '{':
+                case '[': {
+                    valueStart = index[entry];
+                    int depth = 0;
+                    do {
+                        if (entry >= last)
+                            throw ParseException("'}', ']'", m_json.size());
+                        char c = m_json[index[entry]];
+                        if (c == '{' || c == '[')
+                            depth++;
+                        else if (c == '}' || c == ']')
+                            depth--;
+                        pos = index[entry++] + 1;
+                    } while (depth > 0);
+                    break;
+                }
+                case '"':
+                    valueStart = index[entry];
+                    consume("\"");
+                    if (entry >= last || m_json[index[entry]] != '"')
+                        throw ParseException("'\"'", m_json.size());
+                    pos = index[entry++] + 1;
+                    break;
+                case '\0': {
+                    // Literal, lasting until the next structural character
+                    size_t end = entry < last ? index[entry] : m_json.size();
+                    while (valueStart < end && isspace((unsigned char) m_json[valueStart]))
+                        valueStart++;
+                    while (end > valueStart && isspace((unsigned char) m_json[end - 1]))
+                        end--;
+                    if (valueStart == end)
+                        throw ParseException("value", valueStart);
+                    pos = end;
+                    break;
+                }
+                default:
+                    throw ParseException("value", index[entry]);
+            }
+            m_children.push_back(Child { std::move(name), m_json.substr(valueStart, pos - valueStart), std::nullopt });
+        } while (consume(",}") == ',');
+
+        // As with DomNode, the last of any duplicates is retained
+        std::stable_sort(m_children.begin(), m_children.end(), [](const Child &lhs, const Child &rhs) {
+            return lhs.name < rhs.name;
+        });
+        std::vector<Child>::iterator out = m_children.begin();
+        for (std::vector<Child>::iterator it = m_children.begin(); it != m_children.end(); ++it) {
+            if (it + 1 != m_children.end() && (it + 1)->name == it->name)
+                continue;
+            if (out != it)
+                *out = std::move(*it);
+            ++out;
+        }
+        m_children.erase(out, m_children.end());
+    }
+}
@@ -0,0 +1,208 @@
+#include "dom/json/StructuralIndex.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#   define DOM_JSON_X86
+#   include <immintrin.h>
+#endif
+
+namespace cadf::dom::json {
+
+    namespace {
+        // The number of characters that are classified at once
+        const size_t BLOCK_SIZE = 64;
+
+        /*
+         * The classification of a block of input, one bit per character
+         */
+        struct BlockMasks {
+            uint64_t quote;
+            uint64_t backslash;
+            uint64_t structural;
+        };
+
+        typedef BlockMasks (*Classifier)(const char *block);
+
+        /*
+         * Classify one character at a time
+         */
+        BlockMasks classifyScalar(const char *block) {
+            BlockMasks masks = { 0, 0, 0 };
+            for (size_t i = 0; i < BLOCK_SIZE; i++) {
+                uint64_t bit = uint64_t(1) << i;
+                switch (block[i]) {
+                    case '"':
+                        masks.quote |= bit;
+                        break;
+                    case '\\':
+                        masks.backslash |= bit;
+                        break;
+                    case '{':
+                    case '}':
+                    case '[':
+                    case ']':
+                    case ':':
+                    case ',':
+                        masks.structural |= bit;
+                        break;
+                }
+            }
+            return masks;
+        }
+
+#ifdef DOM_JSON_X86
+        /*
+         * Classify 16 characters at a time
+         */
+        __attribute__((target("sse2")))
+        BlockMasks classifySse2(const char *block) {
+            BlockMasks masks = { 0, 0, 0 };
+            for (size_t i = 0; i < BLOCK_SIZE; i += 16) {
+                __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+                __m128i structural = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('{')), _mm_cmpeq_epi8(in, _mm_set1_epi8('}'))),
+                        _mm_or_si128(
+                            _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('[')), _mm_cmpeq_epi8(in, _mm_set1_epi8(']'))),
+                            _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(':')), _mm_cmpeq_epi8(in, _mm_set1_epi8(',')))));
+                masks.quote |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('"'))))) << i;
+                masks.backslash |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(in, _mm_set1_epi8('\\'))))) << i;
+                masks.structural |= uint64_t(uint16_t(_mm_movemask_epi8(structural))) << i;
+            }
+            return masks;
+        }
+
+        /*
+         * Classify 32 characters at a time
+         */
+        __attribute__((target("avx2")))
+        BlockMasks classifyAvx2(const char *block) {
+            BlockMasks masks = { 0, 0, 0 };
+            for (size_t i = 0; i < BLOCK_SIZE; i += 32) {
+                __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+                __m256i structural = _mm256_or_si256(
+                        _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('{')), _mm256_cmpeq_epi8(in, _mm256_set1_epi8('}'))),
+                        _mm256_or_si256(
+                            _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('[')), _mm256_cmpeq_epi8(in, _mm256_set1_epi8(']'))),
+                            _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8(':')), _mm256_cmpeq_epi8(in, _mm256_set1_epi8(',')))));
+                masks.quote |= uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('"'))))) << i;
+                masks.backslash |= uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('\\'))))) << i;
+                masks.structural |= uint64_t(uint32_t(_mm256_movemask_epi8(structural))) << i;
+            }
+            return masks;
+        }
+#endif
+
+        /*
+         * Select the classifier for the kernel
+         */
+        Classifier selectClassifier(StructuralIndex::Kernel kernel) {
+            if (!StructuralIndex::isSupported(kernel))
+                kernel = StructuralIndex::Kernel::AUTO;
+
+            switch (kernel) {
+#ifdef DOM_JSON_X86
+                case StructuralIndex::Kernel::AVX2:
+                    return classifyAvx2;
+                case StructuralIndex::Kernel::SSE2:
+                    return classifySse2;
+                case StructuralIndex::Kernel::AUTO:
+                    if (StructuralIndex::isSupported(StructuralIndex::Kernel::AVX2))
+                        return classifyAvx2;
+                    if (StructuralIndex::isSupported(StructuralIndex::Kernel::SSE2))
+                        return classifySse2;
+                    return classifyScalar;
+#endif
+                default:
+                    return classifyScalar;
+            }
+        }
+
+        /*
+         * Determine which characters are escaped by a preceding backslash. A run of backslashes escapes the character after it
+         * only if the run is of odd length, so the runs are classified by whether they start on an odd or even bit. The carry
+         * indicates that the first character of the next block is escaped.
+         */
+        uint64_t findEscaped(uint64_t backslash, uint64_t &carry) {
+            const uint64_t evenBits = 0x5555555555555555ULL;
+
+            backslash &= ~carry;
+            uint64_t followsEscape = backslash << 1 | carry;
+            uint64_t oddSequenceStarts = backslash & ~evenBits & ~followsEscape;
+            uint64_t sequencesStartingOnEvenBits;
+            carry = __builtin_add_overflow(oddSequenceStarts, backslash, &sequencesStartingOnEvenBits) ? 1 : 0;
+            uint64_t invertMask = sequencesStartingOnEvenBits << 1;
+            return (evenBits ^ invertMask) & followsEscape;
+        }
+
+        /*
+         * Each bit becomes the XOR of itself and all bits below it, turning quote positions into a mask of string content
+         */
+        uint64_t prefixXor(uint64_t bits) {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+    }
+
+    /*
+     * Check if the kernel is supported
+     */
+    bool StructuralIndex::isSupported(Kernel kernel) {
+        switch (kernel) {
+            case Kernel::AUTO:
+            case Kernel::SCALAR:
+                return true;
+#ifdef DOM_JSON_X86
+            case Kernel::SSE2:
+                return __builtin_cpu_supports("sse2");
+            case Kernel::AVX2:
+                return __builtin_cpu_supports("avx2");
+#endif
+            default:
+                return false;
+        }
+    }
+
+    /*
+     * Build the index (stage 1 of the indexed parse)
+     */
+    void StructuralIndex::build(const char *data, size_t size, Kernel kernel) {
+        if (size > MAX_SIZE)
+            throw std::length_error("JSON input is too large to index");
+
+        Classifier classify = selectClassifier(kernel);
+        m_positions.clear();
+        m_positions.reserve(size / 4 + 2);
+
+        uint64_t escapeCarry = 0;
+        uint64_t inStringCarry = 0;
+        char lastBlock[BLOCK_SIZE];
+        for (size_t base = 0; base < size; base += BLOCK_SIZE) {
+            const char *block = data + base;
+            if (size - base < BLOCK_SIZE) {
+                // Pad the final partial block with whitespace, which is never indexed
+                memset(lastBlock, ' ', BLOCK_SIZE);
+                memcpy(lastBlock, block, size - base);
+                block = lastBlock;
+            }
+
+            BlockMasks masks = classify(block);
+            uint64_t quotes = masks.quote & ~findEscaped(masks.backslash, escapeCarry);
+            uint64_t inString = prefixXor(quotes) ^ inStringCarry;
+            inStringCarry = uint64_t(int64_t(inString) >> 63);
+
+            uint64_t bits = (masks.structural & ~inString) | quotes;
+            while (bits) {
+                m_positions.push_back(uint32_t(base + __builtin_ctzll(bits)));
+                bits &= bits - 1;
+            }
+        }
+        m_positions.push_back(uint32_t(size));
+    }
+}
@@ -0,0 +1,41 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/DomBuilder.h"
+#include "dom/json/JsonConverter.h"
+
+BOOST_AUTO_TEST_SUITE(DomBuilder_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(BuildObjectTest) {
+        cadf::dom::DomBuilder builder;
+        cadf::dom::DomNode node = builder.add("c", 3).add("a", "x").add("b", cadf::dom::DomBuilder().addElement(1).addElement(true).build()).add("a", 1).build();
+        BOOST_CHECK_EQUAL("{\"a\":1,\"b\":[1,true],\"c\":3}", cadf::dom::json::JsonConverter::instance()->toString(node));
+
+        // The builder is left ready for the next node
+        cadf::dom::DomNode next = builder.build();
+        BOOST_CHECK(next.isNull());
+        BOOST_CHECK_EQUAL("{\"d\":null}", cadf::dom::json::JsonConverter::instance()->toString(builder.add("d", cadf::dom::DomNode()).build()));
+    }
+
+    BOOST_AUTO_TEST_CASE(BuildWithoutCopyTest) {
+        cadf::dom::DomNode subtree;
+        subtree["value"] = "a string long enough to be allocated";
+        const char *data = subtree["value"].getValue().data();
+
+        cadf::dom::DomNode node = cadf::dom::DomBuilder().add("subtree", std::move(subtree)).build();
+        BOOST_CHECK_EQUAL(data, node["subtree"]["value"].getValue().data());
+    }
+
+    BOOST_AUTO_TEST_CASE(BuildIntoAllocatorTest) {
+        std::pmr::monotonic_buffer_resource arena;
+        cadf::dom::DomNode::allocator_type alloc(&arena);
+        cadf::dom::DomNode node = cadf::dom::DomBuilder(alloc).add("a", cadf::dom::DomNode("b", true, alloc)).build();
+        BOOST_CHECK(node.getAllocator() == alloc);
+        BOOST_CHECK(node["a"].getAllocator() == alloc);
+        BOOST_CHECK_EQUAL("b", node["a"].operator std::string());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/DomConverter.h"
+#include "dom/DomException.h"
+#include "dom/MappedFile.h"
+#include "dom/json/JsonConverter.h"
+#include "dom/cbor/CborConverter.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <system_error>
+#include <unistd.h>
+
+namespace DomConverterTest {
+
+    /**
+     * Temporary file which is removed once the test is done with it
+     */
+    struct TempFile {
+        std::string path;
+
+        TempFile() {
+            char name[] = "/tmp/DomConverterTestXXXXXX";
+            int fd = mkstemp(name);
+            BOOST_REQUIRE(fd >= 0);
+            close(fd);
+            path = name;
+        }
+
+        ~TempFile() {
+            unlink(path.c_str());
+        }
+
+        void write(const std::string &contents) {
+            FILE *file = fopen(path.c_str(), "wb");
+            BOOST_REQUIRE(file);
+            fwrite(contents.data(), 1, contents.size(), file);
+            fclose(file);
+        }
+    };
+
+    /**
+     * Converter which only implements the mandatory methods, to exercise the default implementations
+     */
+    class MinimalConverter: public cadf::dom::DomConverter {
+        public:
+            size_t size(const cadf::dom::DomNode &node) {
+                return toString(node).size();
+            }
+
+            std::string toString(const cadf::dom::DomNode &node) {
+                return std::string(node.getValue());
+            }
+
+            cadf::dom::DomNode fromString(const std::string &dataString) {
+                return cadf::dom::DomNode(dataString);
+            }
+    };
+
+    /**
+     * Get the JSON representation of the tree, for the purpose of comparison
+     */
+    std::string toJson(const cadf::dom::DomNode &node) {
+        return cadf::dom::json::JsonConverter::instance()->toString(node);
+    }
+
+    /**
+     * Build a tree to write out
+     */
+    cadf::dom::DomNode buildTree() {
+        cadf::dom::DomNode root;
+        root["name"] = "value";
+        root["int"] = 123;
+        root["list"] = std::vector<double> { 1.5, -2.25 };
+        root["nested"]["flag"] = true;
+        return root;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(DomConverter_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(MappedFileTest) {
+        DomConverterTest::TempFile file;
+        file.write("abc\0def");
+        {
+            cadf::dom::MappedFile mapped(file.path);
+            BOOST_CHECK_EQUAL(3, mapped.size());
+            BOOST_CHECK_EQUAL("abc", mapped.data());
+        }
+
+        file.write(std::string("abc\0def", 7));
+        cadf::dom::MappedFile mapped(file.path);
+        BOOST_CHECK_EQUAL(7, mapped.size());
+        BOOST_CHECK(std::string("abc\0def", 7) == mapped.data());
+    }
+
+    BOOST_AUTO_TEST_CASE(MappedEmptyFileTest) {
+        DomConverterTest::TempFile file;
+        cadf::dom::MappedFile mapped(file.path);
+        BOOST_CHECK_EQUAL(0, mapped.size());
+        BOOST_CHECK(mapped.data().empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(MappedMissingFileTest) {
+        BOOST_CHECK_THROW(cadf::dom::MappedFile("/nonexistent/DomConverterTest"), std::system_error);
+    }
+
+    BOOST_AUTO_TEST_CASE(JsonFileRoundTripTest) {
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        DomConverterTest::TempFile file;
+        cadf::dom::DomNode root = DomConverterTest::buildTree();
+        converter->toFile(root, file.path);
+        BOOST_CHECK_EQUAL(converter->size(root), cadf::dom::MappedFile(file.path).size());
+        BOOST_CHECK_EQUAL(converter->toString(root), cadf::dom::MappedFile(file.path).data());
+
+        cadf::dom::DomNode loaded = converter->fromFile(file.path);
+        BOOST_CHECK_EQUAL(DomConverterTest::toJson(root), DomConverterTest::toJson(loaded));
+
+        cadf::dom::DomDocument document;
+        converter->fromFile(file.path, &document);
+        BOOST_CHECK_EQUAL(DomConverterTest::toJson(root), DomConverterTest::toJson(document.getRoot()));
+    }
+
+    BOOST_AUTO_TEST_CASE(CborFileRoundTripTest) {
+        cadf::dom::cbor::CborConverter *converter = cadf::dom::cbor::CborConverter::instance();
+        DomConverterTest::TempFile file;
+        cadf::dom::DomNode root = DomConverterTest::buildTree();
+        converter->toFile(root, file.path);
+        BOOST_CHECK_EQUAL(converter->size(root), cadf::dom::MappedFile(file.path).size());
+
+        cadf::dom::DomDocument document;
+        converter->fromFile(file.path, &document);
+        BOOST_CHECK_EQUAL(DomConverterTest::toJson(root), DomConverterTest::toJson(document.getRoot()));
+        BOOST_CHECK_EQUAL(DomConverterTest::toJson(root), DomConverterTest::toJson(converter->fromFile(file.path)));
+    }
+
+    BOOST_AUTO_TEST_CASE(ToFileReplacesContentsTest) {
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        DomConverterTest::TempFile file;
+        file.write(std::string(1000, 'x'));
+        cadf::dom::DomNode root;
+        root["a"] = 1;
+        converter->toFile(root, file.path);
+        BOOST_CHECK_EQUAL("{\"a\":1}", cadf::dom::MappedFile(file.path).data());
+    }
+
+    BOOST_AUTO_TEST_CASE(LargeFileTest) {
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        DomConverterTest::TempFile file;
+        cadf::dom::DomNode root;
+        for (int i = 0; i < 5000; i++)
+            root["key" + std::to_string(i)]["value"] = "some value " + std::to_string(i);
+        // Larger than the write buffer
+        converter->toFile(root, file.path);
+        BOOST_CHECK(cadf::dom::MappedFile(file.path).size() > 64 * 1024);
+
+        cadf::dom::DomNode loaded = converter->fromFile(file.path);
+        BOOST_CHECK_EQUAL(5000, loaded.numChildren());
+        BOOST_CHECK_EQUAL(DomConverterTest::toJson(root), DomConverterTest::toJson(loaded));
+    }
+
+    BOOST_AUTO_TEST_CASE(FileErrorsTest) {
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        BOOST_CHECK_THROW(converter->fromFile("/nonexistent/DomConverterTest"), std::system_error);
+        BOOST_CHECK_THROW(converter->toFile(cadf::dom::DomNode(), "/nonexistent/DomConverterTest"), std::system_error);
+
+        DomConverterTest::TempFile file;
+        BOOST_CHECK_THROW(converter->fromFile(file.path), cadf::dom::ParseException);
+        file.write("{\"a\":");
+        BOOST_CHECK_THROW(converter->fromFile(file.path), cadf::dom::ParseException);
+    }
+
+    BOOST_AUTO_TEST_CASE(DefaultFromDataTest) {
+        DomConverterTest::MinimalConverter converter;
+        BOOST_CHECK_EQUAL("abc", converter.fromData(std::string_view("abcdef", 3)).getValue());
+
+        DomConverterTest::TempFile file;
+        converter.toFile(cadf::dom::DomNode("from file"), file.path);
+        BOOST_CHECK_EQUAL("from file", converter.fromFile(file.path).getValue());
+
+        cadf::dom::DomDocument document;
+        converter.fromFile(file.path, &document);
+        BOOST_CHECK_EQUAL("from file", document.getRoot().getValue());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/DomDocument.h"
+#include "dom/json/JsonConverter.h"
+
+#include <memory_resource>
+
+namespace DomDocumentTest {
+
+    /**
+     * Memory resource which counts the allocations made through it, for use as the default resource
+     */
+    class CountingResource: public std::pmr::memory_resource {
+        public:
+            CountingResource() : m_previous(std::pmr::set_default_resource(this)) {
+            }
+
+            ~CountingResource() {
+                std::pmr::set_default_resource(m_previous);
+            }
+
+            size_t numAllocations = 0;
+
+        private:
+            std::pmr::memory_resource *m_previous;
+
+            void* do_allocate(size_t bytes, size_t alignment) override {
+                numAllocations++;
+                return m_previous->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+                m_previous->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+                return this == &other;
+            }
+    };
+
+    const std::string JSON = "{\"a long enough key to allocate\":[1,\"a long enough string to allocate\",{\"b\":[true,null]}],\"c\":{\"d\":2.5}}";
+}
+
+BOOST_AUTO_TEST_SUITE(DomDocument_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(ParseIntoArenaTest) {
+        for (cadf::dom::json::JsonParser::Mode mode : { cadf::dom::json::JsonParser::Mode::SEQUENTIAL, cadf::dom::json::JsonParser::Mode::INDEXED }) {
+            cadf::dom::DomDocument document;
+            cadf::dom::json::JsonConverter::instance()->setParseMode(mode);
+
+            DomDocumentTest::CountingResource counter;
+            cadf::dom::json::JsonConverter::instance()->fromString(DomDocumentTest::JSON, &document);
+            // None of the nodes were allocated outside of the arena
+            BOOST_CHECK_EQUAL(0, counter.numAllocations);
+            BOOST_CHECK_EQUAL(DomDocumentTest::JSON, cadf::dom::json::JsonConverter::instance()->toString(document.getRoot()));
+
+            // Accessing and modifying the tree within the document does not allocate outside of the arena
+            counter.numAllocations = 0;
+            document.getRoot()["c"]["e"] = 5;
+            document.getRoot()["c"]["f"] = document.getRoot()["a long enough key to allocate"];
+            BOOST_CHECK_EQUAL(0, counter.numAllocations);
+
+            // Whereas a node outside of the document does
+            cadf::dom::DomNode outside = "a long enough string to allocate";
+            BOOST_CHECK_EQUAL(1, counter.numAllocations);
+        }
+        cadf::dom::json::JsonConverter::instance()->setParseMode(cadf::dom::json::JsonParser::Mode::INDEXED);
+    }
+
+    BOOST_AUTO_TEST_CASE(CopyOutOfDocumentTest) {
+        cadf::dom::DomNode copy;
+        {
+            cadf::dom::DomDocument document;
+            cadf::dom::json::JsonConverter::instance()->fromString(DomDocumentTest::JSON, &document);
+            copy = document.getRoot();
+            BOOST_CHECK(copy.getAllocator() != document.getAllocator());
+            BOOST_CHECK(copy["c"].getAllocator() != document.getAllocator());
+        }
+        BOOST_CHECK_EQUAL(DomDocumentTest::JSON, cadf::dom::json::JsonConverter::instance()->toString(copy));
+    }
+
+    BOOST_AUTO_TEST_CASE(ClearTest) {
+        cadf::dom::DomDocument document;
+        cadf::dom::json::JsonConverter::instance()->fromString(DomDocumentTest::JSON, &document);
+        BOOST_CHECK_EQUAL(2, document.getRoot().numChildren());
+
+        document.clear();
+        BOOST_CHECK(document.getRoot().isNull());
+        BOOST_CHECK(document.getRoot().getAllocator() == document.getAllocator());
+
+        cadf::dom::json::JsonConverter::instance()->fromString("{\"x\":1}", &document);
+        BOOST_CHECK_EQUAL(1, document.getRoot()["x"].operator int());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/DomKey.h"
+#include "dom/DomNode.h"
+#include "dom/json/JsonConverter.h"
+#include "dom/cbor/CborConverter.h"
+
+#include <iterator>
+#include <set>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(DomKey_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(InternTest) {
+        std::string text = "DomKeyTest::InternTest";
+        cadf::dom::DomKey key(text);
+        cadf::dom::DomKey same(std::string_view("DomKeyTest::InternTest"));
+        cadf::dom::DomKey other("DomKeyTest::Other");
+
+        BOOST_CHECK(key == same);
+        BOOST_CHECK_EQUAL(key.data(), same.data());
+        BOOST_CHECK(key != other);
+        BOOST_CHECK_EQUAL(text, key.str());
+        BOOST_CHECK_EQUAL(text.size(), key.size());
+        BOOST_CHECK(key == "DomKeyTest::InternTest");
+        BOOST_CHECK("DomKeyTest::Other" == other);
+        BOOST_CHECK(key != "DomKeyTest::Other");
+
+        std::stringstream ss;
+        ss << key;
+        BOOST_CHECK_EQUAL(text, ss.str());
+    }
+
+    BOOST_AUTO_TEST_CASE(EmptyKeyTest) {
+        cadf::dom::DomKey empty;
+        BOOST_CHECK(empty == cadf::dom::DomKey(""));
+        BOOST_CHECK_EQUAL(0, empty.size());
+        BOOST_CHECK(empty == "");
+        BOOST_CHECK(cadf::dom::DomKey::find(""));
+    }
+
+    BOOST_AUTO_TEST_CASE(OrderTest) {
+        cadf::dom::DomKey a("DomKeyTest::a");
+        cadf::dom::DomKey b("DomKeyTest::b");
+        BOOST_CHECK(a < b);
+        BOOST_CHECK(!(b < a));
+        BOOST_CHECK(!(a < a));
+        BOOST_CHECK(cadf::dom::DomKey() < a);
+    }
+
+    BOOST_AUTO_TEST_CASE(FindTest) {
+        size_t poolSize = cadf::dom::DomKey::poolSize();
+        BOOST_CHECK(!cadf::dom::DomKey::find("DomKeyTest::FindTest"));
+        BOOST_CHECK_EQUAL(poolSize, cadf::dom::DomKey::poolSize());
+
+        cadf::dom::DomKey key("DomKeyTest::FindTest");
+        BOOST_CHECK_EQUAL(poolSize + 1, cadf::dom::DomKey::poolSize());
+        std::optional<cadf::dom::DomKey> found = cadf::dom::DomKey::find("DomKeyTest::FindTest");
+        BOOST_REQUIRE(found);
+        BOOST_CHECK(key == *found);
+        BOOST_CHECK_EQUAL(poolSize + 1, cadf::dom::DomKey::poolSize());
+    }
+
+    BOOST_AUTO_TEST_CASE(NodeLookupTest) {
+        cadf::dom::DomNode root;
+        root["DomKeyTest::child"] = 1;
+        cadf::dom::DomKey key("DomKeyTest::child");
+        BOOST_CHECK_EQUAL(1, root[key].operator int());
+        BOOST_CHECK_EQUAL(key.data(), root.beginChildren()->first.data());
+        BOOST_CHECK(root.hasChild("DomKeyTest::child"));
+
+        // Looking for a child which does not exist does not grow the pool
+        size_t poolSize = cadf::dom::DomKey::poolSize();
+        const cadf::dom::DomNode &constRoot = root;
+        BOOST_CHECK(!constRoot.hasChild("DomKeyTest::missing"));
+        BOOST_CHECK_THROW(constRoot["DomKeyTest::missing"], std::out_of_range);
+        BOOST_CHECK_EQUAL(poolSize, cadf::dom::DomKey::poolSize());
+    }
+
+    BOOST_AUTO_TEST_CASE(SharedAcrossTreesTest) {
+        std::string json = "{\"DomKeyTest::shared\":{\"DomKeyTest::nested\":1},\"DomKeyTest::\\u0065scaped\":2}";
+        cadf::dom::DomNode first = cadf::dom::json::JsonConverter::instance()->fromString(json);
+        cadf::dom::DomNode second = cadf::dom::json::JsonConverter::instance()->fromString(json);
+        cadf::dom::DomNode third = cadf::dom::cbor::CborConverter::instance()->fromString(cadf::dom::cbor::CborConverter::instance()->toString(first));
+
+        for (const cadf::dom::DomNode *node : { &second, &third }) {
+            cadf::dom::DomNode::ChildIterator expected = first.beginChildren();
+            for (cadf::dom::DomNode::ChildIterator it = node->beginChildren(); it != node->endChildren(); ++it, ++expected)
+                BOOST_CHECK_EQUAL(expected->first.data(), it->first.data());
+        }
+        BOOST_CHECK_EQUAL("DomKeyTest::escaped", first.beginChildren()->first);
+        BOOST_CHECK_EQUAL(first["DomKeyTest::shared"].beginChildren()->first.data(), third["DomKeyTest::shared"].beginChildren()->first.data());
+    }
+
+    BOOST_AUTO_TEST_CASE(ConcurrentInternTest) {
+        const int numThreads = 4;
+        std::vector<std::vector<const char*>> results(numThreads);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; t++) {
+            threads.emplace_back([&results, t]() {
+                for (int i = 0; i < 1000; i++)
+                    results[t].push_back(cadf::dom::DomKey("DomKeyTest::concurrent" + std::to_string(i)).data());
+            });
+        }
+        for (std::thread &thread : threads)
+            thread.join();
+
+        // Every thread got the same pooled name for the same text
+        for (int t = 1; t < numThreads; t++)
+            BOOST_CHECK(results[0] == results[t]);
+        BOOST_CHECK_EQUAL(1000, std::set<const char*>(results[0].begin(), results[0].end()).size());
+    }
+
+    // Must remain the last test of the suite, as once a name was left out of the pool find() no longer reports unknown names
+    BOOST_AUTO_TEST_CASE(PoolLimitTest) {
+        cadf::dom::DomKey pooled("DomKeyTest::pooled");
+        size_t limit = cadf::dom::DomKey::getPoolLimit();
+        size_t poolSize = cadf::dom::DomKey::poolSize();
+        cadf::dom::DomKey::setPoolLimit(poolSize);
+
+        // Names from untrusted input no longer grow the full pool, but still behave as any other key
+        std::string json = "{\"DomKeyTest::unique1\":1,\"DomKeyTest::unique2\":2,\"DomKeyTest::pooled\":3}";
+        cadf::dom::DomNode root = cadf::dom::json::JsonConverter::instance()->fromString(json);
+        BOOST_CHECK_EQUAL(poolSize, cadf::dom::DomKey::poolSize());
+        BOOST_CHECK(root.beginChildren()->first.isPooled());
+        BOOST_CHECK(!std::prev(root.endChildren())->first.isPooled());
+        BOOST_CHECK_EQUAL(1, root["DomKeyTest::unique1"].operator int());
+        BOOST_CHECK_EQUAL(2, std::as_const(root)["DomKeyTest::unique2"].operator int());
+        BOOST_CHECK(root.hasChild("DomKeyTest::unique2"));
+        BOOST_CHECK(!root.hasChild("DomKeyTest::unique3"));
+        BOOST_CHECK(root == cadf::dom::json::JsonConverter::instance()->fromString(json));
+
+        cadf::dom::DomKey unpooled("DomKeyTest::unpooled");
+        cadf::dom::DomKey same("DomKeyTest::unpooled");
+        cadf::dom::DomKey copy = unpooled;
+        BOOST_CHECK(!unpooled.isPooled());
+        BOOST_CHECK(unpooled == same);
+        BOOST_CHECK(!(unpooled < same));
+        BOOST_CHECK_EQUAL(unpooled.data(), copy.data());
+        BOOST_CHECK(unpooled != pooled);
+        BOOST_CHECK(pooled < unpooled);
+        BOOST_CHECK(cadf::dom::DomKey::find("DomKeyTest::unpooled"));
+
+        // Already pooled names continue to be found in the pool
+        BOOST_CHECK(cadf::dom::DomKey("DomKeyTest::pooled").isPooled());
+        BOOST_CHECK_EQUAL(pooled.data(), cadf::dom::DomKey("DomKeyTest::pooled").data());
+
+        // Long names are never pooled
+        cadf::dom::DomKey::setPoolLimit(limit);
+        std::string longName(cadf::dom::DomKey::MAX_POOLED_LENGTH + 1, 'k');
+        BOOST_CHECK(!cadf::dom::DomKey(longName).isPooled());
+        BOOST_CHECK(cadf::dom::DomKey(longName.substr(1)).isPooled());
+        BOOST_CHECK_EQUAL(poolSize + 1, cadf::dom::DomKey::poolSize());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,8 @@
 #endif
 #include <boost/test/unit_test.hpp>
 #include <limits>
+#include <memory_resource>
+#include <stdexcept>
 
 #include "dom/DomNode.h"
 
@@ -94,6 +96,34 @@ BOOST_AUTO_TEST_SUITE(DomNode_Test_Suite)
         BOOST_CHECK_EQUAL(false, assignNode.isNull());
     }
 
+    BOOST_AUTO_TEST_CASE(IntegerBoundariesTest) {
+        cadf::dom::DomNode minNode(std::numeric_limits<int64_t>::min());
+        BOOST_CHECK(minNode.isInteger());
+        BOOST_CHECK_EQUAL(std::numeric_limits<int64_t>::min(), minNode.operator long());
+        BOOST_CHECK_EQUAL("-9223372036854775808", minNode.operator std::string());
+
+        cadf::dom::DomNode maxNode(uint64_t(std::numeric_limits<int64_t>::max()));
+        BOOST_CHECK(maxNode.isInteger());
+        BOOST_CHECK_EQUAL(std::numeric_limits<int64_t>::max(), maxNode.operator long());
+        BOOST_CHECK_EQUAL("9223372036854775807", maxNode.operator std::string());
+
+        // Unsigned values beyond the signed range are stored as doubles rather than wrapping around
+        cadf::dom::DomNode aboveMaxNode(uint64_t(std::numeric_limits<int64_t>::max()) + 1);
+        BOOST_CHECK(aboveMaxNode.isDouble());
+        BOOST_CHECK_EQUAL(9223372036854775808.0, aboveMaxNode.operator double());
+        BOOST_CHECK_EQUAL(std::numeric_limits<long>::max(), aboveMaxNode.operator long());
+
+        cadf::dom::DomNode uint64MaxNode = 18446744073709551615ULL;
+        BOOST_CHECK(uint64MaxNode.isDouble());
+        BOOST_CHECK_EQUAL(18446744073709551615.0, uint64MaxNode.operator double());
+        BOOST_CHECK_EQUAL(std::numeric_limits<long>::max(), uint64MaxNode.operator long());
+        BOOST_CHECK_EQUAL("18446744073709551616", uint64MaxNode.operator std::string());
+
+        cadf::dom::DomNode uint32MaxNode(std::numeric_limits<uint32_t>::max());
+        BOOST_CHECK(uint32MaxNode.isInteger());
+        BOOST_CHECK_EQUAL(4294967295L, uint32MaxNode.operator long());
+    }
+
     BOOST_AUTO_TEST_CASE(DoubleNodeTest) {
         cadf::dom::DomNode ctorNode(-573.698);
         DomNodeTest::verifyNodeState(ctorNode, "-573.698", -573, -573.698, false, '-', 0, 0, true, false, false, false);
@@ -118,6 +148,242 @@ BOOST_AUTO_TEST_SUITE(DomNode_Test_Suite)
         DomNodeTest::verifyNodeState(assignNode, "false", 0, 0, false, 'f', 0, 0, true, false, false, false);
     }
 
+    BOOST_AUTO_TEST_CASE(NativeTypeTest) {
+        cadf::dom::DomNode intNode = 12;
+        BOOST_CHECK(intNode.isInteger());
+        BOOST_CHECK(!intNode.isDouble());
+        BOOST_CHECK(!intNode.isBool());
+        BOOST_CHECK_EQUAL(12.0, intNode.operator double());
+
+        cadf::dom::DomNode doubleNode = 0.1;
+        BOOST_CHECK(doubleNode.isDouble());
+        BOOST_CHECK_EQUAL(0.1, doubleNode.operator double());
+        BOOST_CHECK_EQUAL("0.1", doubleNode.operator std::string());
+
+        cadf::dom::DomNode boolNode = false;
+        BOOST_CHECK(boolNode.isBool());
+        BOOST_CHECK(!boolNode.isInteger());
+
+        cadf::dom::DomNode stringNode = "12";
+        BOOST_CHECK(!stringNode.isInteger());
+        BOOST_CHECK_EQUAL(12, stringNode.operator int());
+        BOOST_CHECK_EQUAL("", intNode.getValue());
+        BOOST_CHECK_EQUAL("12", stringNode.getValue());
+    }
+
+    BOOST_AUTO_TEST_CASE(FromLiteralTest) {
+        BOOST_CHECK(cadf::dom::DomNode::fromLiteral("null").isNull());
+        BOOST_CHECK(cadf::dom::DomNode::fromLiteral("true").isBool());
+        BOOST_CHECK(cadf::dom::DomNode::fromLiteral("-9223372036854775808").isInteger());
+        BOOST_CHECK(cadf::dom::DomNode::fromLiteral("9223372036854775808").isDouble());
+        BOOST_CHECK(cadf::dom::DomNode::fromLiteral("1e3").isDouble());
+
+        cadf::dom::DomNode unknown = cadf::dom::DomNode::fromLiteral("abc");
+        BOOST_CHECK(!unknown.isString());
+        BOOST_CHECK(!unknown.isNull());
+        BOOST_CHECK_EQUAL("abc", unknown.operator std::string());
+
+        char buffer[cadf::dom::DomNode::MAX_FORMATTED_SIZE];
+        BOOST_CHECK_EQUAL("-1.2345678901234568e-300", cadf::dom::DomNode::fromLiteral("-1.2345678901234568e-300").formatValue(buffer));
+    }
+
+    BOOST_AUTO_TEST_CASE(AllocatorPropagationTest) {
+        std::pmr::monotonic_buffer_resource arena;
+        cadf::dom::DomNode::allocator_type alloc(&arena);
+        cadf::dom::DomNode root(alloc);
+        root["object"]["value"] = "a string which is long enough to be allocated";
+        root["array"] = {1, 2, 3};
+        root["array"].addArrayElement(cadf::dom::DomNode("another string which is long enough to be allocated"));
+
+        BOOST_CHECK(alloc == root["object"].getAllocator());
+        BOOST_CHECK(alloc == root["object"]["value"].getAllocator());
+        BOOST_CHECK(alloc == root["array"].getAllocator());
+        for (cadf::dom::DomNode::ArrayIterator it = root["array"].beginArray(); it != root["array"].endArray(); ++it)
+            BOOST_CHECK(alloc == it->getAllocator());
+        BOOST_CHECK_EQUAL(4, root["array"].numArrayElements());
+
+        // Copies leave the arena, moves remain in it
+        cadf::dom::DomNode copy = root;
+        BOOST_CHECK(alloc != copy["object"].getAllocator());
+        BOOST_CHECK_EQUAL("a string which is long enough to be allocated", copy["object"]["value"].operator std::string());
+        cadf::dom::DomNode moved = std::move(root);
+        BOOST_CHECK(alloc == moved["object"].getAllocator());
+    }
+
+    BOOST_AUTO_TEST_CASE(CopyOnWriteTest) {
+        cadf::dom::DomNode built;
+        built["a"]["b"] = 1;
+        built["a"]["c"] = {1, 2, 3};
+        built["d"]["e"] = "unchanged";
+
+        // The copy shares the whole tree, as no references into the original have been handed out (unlike for the built tree)
+        cadf::dom::DomNode original = built;
+        const cadf::dom::DomNode copy = original;
+        const cadf::dom::DomNode &constOriginal = original;
+        BOOST_CHECK_EQUAL(&*constOriginal.beginChildren(), &*copy.beginChildren());
+        BOOST_CHECK(original == copy);
+
+        // Modifying the original only copies the containers along the way, leaving the copy as it was
+        original["a"]["b"] = 2;
+        BOOST_CHECK_NE(&*constOriginal.beginChildren(), &*copy.beginChildren());
+        BOOST_CHECK_NE(&*constOriginal["a"].beginChildren(), &*copy["a"].beginChildren());
+        BOOST_CHECK_EQUAL(&*constOriginal["a"]["c"].beginArray(), &*copy["a"]["c"].beginArray());
+        BOOST_CHECK_EQUAL(&*constOriginal["d"].beginChildren(), &*copy["d"].beginChildren());
+        BOOST_CHECK_EQUAL(2, constOriginal["a"]["b"].operator int());
+        BOOST_CHECK_EQUAL(1, copy["a"]["b"].operator int());
+        BOOST_CHECK(original != copy);
+
+        // Every kind of modification leaves the copy as it was
+        cadf::dom::DomNode other = copy;
+        other["a"]["c"].addArrayElement(cadf::dom::DomNode(4));
+        other["a"]["c"].insertArrayElement(0, cadf::dom::DomNode(0));
+        other["a"]["c"].removeArrayElement(1);
+        other.removeChild(cadf::dom::DomKey("d"));
+        other.appendChild("f", cadf::dom::DomNode(5));
+        other.sortChildren();
+        *other.findChild("f") = 6;
+        *other["a"]["c"].findArrayElement(0) = -1;
+        std::vector<cadf::dom::DomNode> extracted = std::move(other["a"]["c"]);
+        BOOST_CHECK_EQUAL(4, extracted.size());
+        BOOST_CHECK_EQUAL(3, copy["a"]["c"].numArrayElements());
+        BOOST_CHECK_EQUAL(1, copy["a"]["c"].beginArray()->operator int());
+        BOOST_CHECK_EQUAL("unchanged", copy["d"]["e"].operator std::string());
+        BOOST_CHECK(!copy.hasChild("f"));
+    }
+
+    BOOST_AUTO_TEST_CASE(CopyAfterReferenceTest) {
+        cadf::dom::DomNode root;
+        root["a"]["x"] = 1;
+        root["b"] = {1, 2};
+
+        // References handed out before the copy must not modify the copy
+        cadf::dom::DomNode &a = root["a"];
+        cadf::dom::DomNode &x = root["a"]["x"];
+        cadf::dom::DomNode *found = root.findChild("a");
+        cadf::dom::DomNode *element = root["b"].findArrayElement(0);
+        const cadf::dom::DomNode snap = root;
+        cadf::dom::DomNode assigned;
+        assigned = root;
+
+        a["x"] = 2;
+        BOOST_CHECK_EQUAL(2, std::as_const(root)["a"]["x"].operator int());
+        BOOST_CHECK_EQUAL(1, snap["a"]["x"].operator int());
+        BOOST_CHECK_EQUAL(1, std::as_const(assigned)["a"]["x"].operator int());
+
+        x = 3;
+        (*found)["y"] = 4;
+        *element = 5;
+        BOOST_CHECK_EQUAL(3, std::as_const(root)["a"]["x"].operator int());
+        BOOST_CHECK_EQUAL(4, std::as_const(root)["a"]["y"].operator int());
+        BOOST_CHECK_EQUAL(5, std::as_const(root)["b"].beginArray()->operator int());
+        BOOST_CHECK_EQUAL(1, snap["a"]["x"].operator int());
+        BOOST_CHECK(!snap["a"].hasChild("y"));
+        BOOST_CHECK_EQUAL(1, snap["b"].beginArray()->operator int());
+        BOOST_CHECK_EQUAL(1, std::as_const(assigned)["a"]["x"].operator int());
+        BOOST_CHECK_EQUAL(1, std::as_const(assigned)["b"].beginArray()->operator int());
+
+        // The same goes for copies of a subtree
+        cadf::dom::DomNode &y = root["a"]["y"];
+        const cadf::dom::DomNode subtree = root["a"];
+        y = 6;
+        BOOST_CHECK_EQUAL(4, subtree["y"].operator int());
+    }
+
+    BOOST_AUTO_TEST_CASE(CopyOnWriteAllocatorTest) {
+        std::pmr::monotonic_buffer_resource arena;
+        cadf::dom::DomNode::allocator_type alloc(&arena);
+        cadf::dom::DomNode built(alloc);
+        built["a"]["b"] = 1;
+        cadf::dom::DomNode root(built, alloc);
+
+        // Copies within the arena share, copies out of it do not
+        cadf::dom::DomNode inArena(root, alloc);
+        cadf::dom::DomNode outOfArena = root;
+        const cadf::dom::DomNode &constRoot = root;
+        BOOST_CHECK_EQUAL(&*constRoot.beginChildren(), &*std::as_const(inArena).beginChildren());
+        BOOST_CHECK_NE(&*constRoot.beginChildren(), &*std::as_const(outOfArena).beginChildren());
+        BOOST_CHECK(alloc != outOfArena["a"].getAllocator());
+
+        // Modified copies continue to allocate from the arena
+        inArena["a"]["c"] = 2;
+        BOOST_CHECK(alloc == inArena["a"].getAllocator());
+        BOOST_CHECK(alloc == inArena["a"]["c"].getAllocator());
+        BOOST_CHECK(!constRoot["a"].hasChild("c"));
+    }
+
+    BOOST_AUTO_TEST_CASE(SortedChildrenTest) {
+        cadf::dom::DomNode root;
+        for (const char *name : { "d", "b", "e", "a", "c" })
+            root[name] = name;
+
+        std::string order;
+        for (cadf::dom::DomNode::ChildIterator it = root.beginChildren(); it != root.endChildren(); ++it)
+            order += it->second.operator std::string();
+        BOOST_CHECK_EQUAL("abcde", order);
+
+        const cadf::dom::DomNode &constRoot = root;
+        BOOST_CHECK_EQUAL("c", constRoot["c"].operator std::string());
+        BOOST_CHECK_THROW(constRoot["f"], std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(AssignDescendantTest) {
+        cadf::dom::DomNode root;
+        root["a"]["b"]["c"] = 5;
+        root = root["a"]["b"];
+        BOOST_CHECK_EQUAL(5, root["c"].operator int());
+
+        root["x"]["y"] = "z";
+        root = std::move(root["x"]);
+        BOOST_CHECK_EQUAL("z", root["y"].operator std::string());
+    }
+
+    BOOST_AUTO_TEST_CASE(MoveArrayTest) {
+        const std::string longValue = "a string long enough to be allocated";
+        std::vector<cadf::dom::DomNode> elements;
+        elements.push_back(cadf::dom::buildNode("a", longValue));
+        elements.push_back(longValue);
+        const char *childData = elements[0]["a"].getValue().data();
+        const char *elementData = elements[1].getValue().data();
+
+        // The subtrees are taken over by the node rather than copied
+        cadf::dom::DomNode array(std::move(elements));
+        BOOST_CHECK_EQUAL(2, array.numArrayElements());
+        BOOST_CHECK_EQUAL(childData, array.beginArray()->operator[]("a").getValue().data());
+        BOOST_CHECK_EQUAL(elementData, (array.beginArray() + 1)->getValue().data());
+
+        // And taken back out of it again
+        std::vector<cadf::dom::DomNode> extracted = std::move(array);
+        BOOST_CHECK_EQUAL(2, extracted.size());
+        BOOST_CHECK_EQUAL(childData, extracted[0]["a"].getValue().data());
+        BOOST_CHECK_EQUAL(elementData, extracted[1].getValue().data());
+        BOOST_CHECK_EQUAL(0, array.numArrayElements());
+
+        // Converting an lvalue still copies
+        cadf::dom::DomNode copied = {1, 2, 3};
+        std::vector<int> values = copied;
+        BOOST_CHECK_EQUAL(3, values.size());
+        BOOST_CHECK_EQUAL(3, copied.numArrayElements());
+    }
+
+    BOOST_AUTO_TEST_CASE(MoveStringTest) {
+        std::pmr::monotonic_buffer_resource arena;
+        std::pmr::string value("a string long enough to be allocated", &arena);
+        const char *data = value.data();
+
+        cadf::dom::DomNode node(std::move(value));
+        BOOST_CHECK(node.isString());
+        BOOST_CHECK(node.getAllocator() == cadf::dom::DomNode::allocator_type(&arena));
+        BOOST_CHECK_EQUAL(data, node.getValue().data());
+
+        // Names are interned rather than allocated within the tree
+        cadf::dom::DomKey name("a name long enough to otherwise be allocated");
+        cadf::dom::DomNode parent(node.getAllocator());
+        parent.appendChild(name, std::move(node));
+        parent.sortChildren();
+        BOOST_CHECK_EQUAL(name.data(), parent.beginChildren()->first.data());
+        BOOST_CHECK_EQUAL(data, parent.beginChildren()->second.getValue().data());
+    }
+
     BOOST_AUTO_TEST_CASE(CharNodeTest) {
         cadf::dom::DomNode ctorNode = '(';
         DomNodeTest::verifyNodeState(ctorNode, "(", 0, 0, false, '(', 0, 0, true, true, false, false);
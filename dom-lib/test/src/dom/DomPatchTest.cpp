@@ -0,0 +1,141 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/DomPatch.h"
+#include "dom/DomException.h"
+#include "dom/json/JsonConverter.h"
+
+namespace DomPatchTest {
+
+    /**
+     * Parse the JSON into a tree
+     */
+    cadf::dom::DomNode parse(const std::string &json) {
+        return cadf::dom::json::JsonConverter::instance()->fromString(json);
+    }
+
+    /**
+     * Parse the JSON array of operations (the parser only accepts objects at the root)
+     */
+    cadf::dom::DomNode parsePatch(const std::string &json) {
+        return parse("{\"patch\":" + json + "}")["patch"];
+    }
+
+    /**
+     * Convert the tree to JSON
+     */
+    std::string toJson(const cadf::dom::DomNode &node) {
+        return cadf::dom::json::JsonConverter::instance()->toString(node);
+    }
+
+    /**
+     * Diff the trees, verify that the patch produces the expected operations and that applying it turns one tree into the other
+     */
+    void verifyDiff(const std::string &from, const std::string &to, const std::string &expectedPatch) {
+        cadf::dom::DomNode fromNode = parse(from);
+        cadf::dom::DomNode toNode = parse(to);
+        cadf::dom::DomNode patch = cadf::dom::DomPatch::diff(fromNode, toNode);
+        BOOST_CHECK_EQUAL(expectedPatch, toJson(patch));
+
+        cadf::dom::DomPatch::apply(fromNode, patch);
+        BOOST_CHECK_EQUAL(toJson(toNode), toJson(fromNode));
+        BOOST_CHECK(toNode == fromNode);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(DomPatch_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(EqualityTest) {
+        BOOST_CHECK(DomPatchTest::parse("{\"a\":[1,{\"b\":\"c\"}]}") == DomPatchTest::parse("{\"a\":[1,{\"b\":\"c\"}]}"));
+        BOOST_CHECK(DomPatchTest::parse("{\"a\":1}") != DomPatchTest::parse("{\"a\":1.5}"));
+        BOOST_CHECK(DomPatchTest::parse("{\"a\":1}") != DomPatchTest::parse("{\"a\":\"1\"}"));
+        BOOST_CHECK(DomPatchTest::parse("{\"a\":1}") != DomPatchTest::parse("{\"b\":1}"));
+        BOOST_CHECK(cadf::dom::DomNode() == DomPatchTest::parse("{}"));
+    }
+
+    BOOST_AUTO_TEST_CASE(NoChangeTest) {
+        DomPatchTest::verifyDiff("{\"a\":{\"b\":[1,2]},\"c\":\"d\"}", "{\"a\":{\"b\":[1,2]},\"c\":\"d\"}", "[]");
+    }
+
+    BOOST_AUTO_TEST_CASE(ObjectDiffTest) {
+        DomPatchTest::verifyDiff("{\"a\":1,\"b\":{\"c\":2,\"d\":3},\"e\":4}", "{\"a\":1,\"b\":{\"c\":5,\"x\":true},\"f\":null}",
+                "[{\"op\":\"replace\",\"path\":\"/b/c\",\"value\":5},{\"op\":\"remove\",\"path\":\"/b/d\"},{\"op\":\"add\",\"path\":\"/b/x\",\"value\":true},"
+                "{\"op\":\"remove\",\"path\":\"/e\"},{\"op\":\"add\",\"path\":\"/f\",\"value\":null}]");
+    }
+
+    BOOST_AUTO_TEST_CASE(ArrayDiffTest) {
+        // Insertion in the middle
+        DomPatchTest::verifyDiff("{\"a\":[1,2,3]}", "{\"a\":[1,9,2,3]}", "[{\"op\":\"add\",\"path\":\"/a/1\",\"value\":9}]");
+        // Removal from the middle
+        DomPatchTest::verifyDiff("{\"a\":[1,2,3,4]}", "{\"a\":[1,4]}", "[{\"op\":\"remove\",\"path\":\"/a/2\"},{\"op\":\"remove\",\"path\":\"/a/1\"}]");
+        // Change in place
+        DomPatchTest::verifyDiff("{\"a\":[{\"b\":1},{\"b\":2}]}", "{\"a\":[{\"b\":1},{\"b\":3}]}", "[{\"op\":\"replace\",\"path\":\"/a/1/b\",\"value\":3}]");
+        // Append
+        DomPatchTest::verifyDiff("{\"a\":[1]}", "{\"a\":[1,2,3]}", "[{\"op\":\"add\",\"path\":\"/a/1\",\"value\":2},{\"op\":\"add\",\"path\":\"/a/2\",\"value\":3}]");
+        // Change and removal
+        DomPatchTest::verifyDiff("{\"a\":[1,2,3,4]}", "{\"a\":[5,4]}",
+                "[{\"op\":\"replace\",\"path\":\"/a/0\",\"value\":5},{\"op\":\"remove\",\"path\":\"/a/2\"},{\"op\":\"remove\",\"path\":\"/a/1\"}]");
+    }
+
+    BOOST_AUTO_TEST_CASE(TypeChangeTest) {
+        DomPatchTest::verifyDiff("{\"a\":[1,2]}", "{\"a\":{\"b\":1}}", "[{\"op\":\"replace\",\"path\":\"/a\",\"value\":{\"b\":1}}]");
+        DomPatchTest::verifyDiff("{\"a\":{\"b\":1}}", "{\"a\":\"x\"}", "[{\"op\":\"replace\",\"path\":\"/a\",\"value\":\"x\"}]");
+
+        cadf::dom::DomNode root = DomPatchTest::parse("{\"a\":1}");
+        cadf::dom::DomNode array = { 1 };
+        cadf::dom::DomNode patch = cadf::dom::DomPatch::diff(root, array);
+        BOOST_CHECK_EQUAL("[{\"op\":\"replace\",\"path\":\"\",\"value\":[1]}]", DomPatchTest::toJson(patch));
+        cadf::dom::DomPatch::apply(root, patch);
+        BOOST_CHECK(array == root);
+    }
+
+    BOOST_AUTO_TEST_CASE(EscapedNamesTest) {
+        DomPatchTest::verifyDiff("{\"a/b\":{\"c~d\":1}}", "{\"a/b\":{\"c~d\":2}}", "[{\"op\":\"replace\",\"path\":\"/a~1b/c~0d\",\"value\":2}]");
+    }
+
+    BOOST_AUTO_TEST_CASE(ApplyTest) {
+        cadf::dom::DomNode root = DomPatchTest::parse("{\"a\":[1,2],\"b\":{\"c\":1}}");
+        cadf::dom::DomNode patch = DomPatchTest::parsePatch("[{\"op\":\"add\",\"path\":\"/a/-\",\"value\":3},{\"op\":\"add\",\"path\":\"/a/0\",\"value\":0},"
+                "{\"op\":\"test\",\"path\":\"/b/c\",\"value\":1},{\"op\":\"add\",\"path\":\"/b/d\",\"value\":[true]},{\"op\":\"remove\",\"path\":\"/b/c\"}]");
+        cadf::dom::DomPatch::apply(root, patch);
+        BOOST_CHECK_EQUAL("{\"a\":[0,1,2,3],\"b\":{\"d\":[true]}}", DomPatchTest::toJson(root));
+    }
+
+    BOOST_AUTO_TEST_CASE(ApplyErrorsTest) {
+        cadf::dom::DomNode root = DomPatchTest::parse("{\"a\":[1,2],\"b\":\"c\"}");
+        auto applyOp = [&root](const std::string &op) {
+            cadf::dom::DomPatch::apply(root, DomPatchTest::parsePatch("[" + op + "]"));
+        };
+        BOOST_CHECK_THROW(cadf::dom::DomPatch::apply(root, DomPatchTest::parse("{\"op\":\"remove\"}")), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"path\":\"/a\"}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"move\",\"path\":\"/a\",\"value\":1}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"replace\",\"path\":\"/a\"}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"replace\",\"path\":\"/x\",\"value\":1}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"remove\",\"path\":\"/x\"}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"remove\",\"path\":\"/a/2\"}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"add\",\"path\":\"/a/3\",\"value\":1}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"add\",\"path\":\"/x/y\",\"value\":1}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"add\",\"path\":\"/b/y\",\"value\":1}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"add\",\"path\":\"a\",\"value\":1}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"test\",\"path\":\"/b\",\"value\":\"d\"}"), cadf::dom::PatchException);
+        BOOST_CHECK_THROW(applyOp("{\"op\":\"remove\",\"path\":\"\"}"), cadf::dom::PatchException);
+        BOOST_CHECK_EQUAL("{\"a\":[1,2],\"b\":\"c\"}", DomPatchTest::toJson(root));
+    }
+
+    BOOST_AUTO_TEST_CASE(NodeEditTest) {
+        cadf::dom::DomNode root = DomPatchTest::parse("{\"a\":[1,3],\"b\":1}");
+        root["a"].insertArrayElement(1, cadf::dom::DomNode(2));
+        root["a"].insertArrayElement(3, cadf::dom::DomNode(4));
+        BOOST_CHECK_THROW(root["a"].insertArrayElement(5, cadf::dom::DomNode(6)), std::out_of_range);
+        root["a"].removeArrayElement(0);
+        BOOST_CHECK_THROW(root["a"].removeArrayElement(3), std::out_of_range);
+        BOOST_CHECK(root.removeChild(cadf::dom::DomKey("b")));
+        BOOST_CHECK(!root.removeChild(cadf::dom::DomKey("b")));
+        BOOST_CHECK_EQUAL("{\"a\":[2,3,4]}", DomPatchTest::toJson(root));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/DomPath.h"
+#include "dom/DomException.h"
+#include "dom/json/JsonConverter.h"
+
+namespace DomPathTest {
+
+    /**
+     * Parse the JSON into a tree
+     */
+    cadf::dom::DomNode parse(const std::string &json) {
+        return cadf::dom::json::JsonConverter::instance()->fromString(json);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(DomPath_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(ResolveTest) {
+        cadf::dom::DomNode root = DomPathTest::parse("{\"a\":{\"b\":[0,1,2,{\"c\":\"found\"}],\"n\":5}}");
+
+        cadf::dom::DomPath path("/a/b/3/c");
+        BOOST_CHECK_EQUAL(4, path.size());
+        BOOST_CHECK_EQUAL("/a/b/3/c", path.toString());
+        const cadf::dom::DomNode *node = path.resolve(root);
+        BOOST_REQUIRE(node);
+        BOOST_CHECK_EQUAL("found", node->getValue());
+        BOOST_CHECK_EQUAL("found", path.find<std::string>(root).value());
+        BOOST_CHECK_EQUAL("found", path.get(root).getValue());
+
+        BOOST_CHECK_EQUAL(5, cadf::dom::DomPath("/a/n").find<int>(root).value());
+        BOOST_CHECK_EQUAL(2, cadf::dom::DomPath("/a/b/2").find<long>(root).value());
+        BOOST_CHECK_EQUAL(4, cadf::dom::DomPath("/a/b").find<std::vector<cadf::dom::DomNode>>(root)->size());
+    }
+
+    BOOST_AUTO_TEST_CASE(RootTest) {
+        cadf::dom::DomNode root = DomPathTest::parse("{\"a\":1}");
+        cadf::dom::DomPath path("");
+        BOOST_CHECK_EQUAL(0, path.size());
+        BOOST_CHECK_EQUAL(&root, path.resolve(root));
+    }
+
+    BOOST_AUTO_TEST_CASE(MissingTest) {
+        cadf::dom::DomNode root = DomPathTest::parse("{\"a\":{\"b\":[0,1]},\"s\":\"x\"}");
+        BOOST_CHECK(!cadf::dom::DomPath("/x").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/x").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/b/2").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/b/-").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/b/01").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/b/x").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/s/x").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/b/0/x").resolve(root));
+        BOOST_CHECK(!cadf::dom::DomPath("/a/b/0/x").find<int>(root));
+        BOOST_CHECK_THROW(cadf::dom::DomPath("/a/x").get(root), std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(EscapeTest) {
+        cadf::dom::DomNode root = DomPathTest::parse("{\"a/b\":{\"m~n\":1,\"\":{\"0\":2}}}");
+        BOOST_CHECK_EQUAL(1, cadf::dom::DomPath("/a~1b/m~0n").find<int>(root).value());
+        // An empty step is the empty name, and an index can also be a name of an object
+        BOOST_CHECK_EQUAL(2, cadf::dom::DomPath("/a~1b//0").find<int>(root).value());
+    }
+
+    BOOST_AUTO_TEST_CASE(InvalidPointerTest) {
+        BOOST_CHECK_THROW(cadf::dom::DomPath("a/b"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(cadf::dom::DomPath("/a~2"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(cadf::dom::DomPath("/a~"), cadf::dom::ParseException);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReuseTest) {
+        cadf::dom::DomPath path("/msg/id");
+        for (int i = 0; i < 10; i++) {
+            cadf::dom::DomNode root = DomPathTest::parse("{\"msg\":{\"id\":" + std::to_string(i) + "}}");
+            BOOST_CHECK_EQUAL(i, path.find<int>(root).value());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(NodeFindTest) {
+        cadf::dom::DomNode root = DomPathTest::parse("{\"a\":[1,2]}");
+        BOOST_CHECK(root.findChild("a"));
+        BOOST_CHECK(!root.findChild("b"));
+        BOOST_CHECK_EQUAL(2, root["a"].findArrayElement(1)->operator int());
+        BOOST_CHECK(!root["a"].findArrayElement(2));
+        BOOST_CHECK(!root.findArrayElement(0));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
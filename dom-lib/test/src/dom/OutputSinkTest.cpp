@@ -0,0 +1,72 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/OutputSink.h"
+
+#include <cstdio>
+#include <system_error>
+#include <unistd.h>
+
+namespace OutputSinkTest {
+
+    /**
+     * Read the full contents of the file
+     */
+    std::string readAll(FILE *file) {
+        rewind(file);
+        std::string contents;
+        char buffer[256];
+        size_t numRead;
+        while ((numRead = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            contents.append(buffer, numRead);
+        return contents;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(OutputSink_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(StringSinkTest) {
+        std::string str = "abc";
+        cadf::dom::StringSink sink(&str);
+        sink.reserve(100);
+        BOOST_CHECK(str.capacity() >= 103);
+        sink.write("def", 3);
+        sink.write("ghij", 2);
+        BOOST_CHECK_EQUAL("abcdefgh", str);
+    }
+
+    BOOST_AUTO_TEST_CASE(FileDescriptorSinkBufferedTest) {
+        FILE *file = tmpfile();
+        BOOST_REQUIRE(file);
+        {
+            cadf::dom::FileDescriptorSink sink(fileno(file), 8);
+            sink.write("abc", 3);
+            sink.write("defg", 4);
+            // Nothing written until the buffer fills up
+            BOOST_CHECK_EQUAL("", OutputSinkTest::readAll(file));
+            sink.write("hij", 3);
+            BOOST_CHECK_EQUAL("abcdefg", OutputSinkTest::readAll(file));
+            // Larger than the buffer goes straight through
+            sink.write("0123456789", 10);
+            BOOST_CHECK_EQUAL("abcdefghij0123456789", OutputSinkTest::readAll(file));
+            sink.write("xyz", 3);
+            sink.flush();
+            BOOST_CHECK_EQUAL("abcdefghij0123456789xyz", OutputSinkTest::readAll(file));
+            sink.write("!", 1);
+        }
+        // Flushed on destruction
+        BOOST_CHECK_EQUAL("abcdefghij0123456789xyz!", OutputSinkTest::readAll(file));
+        fclose(file);
+    }
+
+    BOOST_AUTO_TEST_CASE(FileDescriptorSinkErrorTest) {
+        cadf::dom::FileDescriptorSink sink(-1, 8);
+        sink.write("abc", 3);
+        BOOST_CHECK_THROW(sink.flush(), std::system_error);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/cbor/CborConverter.h"
+#include "dom/json/JsonConverter.h"
+#include "dom/DomException.h"
+
+namespace CborConverterTest {
+
+    /**
+     * Convert hex into the bytes it represents
+     */
+    std::string fromHex(const std::string &hex) {
+        std::string bytes;
+        for (size_t i = 0; i < hex.size(); i += 2)
+            bytes += char(std::stoi(hex.substr(i, 2), nullptr, 16));
+        return bytes;
+    }
+
+    /**
+     * Convert the node to CBOR, returned as hex. Also verifies that the calculated size matches.
+     */
+    std::string toHex(const cadf::dom::DomNode &node) {
+        static const char *digits = "0123456789abcdef";
+        std::string bytes = cadf::dom::cbor::CborConverter::instance()->toString(node);
+        BOOST_CHECK_EQUAL(bytes.size(), cadf::dom::cbor::CborConverter::instance()->size(node));
+
+        std::string hex;
+        for (unsigned char c : bytes) {
+            hex += digits[c >> 4];
+            hex += digits[c & 0xf];
+        }
+        return hex;
+    }
+
+    /**
+     * Decode the CBOR (in hex) and convert the result to JSON
+     */
+    std::string decodeToJson(const std::string &hex) {
+        return cadf::dom::json::JsonConverter::instance()->toString(cadf::dom::cbor::CborConverter::instance()->fromString(fromHex(hex)));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(CborConverter_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(EncodeScalarTest) {
+        BOOST_CHECK_EQUAL("00", CborConverterTest::toHex(0));
+        BOOST_CHECK_EQUAL("17", CborConverterTest::toHex(23));
+        BOOST_CHECK_EQUAL("1818", CborConverterTest::toHex(24));
+        BOOST_CHECK_EQUAL("1903e8", CborConverterTest::toHex(1000));
+        BOOST_CHECK_EQUAL("1a000f4240", CborConverterTest::toHex(1000000));
+        BOOST_CHECK_EQUAL("1b000000e8d4a51000", CborConverterTest::toHex(1000000000000L));
+        BOOST_CHECK_EQUAL("20", CborConverterTest::toHex(-1));
+        BOOST_CHECK_EQUAL("3863", CborConverterTest::toHex(-100));
+        BOOST_CHECK_EQUAL("fa3fc00000", CborConverterTest::toHex(1.5));
+        BOOST_CHECK_EQUAL("fb3ff199999999999a", CborConverterTest::toHex(1.1));
+        BOOST_CHECK_EQUAL("f4", CborConverterTest::toHex(false));
+        BOOST_CHECK_EQUAL("f5", CborConverterTest::toHex(true));
+        BOOST_CHECK_EQUAL("f6", CborConverterTest::toHex(cadf::dom::DomNode()));
+        BOOST_CHECK_EQUAL("60", CborConverterTest::toHex(""));
+        BOOST_CHECK_EQUAL("6449455446", CborConverterTest::toHex("IETF"));
+        BOOST_CHECK_EQUAL("62225c", CborConverterTest::toHex("\"\\"));
+    }
+
+    BOOST_AUTO_TEST_CASE(EncodeTreeTest) {
+        BOOST_CHECK_EQUAL("83010203", CborConverterTest::toHex({1, 2, 3}));
+
+        cadf::dom::DomNode node;
+        node["b"] = {2, 3};
+        node["a"] = 1;
+        BOOST_CHECK_EQUAL("a26161016162820203", CborConverterTest::toHex(node));
+
+        cadf::dom::DomNode large;
+        for (int i = 0; i < 30; i++)
+            large.addArrayElement(i);
+        BOOST_CHECK_EQUAL("981e", CborConverterTest::toHex(large).substr(0, 4));
+    }
+
+    BOOST_AUTO_TEST_CASE(DecodeTest) {
+        BOOST_CHECK_EQUAL("{\"a\":1,\"b\":[2,3]}", CborConverterTest::decodeToJson("a26161016162820203"));
+        BOOST_CHECK_EQUAL("{\"a\":[-1,-1000,1.5,1.1,true,false,null,null]}", CborConverterTest::decodeToJson("a1616188203903e7f93e00fb3ff199999999999af5f4f6f7"));
+        // Indefinite lengths, with the keys out of order
+        BOOST_CHECK_EQUAL("{\"a\":[1,[2,3],[4,5]],\"s\":\"streaming\"}", CborConverterTest::decodeToJson("bf61737f657374726561646d696e67ff61619f018202039f0405ffffff"));
+        // Tags are skipped, byte strings are strings
+        BOOST_CHECK_EQUAL("{\"d\":\"ab\"}", CborConverterTest::decodeToJson("a16164c1426162"));
+        // Unsigned integers too large for an int64_t become doubles
+        cadf::dom::DomNode large = cadf::dom::cbor::CborConverter::instance()->fromString(CborConverterTest::fromHex("1bffffffffffffffff"));
+        BOOST_CHECK(large.isDouble());
+        BOOST_CHECK_EQUAL(18446744073709551615.0, large.operator double());
+
+        cadf::dom::DomNode half = cadf::dom::cbor::CborConverter::instance()->fromString(CborConverterTest::fromHex("f9c400"));
+        BOOST_CHECK_EQUAL(-4.0, half.operator double());
+    }
+
+    BOOST_AUTO_TEST_CASE(RoundTripTest) {
+        std::string json = "{\"a\":[1,-2,0.25,1e+300,true,false,null,\"x\\\"y\\u0000z\"],\"b\":{\"c\":\"long enough string to need a length byte\",\"d\":{}},\"e\":[]}";
+        cadf::dom::DomNode original = cadf::dom::json::JsonConverter::instance()->fromString(json);
+        std::string cbor = cadf::dom::cbor::CborConverter::instance()->toString(original);
+        BOOST_CHECK_LT(cbor.size(), json.size());
+
+        cadf::dom::DomNode decoded = cadf::dom::cbor::CborConverter::instance()->fromString(cbor);
+        BOOST_CHECK_EQUAL(cadf::dom::json::JsonConverter::instance()->toString(original), cadf::dom::json::JsonConverter::instance()->toString(decoded));
+        BOOST_CHECK(decoded["a"].beginArray()->isInteger());
+        BOOST_CHECK((decoded["a"].beginArray() + 2)->isDouble());
+        BOOST_CHECK_EQUAL(std::string("x\"y\0z", 5), (decoded["a"].beginArray() + 7)->operator std::string());
+
+        cadf::dom::DomDocument document;
+        cadf::dom::cbor::CborConverter::instance()->fromString(cbor, &document);
+        BOOST_CHECK(document.getRoot()["b"].getAllocator() == document.getAllocator());
+        BOOST_CHECK_EQUAL(cbor, cadf::dom::cbor::CborConverter::instance()->toString(document.getRoot()));
+    }
+
+    BOOST_AUTO_TEST_CASE(MalformedTest) {
+        for (std::string hex : { "", "18", "1a0000", "62", "6261", "83", "8301", "a1", "a101", "a10101", "9f01", "7f6161", "7f01ff", "1c", "fc", "e0", "5f6161ff" }) {
+            BOOST_CHECK_THROW(cadf::dom::cbor::CborConverter::instance()->fromString(CborConverterTest::fromHex(hex)), cadf::dom::ParseException);
+        }
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
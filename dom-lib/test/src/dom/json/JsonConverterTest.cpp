@@ -4,6 +4,7 @@
 #   define BOOST_TEST_MODULE Main
 #endif
 #include <boost/test/unit_test.hpp>
+#include <limits>
 
 #include "dom/json/JsonConverter.h"
 
@@ -228,4 +229,50 @@ BOOST_AUTO_TEST_SUITE(Json_Test_Suite)
         BOOST_CHECK(arrSub.endArray() == it);
     }
 
+    BOOST_AUTO_TEST_CASE(EscapedStringsTest) {
+        cadf::dom::DomNode root;
+        root["quote\"key"] = "back\\slash";
+        root["control"] = std::string("line\nbreak\ttab\x01", 15);
+
+        cadf::dom::DomConverter *converter = cadf::dom::json::JsonConverter::instance();
+
+        std::string expected = "{\"control\":\"line\\nbreak\\ttab\\u0001\",\"quote\\\"key\":\"back\\\\slash\"}";
+        BOOST_CHECK_EQUAL(expected.size(), converter->size(root));
+        BOOST_CHECK_EQUAL(expected, converter->toString(root));
+
+        cadf::dom::DomNode newRoot = converter->fromString(expected);
+        BOOST_CHECK_EQUAL(expected, converter->toString(newRoot));
+        std::string control = newRoot["control"];
+        BOOST_CHECK_EQUAL(std::string("line\nbreak\ttab\x01", 15), control);
+    }
+
+    BOOST_AUTO_TEST_CASE(IntegerBoundariesTest) {
+        cadf::dom::DomNode root;
+        root["min"] = std::numeric_limits<int64_t>::min();
+        root["max"] = std::numeric_limits<int64_t>::max();
+        root["v"] = 18446744073709551615ULL;
+
+        cadf::dom::DomConverter *converter = cadf::dom::json::JsonConverter::instance();
+
+        std::string expected = "{\"max\":9223372036854775807,\"min\":-9223372036854775808,\"v\":18446744073709551616}";
+        BOOST_CHECK_EQUAL(expected.size(), converter->size(root));
+        BOOST_CHECK_EQUAL(expected, converter->toString(root));
+
+        cadf::dom::DomNode newRoot = converter->fromString(expected);
+        BOOST_CHECK(newRoot == root);
+    }
+
+    BOOST_AUTO_TEST_CASE(WriteToSinkTest) {
+        cadf::dom::DomNode root = cadf::dom::buildNode("array", std::vector<int>{1, 2, 3});
+        root["sub"]["value"] = "val";
+
+        cadf::dom::DomConverter *converter = cadf::dom::json::JsonConverter::instance();
+
+        std::string out = "prefix:";
+        cadf::dom::StringSink sink(&out);
+        converter->write(root, &sink);
+        BOOST_CHECK_EQUAL("prefix:{\"array\":[1,2,3],\"sub\":{\"value\":\"val\"}}", out);
+        BOOST_CHECK_EQUAL(out.size() - 7, converter->size(root));
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
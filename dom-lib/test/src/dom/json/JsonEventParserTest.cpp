@@ -0,0 +1,129 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/json/JsonEventParser.h"
+#include "dom/json/JsonTreeBuilder.h"
+#include "dom/json/JsonConverter.h"
+#include "dom/DomException.h"
+
+#include <sstream>
+
+namespace JsonEventParserTest {
+
+    /**
+     * Handler which records all events as a string
+     */
+    class RecordingHandler: public cadf::dom::json::JsonEventHandler {
+        public:
+            std::string events;
+
+            void startObject() { events += "{"; }
+            void endObject() { events += "}"; }
+            void startArray() { events += "["; }
+            void endArray() { events += "]"; }
+            void key(std::string_view name) { events += "K(" + std::string(name) + ")"; }
+            void nullValue() { events += "N"; }
+            void boolValue(bool value) { events += value ? "T" : "F"; }
+            void integerValue(int64_t value) { events += "I(" + std::to_string(value) + ")"; }
+            void doubleValue(double value) { events += "D(" + std::to_string(value) + ")"; }
+            void stringValue(std::string_view value) { events += "S(" + std::string(value) + ")"; }
+            void endDocument() { events += "|"; }
+    };
+
+    /**
+     * Parse the JSON, feeding it in chunks of the specified size
+     */
+    std::string parseInChunks(const std::string &json, size_t chunkSize) {
+        RecordingHandler handler;
+        cadf::dom::json::JsonEventParser parser(&handler);
+        for (size_t i = 0; i < json.size(); i += chunkSize)
+            parser.feed(std::string_view(json).substr(i, chunkSize));
+        parser.finish();
+        return handler.events;
+    }
+
+    const std::string JSON = "{\"a\":[1,-2.5,true,false,null,\"x\\\"y\\u00e9\"],\"b\":{},\"c\":[],\"d\":{\"e\":\"long enough to be split\"}}";
+    const std::string EVENTS = "{K(a)[I(1)D(-2.500000)TFNS(x\"y\xC3\xA9)]K(b){}K(c)[]K(d){K(e)S(long enough to be split)}}|";
+}
+
+BOOST_AUTO_TEST_SUITE(JsonEventParser_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(EventsTest) {
+        BOOST_CHECK_EQUAL(JsonEventParserTest::EVENTS, JsonEventParserTest::parseInChunks(JsonEventParserTest::JSON, JsonEventParserTest::JSON.size()));
+    }
+
+    BOOST_AUTO_TEST_CASE(ChunkedTest) {
+        for (size_t chunkSize = 1; chunkSize < JsonEventParserTest::JSON.size(); chunkSize++)
+            BOOST_CHECK_EQUAL(JsonEventParserTest::EVENTS, JsonEventParserTest::parseInChunks(JsonEventParserTest::JSON, chunkSize));
+    }
+
+    BOOST_AUTO_TEST_CASE(TopLevelValuesTest) {
+        BOOST_CHECK_EQUAL("I(1)|T|S(x)|N|[I(2)]|D(0.500000)|", JsonEventParserTest::parseInChunks(" 1 true\"x\"\nnull[2] 0.5", 3));
+        BOOST_CHECK_EQUAL("", JsonEventParserTest::parseInChunks("  \n ", 1));
+    }
+
+    BOOST_AUTO_TEST_CASE(NewlineDelimitedTest) {
+        std::string ndjson;
+        for (int i = 0; i < 100; i++)
+            ndjson += "{\"id\":" + std::to_string(i) + ",\"tags\":[\"t" + std::to_string(i) + "\"],\"z\":null,\"a\":{\"b\":true}}\n";
+
+        std::vector<std::string> documents;
+        cadf::dom::json::JsonTreeBuilder builder([&documents](cadf::dom::DomNode &&root) {
+            documents.push_back(cadf::dom::json::JsonConverter::instance()->toString(root));
+        });
+        cadf::dom::json::JsonEventParser parser(&builder);
+        std::istringstream in(ndjson);
+        parser.parse(in, 7);
+
+        BOOST_CHECK_EQUAL(100, documents.size());
+        for (int i = 0; i < 100; i++) {
+            std::string expected = "{\"a\":{\"b\":true},\"id\":" + std::to_string(i) + ",\"tags\":[\"t" + std::to_string(i) + "\"],\"z\":null}";
+            BOOST_CHECK_EQUAL(expected, documents[i]);
+        }
+        BOOST_CHECK_EQUAL(0, parser.depth());
+    }
+
+    BOOST_AUTO_TEST_CASE(MatchesParserTest) {
+        std::string json = "{\"b\":[[1,2],{\"c\":\"d\"},[]],\"a\":{\"x\":1.25,\"y\":\"a\\nb\"},\"b\":0}";
+        cadf::dom::DomNode built;
+        cadf::dom::json::JsonTreeBuilder builder([&built](cadf::dom::DomNode &&root) {
+            built = std::move(root);
+        });
+        cadf::dom::json::JsonEventParser parser(&builder);
+        parser.feed(json);
+        parser.finish();
+
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        BOOST_CHECK_EQUAL(converter->toString(converter->fromString(json)), converter->toString(built));
+    }
+
+    BOOST_AUTO_TEST_CASE(MalformedTest) {
+        for (std::string json : { "{\"a\" 1}", "{\"a\":1 2}", "[1,,2]", "{a:1}", "[1}", "{\"a\":1]", "}", ",", "[nope]", "\"a\\x\"", "[1,2" , "{\"a\":\"b" , "{\"a\"" }) {
+            JsonEventParserTest::RecordingHandler handler;
+            cadf::dom::json::JsonEventParser parser(&handler);
+            BOOST_CHECK_THROW(parser.feed(json); parser.finish(), cadf::dom::ParseException);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ErrorOffsetTest) {
+        JsonEventParserTest::RecordingHandler handler;
+        cadf::dom::json::JsonEventParser parser(&handler);
+        parser.feed("[1,");
+        try {
+            parser.feed("2}");
+            BOOST_FAIL("Exception expected");
+        } catch (const cadf::dom::ParseException &e) {
+            BOOST_CHECK_EQUAL("Error parsing: ',]' expected at 4", e.what());
+        }
+
+        // Once reset the parser can be used again
+        parser.reset();
+        handler.events.clear();
+        parser.feed("[3]");
+        BOOST_CHECK_EQUAL("[I(3)]|", handler.events);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/json/JsonParser.h"
+#include "dom/json/JsonConverter.h"
+#include "dom/DomException.h"
+
+namespace JsonParserTest {
+
+    /**
+     * Parse the JSON in both modes, verify that they are identical, and return the JSON regenerated from the result
+     */
+    std::string parseBoth(const std::string &json) {
+        cadf::dom::json::JsonParser sequential(json, cadf::dom::json::JsonParser::Mode::SEQUENTIAL);
+        cadf::dom::json::JsonParser indexed(json, cadf::dom::json::JsonParser::Mode::INDEXED);
+        std::string sequentialResult = cadf::dom::json::JsonConverter::instance()->toString(sequential.parse());
+        std::string indexedResult = cadf::dom::json::JsonConverter::instance()->toString(indexed.parse());
+        BOOST_CHECK_EQUAL(sequentialResult, indexedResult);
+        return indexedResult;
+    }
+
+    /**
+     * Parse the JSON in indexed mode
+     */
+    cadf::dom::DomNode parseIndexed(const std::string &json) {
+        cadf::dom::json::JsonParser parser(json, cadf::dom::json::JsonParser::Mode::INDEXED);
+        return parser.parse();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(JsonParser_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(ModesMatchTest) {
+        BOOST_CHECK_EQUAL("{\"a\":1}", JsonParserTest::parseBoth("{\"a\":1}"));
+        BOOST_CHECK_EQUAL("{\"a\":[1,2,3],\"b\":{\"c\":\"x y\",\"d\":null}}", JsonParserTest::parseBoth(" {\n\"b\" : { \"d\" : null , \"c\":\"x y\" } ,\t\"a\": [ 1 ,2, 3 ] } "));
+        BOOST_CHECK_EQUAL("{\"a\":[[true,false],[{\"b\":-1500}]]}", JsonParserTest::parseBoth("{\"a\":[[true,false],[{\"b\":-1.5e3}]]}"));
+        BOOST_CHECK_EQUAL("{\"{[:,]}\":\"]}:,{[\"}", JsonParserTest::parseBoth("{\"{[:,]}\":\"]}:,{[\"}"));
+    }
+
+    BOOST_AUTO_TEST_CASE(TypedLiteralsTest) {
+        for (cadf::dom::json::JsonParser::Mode mode : { cadf::dom::json::JsonParser::Mode::SEQUENTIAL, cadf::dom::json::JsonParser::Mode::INDEXED }) {
+            cadf::dom::DomNode root = cadf::dom::json::JsonParser("{\"i\":-42,\"d\":2.5e-1,\"b\":true,\"big\":18446744073709551616,\"n\":null}", mode).parse();
+            BOOST_CHECK(root["i"].isInteger());
+            BOOST_CHECK_EQUAL(-42, root["i"].operator long());
+            BOOST_CHECK(root["d"].isDouble());
+            BOOST_CHECK_EQUAL(0.25, root["d"].operator double());
+            BOOST_CHECK(root["b"].isBool());
+            BOOST_CHECK(root["b"].operator bool());
+            BOOST_CHECK(root["big"].isDouble());
+            BOOST_CHECK(root["n"].isNull());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(LargeInputTest) {
+        std::string json = "{";
+        for (int i = 0; i < 1000; i++)
+            json += "\"key" + std::to_string(i) + "\":{\"name\":\"value " + std::to_string(i) + "\",\"list\":[1,2,3,{\"x\":null}],\"flag\":true},";
+        json += "\"last\":0}";
+
+        std::string result = JsonParserTest::parseBoth(json);
+        cadf::dom::DomNode root = JsonParserTest::parseIndexed(json);
+        BOOST_CHECK_EQUAL(1001, root.numChildren());
+        std::string name = root["key500"]["name"];
+        BOOST_CHECK_EQUAL("value 500", name);
+    }
+
+    BOOST_AUTO_TEST_CASE(DuplicateKeysTest) {
+        BOOST_CHECK_EQUAL("{\"a\":3,\"b\":2,\"c\":4}", JsonParserTest::parseBoth("{\"c\":0,\"a\":1,\"b\":2,\"a\":3,\"c\":4}"));
+    }
+
+    BOOST_AUTO_TEST_CASE(EscapeDecodingTest) {
+        std::string json = "{\"a\\\"b\":\"c\\\"d\\\\e\\/f\\n\\t\\u00e9\\ud83d\\ude00\"}";
+        BOOST_CHECK_EQUAL("{\"a\\\"b\":\"c\\\"d\\\\e/f\\n\\t\xC3\xA9\xF0\x9F\x98\x80\"}", JsonParserTest::parseBoth(json));
+
+        cadf::dom::DomNode root = JsonParserTest::parseIndexed(json);
+        std::string value = root["a\"b"];
+        BOOST_CHECK_EQUAL("c\"d\\e/f\n\t\xC3\xA9\xF0\x9F\x98\x80", value);
+    }
+
+    BOOST_AUTO_TEST_CASE(LoneSurrogateTest) {
+        // Lone surrogates cannot be encoded as UTF-8, and as such are replaced by U+FFFD
+        std::string json = "{\"a\":[\"\\ud83dx\",\"\\ude00\",\"\\ud83d\\u0041\"]}";
+        BOOST_CHECK_EQUAL("{\"a\":[\"\xEF\xBF\xBDx\",\"\xEF\xBF\xBD\",\"\xEF\xBF\xBD" "A\"]}", JsonParserTest::parseBoth(json));
+    }
+
+    BOOST_AUTO_TEST_CASE(InvalidEscapeTest) {
+        for (cadf::dom::json::JsonParser::Mode mode : { cadf::dom::json::JsonParser::Mode::SEQUENTIAL, cadf::dom::json::JsonParser::Mode::INDEXED }) {
+            std::string badEscape = "{\"a\":\"\\x\"}";
+            BOOST_CHECK_THROW(cadf::dom::json::JsonParser(badEscape, mode).parse(), cadf::dom::ParseException);
+            std::string badUnicode = "{\"a\":\"\\u12\"}";
+            BOOST_CHECK_THROW(cadf::dom::json::JsonParser(badUnicode, mode).parse(), cadf::dom::ParseException);
+            std::string unterminated = "{\"a\":\"abc\\\"}";
+            BOOST_CHECK_THROW(cadf::dom::json::JsonParser(unterminated, mode).parse(), cadf::dom::ParseException);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(IndexedEmptyContainersTest) {
+        cadf::dom::DomNode root = JsonParserTest::parseIndexed("{\"a\":{},\"b\":[ ]}");
+        BOOST_CHECK(root["a"].isNull());
+        BOOST_CHECK(root["b"].isArray());
+        BOOST_CHECK_EQUAL(0, root["b"].numArrayElements());
+        BOOST_CHECK(JsonParserTest::parseIndexed(" { } ").isNull());
+    }
+
+    BOOST_AUTO_TEST_CASE(IndexedMalformedTest) {
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed(""), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("[1]"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("x{\"a\":1}"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{\"a\":1"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{\"a\" 1}"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{\"a\":1 2}"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{\"a\":}"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{\"a\":[1,,2]}"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{\"a\":\"b}"), cadf::dom::ParseException);
+        BOOST_CHECK_THROW(JsonParserTest::parseIndexed("{a:1}"), cadf::dom::ParseException);
+    }
+
+    BOOST_AUTO_TEST_CASE(ConverterParseModeTest) {
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        BOOST_CHECK(cadf::dom::json::JsonParser::Mode::INDEXED == converter->getParseMode());
+
+        converter->setParseMode(cadf::dom::json::JsonParser::Mode::SEQUENTIAL);
+        BOOST_CHECK(cadf::dom::json::JsonParser::Mode::SEQUENTIAL == converter->getParseMode());
+        BOOST_CHECK_EQUAL("{\"a\":1}", converter->toString(converter->fromString("{\"a\":1}")));
+
+        converter->setParseMode(cadf::dom::json::JsonParser::Mode::INDEXED);
+        BOOST_CHECK_EQUAL("{\"a\":1}", converter->toString(converter->fromString("{\"a\":1}")));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/json/LazyJsonDocument.h"
+#include "dom/json/JsonConverter.h"
+#include "dom/DomException.h"
+
+namespace LazyJsonDocumentTest {
+    const std::string JSON = " {\"s\":\"a,b}\" , \"n\" : -12 ,\"o\":{\"x\":[1,{\"y\":\"]\"}],\"z\":{}},\"a\":[[],[\"[\"]],\"b\":true,\"e\\\"k\":null,\"d\":2.5} ";
+}
+
+BOOST_AUTO_TEST_SUITE(LazyJsonDocument_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(IndexTest) {
+        cadf::dom::json::LazyJsonDocument document(LazyJsonDocumentTest::JSON);
+        BOOST_CHECK_EQUAL(7, document.numChildren());
+        BOOST_CHECK(document.hasChild("o"));
+        BOOST_CHECK(document.hasChild("e\"k"));
+        BOOST_CHECK(!document.hasChild("x"));
+        BOOST_CHECK_EQUAL("{\"x\":[1,{\"y\":\"]\"}],\"z\":{}}", document.getRaw("o"));
+        BOOST_CHECK_EQUAL("[[],[\"[\"]]", document.getRaw("a"));
+        BOOST_CHECK_EQUAL("\"a,b}\"", document.getRaw("s"));
+        BOOST_CHECK_EQUAL("-12", document.getRaw("n"));
+        BOOST_CHECK_THROW(document.getRaw("x"), std::out_of_range);
+        BOOST_CHECK_THROW(document["x"], std::out_of_range);
+    }
+
+    BOOST_AUTO_TEST_CASE(ParseOnAccessTest) {
+        cadf::dom::json::LazyJsonDocument document(LazyJsonDocumentTest::JSON);
+        BOOST_CHECK(!document.isParsed("o"));
+        BOOST_CHECK(!document.isParsed("n"));
+
+        BOOST_CHECK_EQUAL(-12, document["n"].operator int());
+        BOOST_CHECK(document.isParsed("n"));
+        BOOST_CHECK(!document.isParsed("o"));
+
+        const cadf::dom::DomNode &o = document["o"];
+        BOOST_CHECK_EQUAL("]", o["x"].beginArray()[1]["y"].operator std::string());
+        // The parsed value is retained
+        BOOST_CHECK_EQUAL(&o, &document["o"]);
+
+        BOOST_CHECK_EQUAL("a,b}", document["s"].operator std::string());
+        BOOST_CHECK(document["b"].operator bool());
+        BOOST_CHECK(document["e\"k"].isNull());
+        BOOST_CHECK_EQUAL(2.5, document["d"].operator double());
+    }
+
+    BOOST_AUTO_TEST_CASE(MatchesParserTest) {
+        cadf::dom::json::LazyJsonDocument document(LazyJsonDocumentTest::JSON);
+        cadf::dom::json::JsonConverter *converter = cadf::dom::json::JsonConverter::instance();
+        BOOST_CHECK_EQUAL(converter->toString(converter->fromString(LazyJsonDocumentTest::JSON)), converter->toString(document.toDomNode()));
+
+        cadf::dom::json::LazyJsonDocument duplicates("{\"a\":1,\"b\":2,\"a\":3}");
+        BOOST_CHECK_EQUAL(2, duplicates.numChildren());
+        BOOST_CHECK_EQUAL(3, duplicates["a"].operator int());
+
+        BOOST_CHECK_EQUAL(0, cadf::dom::json::LazyJsonDocument(" { } ").numChildren());
+    }
+
+    BOOST_AUTO_TEST_CASE(MalformedTest) {
+        for (std::string json : { "", "[1]", "x{\"a\":1}", "{\"a\":1", "{\"a\" 1}", "{\"a\":}", "{a:1}", "{\"a\":1 \"b\":2}", "{\"a\":{\"b\":1}", "{\"a\":\"b}" })
+            BOOST_CHECK_THROW(cadf::dom::json::LazyJsonDocument document(json), cadf::dom::ParseException);
+
+        // Nested values are only validated once accessed
+        cadf::dom::json::LazyJsonDocument document("{\"a\":{\"b\" 1},\"c\":1 2,\"d\":3}");
+        BOOST_CHECK_EQUAL(3, document["d"].operator int());
+        BOOST_CHECK_THROW(document["a"], cadf::dom::ParseException);
+        BOOST_CHECK_THROW(document["c"], cadf::dom::ParseException);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
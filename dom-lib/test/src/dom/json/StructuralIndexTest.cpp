@@ -0,0 +1,82 @@
+
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include "dom/json/StructuralIndex.h"
+
+namespace StructuralIndexTest {
+
+    const cadf::dom::json::StructuralIndex::Kernel ALL_KERNELS[] = {
+            cadf::dom::json::StructuralIndex::Kernel::AUTO,
+            cadf::dom::json::StructuralIndex::Kernel::SCALAR,
+            cadf::dom::json::StructuralIndex::Kernel::SSE2,
+            cadf::dom::json::StructuralIndex::Kernel::AVX2 };
+
+    /**
+     * Build the index with the kernel and return the positions it contains
+     */
+    std::vector<size_t> positions(const std::string &json, cadf::dom::json::StructuralIndex::Kernel kernel) {
+        cadf::dom::json::StructuralIndex index;
+        index.build(json.data(), json.size(), kernel);
+        std::vector<size_t> result;
+        for (size_t i = 0; i < index.size(); i++)
+            result.push_back(index[i]);
+        return result;
+    }
+
+    /**
+     * Verify that all kernels produce the expected index
+     */
+    void verify(const std::string &json, const std::vector<size_t> &expected) {
+        for (cadf::dom::json::StructuralIndex::Kernel kernel : ALL_KERNELS) {
+            std::vector<size_t> actual = positions(json, kernel);
+            BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(StructuralIndex_Test_Suite)
+
+    BOOST_AUTO_TEST_CASE(KernelSupportTest) {
+        BOOST_CHECK(cadf::dom::json::StructuralIndex::isSupported(cadf::dom::json::StructuralIndex::Kernel::AUTO));
+        BOOST_CHECK(cadf::dom::json::StructuralIndex::isSupported(cadf::dom::json::StructuralIndex::Kernel::SCALAR));
+    }
+
+    BOOST_AUTO_TEST_CASE(EmptyInputTest) {
+        StructuralIndexTest::verify("", { 0 });
+    }
+
+    BOOST_AUTO_TEST_CASE(SimpleObjectTest) {
+        StructuralIndexTest::verify("{\"a\": [1, 2], \"b\":\"x\"}", { 0, 1, 3, 4, 6, 8, 11, 12, 14, 16, 17, 18, 20, 21, 22 });
+    }
+
+    BOOST_AUTO_TEST_CASE(StructuralWithinStringTest) {
+        StructuralIndexTest::verify("{\"{[:,]}\"}", { 0, 1, 8, 9, 10 });
+    }
+
+    BOOST_AUTO_TEST_CASE(EscapedQuotesTest) {
+        // \" is escaped, \\" is not, \\\" is
+        StructuralIndexTest::verify("{\"\\\",\\\\\":\"\\\\\\\",\"}", { 0, 1, 7, 8, 9, 15, 16, 17 });
+    }
+
+    BOOST_AUTO_TEST_CASE(BlockBoundaryTest) {
+        // Strings and escape sequences which span the 64 character blocks
+        std::string json = "{\"" + std::string(61, 'a') + "\\\\\\\"" + std::string(60, ',') + "\":[" + std::string(70, ' ') + "1]}";
+        size_t closingQuote = 2 + 61 + 4 + 60;
+        StructuralIndexTest::verify(json, { 0, 1, closingQuote, closingQuote + 1, closingQuote + 2, closingQuote + 74, closingQuote + 75, json.size() });
+    }
+
+    BOOST_AUTO_TEST_CASE(KernelsAgreeTest) {
+        std::string json = "{";
+        for (int i = 0; i < 200; i++)
+            json += "\"key" + std::to_string(i) + "\\\\\":[\"v\\\"al,ue\", " + std::to_string(i * 1.5) + ", {\"n\": null}],";
+        json += "\"end\":true}";
+
+        std::vector<size_t> expected = StructuralIndexTest::positions(json, cadf::dom::json::StructuralIndex::Kernel::SCALAR);
+        StructuralIndexTest::verify(json, expected);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
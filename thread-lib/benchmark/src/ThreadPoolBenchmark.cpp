@@ -0,0 +1,84 @@
+#include "thread/BasicThreadPool.h"
+#include "thread/WorkStealingThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/*
+ * Compares the throughput of the thread pools, with 1 to N threads scheduling tiny functions concurrently (as the ThreadedBus does when
+ * many nodes send messages at once).
+ *
+ * Usage: thread-benchmark [max producers (defaults to the number of cores)] [functions per run (defaults to 200000)]
+ */
+namespace {
+    /** Number of times each measurement is repeated, the best is reported */
+    const int REPETITIONS = 3;
+
+    /*
+     * Schedule the functions from the producers, and wait for all of them to be executed
+     *
+     * @return double millions of functions per second
+     */
+    double measure(cadf::thread::IThreadPool &pool, unsigned int producers, int numFunctions) {
+        int perProducer = numFunctions / producers;
+        int total = perProducer * producers;
+        std::atomic<int> executed(0);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (unsigned int p = 0; p < producers; p++) {
+            threads.emplace_back([&pool, &executed, perProducer] {
+                for (int i = 0; i < perProducer; i++)
+                    pool.schedule([&executed] { executed.fetch_add(1, std::memory_order_relaxed); });
+            });
+        }
+        for (std::thread &t : threads)
+            t.join();
+        while (executed.load(std::memory_order_relaxed) < total)
+            std::this_thread::yield();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return total / elapsed.count() / 1e6;
+    }
+
+    /*
+     * Best of the repetitions, each against a fresh pool
+     */
+    double best(const std::function<std::unique_ptr<cadf::thread::IThreadPool>()> &createPool, unsigned int producers, int numFunctions) {
+        double result = 0;
+        for (int i = 0; i < REPETITIONS; i++) {
+            std::unique_ptr<cadf::thread::IThreadPool> pool = createPool();
+            result = std::max(result, measure(*pool, producers, numFunctions));
+        }
+        return result;
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    unsigned int maxProducers = argc > 1 ? std::atoi(argv[1]) : cores;
+    int numFunctions = argc > 2 ? std::atoi(argv[2]) : 200000;
+
+    std::printf("%u pool threads, %d functions per run, millions of functions per second (best of %d)\n", cores, numFunctions, REPETITIONS);
+    std::printf("%10s %12s %12s %15s\n", "producers", "mutex", "lock free", "work stealing");
+    for (unsigned int producers = 1; producers <= maxProducers; producers++) {
+        double mutex = best([cores] {
+            return std::make_unique<cadf::thread::BasicThreadPool>(cores, true, cadf::thread::BasicThreadPool::QueueType::MUTEX);
+        }, producers, numFunctions);
+        double lockFree = best([cores] {
+            return std::make_unique<cadf::thread::BasicThreadPool>(cores, true, cadf::thread::BasicThreadPool::QueueType::LOCK_FREE);
+        }, producers, numFunctions);
+        double workStealing = best([cores] {
+            return std::make_unique<cadf::thread::WorkStealingThreadPool>(cores);
+        }, producers, numFunctions);
+        std::printf("%10u %12.2f %12.2f %15.2f\n", producers, mutex, lockFree, workStealing);
+    }
+    return 0;
+}
@@ -2,15 +2,64 @@
 #define CAMB_THREAD_BASICTHREADPOOL_H_
 
 #include "thread/ThreadPool.h"
+#include "thread/ThreadConfig.h"
+#include "thread/MpmcQueue.h"
+#include "thread/ThreadPoolMetrics.h"
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <thread>
 
 namespace cadf::thread {
     /**
-     * Concrete (and basic) thread pool implementation that implements the IThreadPool interface
+     * Concrete (and basic) thread pool implementation that implements the IThreadPool interface. All threads share a single first come,
+     * first serve queue, which is either protected by a mutex, or is a bounded lock free ring (see QueueType).
+     *
+     * The pool records metrics as it goes (see metrics()), at the cost of reading the clock when a task is scheduled, and before and
+     * after it is executed. Defining DISABLE_THREAD_POOL_METRICS when compiling the library (the THREAD_POOL_METRICS CMake option)
+     * compiles the recording out entirely.
+     *
+     * The pool is either of a fixed size, or elastic (see Elasticity), growing up to a maximum number of threads while functions are
+     * waiting in the queue for too long, and retiring the additional threads again once they are idle.
      */
     class BasicThreadPool: public IThreadPool {
         public:
+            /**
+             * The kind of queue via which functions are passed to the threads
+             */
+            enum class QueueType {
+                /** Unbounded queue protected by a mutex, threads waiting on a condition variable */
+                MUTEX,
+                /** Bounded lock free ring (see MpmcQueue), threads spinning briefly before parking on a futex. Should the ring be
+                 *  full, functions overflow into a mutex protected queue. */
+                LOCK_FREE
+            };
+
+            /**
+             * The limits within which an elastic pool grows and shrinks. The pool grows by a thread whenever the function at the front
+             * of the queue has waited for at least the latency threshold while none of the threads are idle, which is checked when a
+             * function is scheduled, when a thread takes a function from the queue, and (while all of the threads are busy) by a
+             * monitoring thread once the threshold elapses. Threads beyond the initial number retire once they have been idle for the
+             * timeout.
+             */
+            struct Elasticity {
+                    /** The maximum number of threads (0 for a pool of a fixed size) */
+                    unsigned int maxThreads;
+                    /** How long the function at the front of the queue may wait before the pool grows */
+                    std::chrono::nanoseconds latencyThreshold;
+                    /** How long an additional thread may be idle before it retires */
+                    std::chrono::nanoseconds idleTimeout;
+
+                    /**
+                     * CTOR
+                     *
+                     * A fixed size, growing after 1 ms and retiring after 1 s should maxThreads be set
+                     */
+                    Elasticity() : maxThreads(0), latencyThreshold(std::chrono::milliseconds(1)), idleTimeout(std::chrono::seconds(1)) {
+                    }
+            };
+
             /**
              * CTOR
              *
@@ -18,10 +67,19 @@ namespace cadf::thread {
              * start by default, this this behavior can be controlled by the client code. Note, that specifying an invalid
              * number of threads (i.e.: 0) will generate an exception.
              *
+             * For an elastic pool the number of threads is the minimum, with the pool growing up to Elasticity::maxThreads. This is only
+             * supported with QueueType::MUTEX, as the age of the function at the front of the queue is only known there.
+             *
              * @param numThreads int the number of threads that are to be made available in the thread pool (defaults to std::thread::hardware_concurrency())
              * @param autoStart bool to indicate whether the thread pool should be started on initialization (defaults to true)
+             * @param queueType QueueType the kind of queue to use (defaults to QueueType::MUTEX)
+             * @param capacity size_t the capacity of the ring when using QueueType::LOCK_FREE (defaults to 1024)
+             * @param &config const ThreadConfig to apply to each of the threads (defaults to inheriting everything)
+             * @param &elasticity const Elasticity the limits within which the pool grows and shrinks (defaults to a fixed size)
+             * @throws ThreadInitializationException if the number of threads or the elasticity are invalid
              */
-            BasicThreadPool(unsigned int numThreads = std::thread::hardware_concurrency(), bool autoStart = true);
+            BasicThreadPool(unsigned int numThreads = std::thread::hardware_concurrency(), bool autoStart = true, QueueType queueType = QueueType::MUTEX,
+                    size_t capacity = 1024, const ThreadConfig &config = ThreadConfig(), const Elasticity &elasticity = Elasticity());
 
             /**
              * DTOR
@@ -30,6 +88,8 @@ namespace cadf::thread {
 
             /**
              * Starts the thread pool, creates the assigned number of threads and prepares for the scheduling of executions. Does nothing if already started.
+             *
+             * @throws ThreadInitializationException if the ThreadConfig could not be applied (the pool then remains stopped)
              */
             virtual void start();
 
@@ -47,33 +107,138 @@ namespace cadf::thread {
             /**
              * Schedules a function for execution in the next available thread.
              *
-             * @param func std::function<void()> that is to be scheduled for execution
+             * @param &&task TaskFunction that is to be scheduled for execution
+             */
+            virtual void schedule(TaskFunction &&task);
+
+            /**
+             * Get a snapshot of the metrics of the pool. Can be called at any time from any thread, including while the pool is
+             * stopped, in which case the cumulative metrics of when it was running are retained.
+             *
+             * @return ThreadPoolMetrics the metrics
              */
-            virtual void schedule(std::function<void()> func);
+            ThreadPoolMetrics metrics();
 
         private:
+            /**
+             * Function waiting in the queue, along with when it was scheduled
+             */
+            struct QueuedTask {
+                    /** The function */
+                    TaskFunction task;
+                    /** When it was scheduled (only set when collecting metrics) */
+                    std::chrono::steady_clock::time_point scheduled;
+            };
+
+            /**
+             * Metrics as recorded by one of the threads (defined in the source)
+             */
+            struct WorkerRecorder;
+
+
             /** Flag for whether or not the pool has been started */
             bool m_started;
             /** Flag for whether or not the pool is in the process of terminating */
-            bool m_terminating;
-            /** The number of threads that are to be created and managed */
+            std::atomic<bool> m_terminating;
+            /** The number of threads that are to be created and managed (the minimum for an elastic pool) */
             unsigned int m_numOfThreads;
-            /** Vector of all created threads */
+            /** The maximum number of threads (m_numOfThreads for a pool of a fixed size) */
+            unsigned int m_maxThreads;
+            /** The limits within which the pool grows and shrinks */
+            Elasticity m_elasticity;
+            /** The configuration to apply to each of the threads */
+            ThreadConfig m_config;
+            /** Vector of all created threads, one slot per possible thread (m_maxThreads) while started */
             std::vector<std::thread> m_threads;
             /** Mutex to ensure thread safety when managing the thread pool */
             std::mutex m_threadPoolMutex;
             /** Queue of functions that are buffered for execution */
-            std::queue<std::function<void()>> m_buffer;
+            std::queue<QueuedTask> m_buffer;
             /** Mutex to ensure thread safety when accessing the buffer */
             std::mutex m_bufferMutex;
             /** Condition which is used to wake up threads waiting on something to be placed on the buffer */
             std::condition_variable m_bufferCondition;
+            /** The number of threads which are running (protected by m_bufferMutex) */
+            unsigned int m_numRunning;
+            /** The number of threads waiting on m_bufferCondition (protected by m_bufferMutex) */
+            unsigned int m_numWaiting;
+            /** Whether the thread in each slot of m_threads is running (protected by m_bufferMutex) */
+            std::vector<bool> m_slotActive;
+            /** Thread which grows an elastic pool while all of the threads are busy, and nothing is scheduled or taken from the queue */
+            std::thread m_monitor;
+            /** Condition on which the monitoring thread waits */
+            std::condition_variable m_monitorCondition;
+            /** Whether the monitoring thread is waiting for a backlog to start building (protected by m_bufferMutex) */
+            bool m_monitorParked;
+            /** The kind of queue in use */
+            QueueType m_queueType;
+            /** The lock free ring (only for QueueType::LOCK_FREE, for which m_buffer holds the functions which overflowed) */
+            std::unique_ptr<MpmcQueue<QueuedTask>> m_ring;
+            /** Number of functions in the overflow buffer, so that it can be checked without locking */
+            std::atomic<size_t> m_overflowSize;
+            /** Futex word on which threads park, incremented whenever a function is scheduled */
+            std::atomic<uint32_t> m_epoch;
+            /** Number of threads which are parked (or about to be), so that scheduling only wakes threads when there are any */
+            std::atomic<unsigned int> m_numParked;
+            /** The metrics recorded by each of the threads, retained across stop() and start() */
+            std::unique_ptr<WorkerRecorder[]> m_recorders;
 
             /**
              * The logic for each thread in the pool. It will wait for a function to be placed on the buffer
              * for execution and then process it.
+             *
+             * @param index unsigned int the index of the thread
+             */
+            void waitAndProcess(unsigned int index);
+
+            /**
+             * Wait for a function to be placed on the buffer. For an elastic pool, the thread instead retires should it time out while
+             * there are more threads running than the minimum.
+             *
+             * @param &lock std::unique_lock<std::mutex> holding m_bufferMutex
+             * @param index unsigned int the index of the thread
+             * @return bool true if there is a function to process, false if the thread is to exit
+             */
+            bool waitForWork(std::unique_lock<std::mutex> &lock, unsigned int index);
+
+            /**
+             * Start another thread if the pool is elastic, below its maximum, none of the threads are idle, and the function at the
+             * front of the buffer has waited for too long. Wakes the monitoring thread should the function not have waited for long
+             * enough yet. Must be called with m_bufferMutex held.
+             */
+            void growIfBacklogged();
+
+            /**
+             * The logic for the monitoring thread of an elastic pool. While all of the threads are busy and functions are waiting, it
+             * checks for growth whenever the function at the front of the buffer reaches the latency threshold (at most once per
+             * threshold), otherwise it waits to be woken by growIfBacklogged().
+             */
+            void monitorBacklog();
+
+            /**
+             * The logic for each thread in the pool when using the lock free ring. It will take functions from the ring (or the
+             * overflow buffer), spinning briefly and then parking when there are none.
+             *
+             * @param index unsigned int the index of the thread
+             */
+            void waitAndProcessLockFree(unsigned int index);
+
+            /**
+             * Execute the function, recording its metrics
+             *
+             * @param &queued QueuedTask to execute
+             * @param &recorder WorkerRecorder of the executing thread
+             * @param &lastEnd std::chrono::steady_clock::time_point when the thread last finished a function (or started), updated
+             */
+            void execute(QueuedTask &queued, WorkerRecorder &recorder, std::chrono::steady_clock::time_point &lastEnd);
+
+            /**
+             * Take a function from the overflow buffer
+             *
+             * @param &queued QueuedTask into which to move the function
+             * @return bool true if there was a function to take
              */
-            void waitAndProcess();
+            bool takeOverflow(QueuedTask &queued);
     };
 }
 
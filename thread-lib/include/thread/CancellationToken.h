@@ -0,0 +1,84 @@
+#ifndef CAMB_THREAD_CANCELLATIONTOKEN_H_
+#define CAMB_THREAD_CANCELLATIONTOKEN_H_
+
+#include <atomic>
+#include <chrono>
+#include <poll.h>
+
+namespace cadf::thread {
+
+    /**
+     * Token via which blocking behavior can be cancelled, backed by an eventfd which becomes readable once cancelled. Rather than blocking
+     * in a read(), accept(), etc. directly, wait for the file descriptor via waitFor(), which polls it alongside the eventfd and so
+     * returns as soon as either is ready. Cancelling only affects those waiting on the token, no signals are involved.
+     *
+     * Each Task has a token, which is cancelled when the Thread executing it is stopped (see Task::getCancellationToken()).
+     */
+    class CancellationToken {
+        public:
+            /**
+             * CTOR
+             *
+             * @throws ThreadInitializationException if the eventfd could not be created
+             */
+            CancellationToken();
+
+            /**
+             * DTOR
+             */
+            ~CancellationToken();
+
+            CancellationToken(const CancellationToken&) = delete;
+            CancellationToken& operator=(const CancellationToken&) = delete;
+
+            /**
+             * Cancel, waking all which are waiting (and any which wait later, until reset)
+             */
+            void cancel();
+
+            /**
+             * Reset, such that the token can be waited on again
+             */
+            void reset();
+
+            /**
+             * Check whether the token has been cancelled
+             *
+             * @return bool true if cancelled
+             */
+            bool isCancelled() const;
+
+            /**
+             * Get the eventfd, for those which poll (or epoll) more than one file descriptor themselves. It is readable once cancelled.
+             *
+             * @return int the file descriptor
+             */
+            int getFd() const;
+
+            /**
+             * Wait until the file descriptor is ready, or the token is cancelled.
+             *
+             * @param fd int the file descriptor to wait for
+             * @param events short the poll events to wait for (defaults to POLLIN)
+             * @return bool true if the file descriptor is ready (including in error, so that whatever is called next reports it),
+             *         false if cancelled
+             */
+            bool waitFor(int fd, short events = POLLIN) const;
+
+            /**
+             * Sleep for the duration, waking early should the token be cancelled.
+             *
+             * @param duration std::chrono::nanoseconds how long to sleep for
+             * @return bool true if slept for the full duration, false if cancelled
+             */
+            bool sleepFor(std::chrono::nanoseconds duration) const;
+
+        private:
+            /** The eventfd */
+            int m_fd;
+            /** Flag for whether or not the token has been cancelled */
+            std::atomic<bool> m_cancelled;
+    };
+}
+
+#endif /* CAMB_THREAD_CANCELLATIONTOKEN_H_ */
@@ -0,0 +1,423 @@
+#ifndef CAMB_THREAD_FUTURE_H_
+#define CAMB_THREAD_FUTURE_H_
+
+#include "thread/ThreadPool.h"
+#include "thread/TaskFunction.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cadf::thread {
+
+    template<typename T>
+    class Future;
+
+    namespace detail {
+        /**
+         * The state shared between a Promise and its Futures
+         */
+        template<typename T>
+        struct FutureState {
+                /** What is stored for the result, void results are stored as a bool */
+                typedef std::conditional_t<std::is_void_v<T>, bool, T> Stored;
+
+                /** Protects the state */
+                std::mutex mutex;
+                /** Signalled when the result is set */
+                std::condition_variable condition;
+                /** Whether the result (value or exception) has been set */
+                bool ready = false;
+                /** The value, if successful */
+                std::optional<Stored> value;
+                /** The exception, if failed */
+                std::exception_ptr exception;
+                /** Callbacks to make once ready */
+                std::vector<TaskFunction> callbacks;
+
+                /**
+                 * Mark as ready (with the value or exception already set under the lock) and make the callbacks outside of the lock
+                 */
+                void complete(std::unique_lock<std::mutex> &lock) {
+                    ready = true;
+                    std::vector<TaskFunction> toCall = std::move(callbacks);
+                    lock.unlock();
+                    condition.notify_all();
+                    for (TaskFunction &callback : toCall)
+                        callback();
+                }
+        };
+
+        /**
+         * The type returned by Future<T>::get()
+         */
+        template<typename T>
+        struct FutureResult {
+                typedef const T& type;
+        };
+
+        template<>
+        struct FutureResult<void> {
+                typedef void type;
+        };
+    }
+
+    /**
+     * The producing side of a Future, via which the result (value or exception) is set once. Should the Promise be destroyed without
+     * a result having been set, its Futures fail with std::future_error (broken_promise).
+     *
+     * @template T the type of the value (can be void)
+     */
+    template<typename T>
+    class Promise {
+        public:
+            /**
+             * CTOR
+             */
+            Promise() : m_state(std::make_shared<detail::FutureState<T>>()) {
+            }
+
+            Promise(const Promise&) = delete;
+            Promise& operator=(const Promise&) = delete;
+            Promise(Promise&&) noexcept = default;
+
+            /**
+             * Move assignment - breaks the current promise if its result was not yet set
+             */
+            Promise& operator=(Promise &&other) noexcept {
+                if (this != &other) {
+                    abandon();
+                    m_state = std::move(other.m_state);
+                }
+                return *this;
+            }
+
+            /**
+             * DTOR - breaks the promise if its result was not yet set
+             */
+            ~Promise() {
+                abandon();
+            }
+
+            /**
+             * Get a Future for the result. Can be called any number of times, all Futures share the same result.
+             *
+             * @return Future<T> for the result
+             * @throws std::future_error (no_state) if the promise was moved from
+             */
+            Future<T> getFuture() const {
+                return Future<T>(state());
+            }
+
+            /**
+             * Set the value, waking anything waiting on the Futures and making their callbacks
+             *
+             * @param &&...args Args from which to construct the value (nothing for void)
+             * @throws std::future_error (promise_already_satisfied) if the result was already set
+             */
+            template<typename ... Args>
+            void setValue(Args &&... args) {
+                std::shared_ptr<detail::FutureState<T>> state = this->state();
+                std::unique_lock<std::mutex> lock(state->mutex);
+                if (state->ready)
+                    throw std::future_error(std::future_errc::promise_already_satisfied);
+                state->value.emplace(std::forward<Args>(args)...);
+                state->complete(lock);
+            }
+
+            /**
+             * Set the exception, waking anything waiting on the Futures and making their callbacks
+             *
+             * @param exception std::exception_ptr with which the Futures fail
+             * @throws std::future_error (promise_already_satisfied) if the result was already set
+             */
+            void setException(std::exception_ptr exception) {
+                std::shared_ptr<detail::FutureState<T>> state = this->state();
+                std::unique_lock<std::mutex> lock(state->mutex);
+                if (state->ready)
+                    throw std::future_error(std::future_errc::promise_already_satisfied);
+                state->exception = exception;
+                state->complete(lock);
+            }
+
+        private:
+            /** The shared state, nullptr when moved from */
+            std::shared_ptr<detail::FutureState<T>> m_state;
+
+            /**
+             * Get the state, ensuring that there is one
+             */
+            const std::shared_ptr<detail::FutureState<T>>& state() const {
+                if (!m_state)
+                    throw std::future_error(std::future_errc::no_state);
+                return m_state;
+            }
+
+            /**
+             * Fail the Futures if the result was not set
+             */
+            void abandon() noexcept {
+                if (!m_state)
+                    return;
+                std::unique_lock<std::mutex> lock(m_state->mutex);
+                if (!m_state->ready) {
+                    m_state->exception = std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+                    m_state->complete(lock);
+                }
+            }
+    };
+
+    namespace detail {
+        /**
+         * Execute the function, setting its result (or the exception it throws) in the promise
+         *
+         * @param &promise Promise<R> to fulfil
+         * @param &func F to execute
+         * @param &&...args Args to pass to the function
+         */
+        template<typename R, typename F, typename ... Args>
+        void fulfil(Promise<R> &promise, F &func, Args &&... args) {
+            // Only the function itself is guarded, anything thrown by the callbacks made when setting the result is not its failure
+            std::optional<typename FutureState<R>::Stored> result;
+            try {
+                if constexpr (std::is_void_v<R>) {
+                    func(std::forward<Args>(args)...);
+                    result.emplace(true);
+                } else {
+                    result.emplace(func(std::forward<Args>(args)...));
+                }
+            } catch (...) {
+                promise.setException(std::current_exception());
+                return;
+            }
+
+            if constexpr (std::is_void_v<R>)
+                promise.setValue();
+            else
+                promise.setValue(std::move(*result));
+        }
+    }
+
+    /**
+     * Handle to a result which is produced asynchronously (i.e.: by a function submitted to an IThreadPool). Rather than blocking a
+     * thread to wait for the result, continuations can be attached via then(), which are scheduled once the result is available.
+     * Futures can be copied, all copies share the same result, and any number of continuations can be attached (i.e.: to fan out).
+     *
+     * @template T the type of the value (can be void)
+     */
+    template<typename T>
+    class Future {
+        public:
+            /**
+             * CTOR - invalid, not associated with any Promise
+             */
+            Future() = default;
+
+            /**
+             * Check whether the Future is associated with a Promise
+             *
+             * @return bool true if valid
+             */
+            bool valid() const {
+                return m_state != nullptr;
+            }
+
+            /**
+             * Check whether the result has been set
+             *
+             * @return bool true if the value or exception is available
+             * @throws std::future_error (no_state) if invalid
+             */
+            bool isReady() const {
+                std::unique_lock<std::mutex> lock(state()->mutex);
+                return m_state->ready;
+            }
+
+            /**
+             * Block until the result has been set
+             *
+             * @throws std::future_error (no_state) if invalid
+             */
+            void wait() const {
+                std::unique_lock<std::mutex> lock(state()->mutex);
+                m_state->condition.wait(lock, [this] {
+                    return m_state->ready;
+                });
+            }
+
+            /**
+             * Block until the result has been set, and get it. Must not be called from a thread of the pool which is to produce the
+             * result (use then() instead).
+             *
+             * @return const T& the value (nothing for void), which remains valid for as long as any Future for it exists
+             * @throws the exception with which the Future failed
+             * @throws std::future_error (no_state) if invalid
+             */
+            typename detail::FutureResult<T>::type get() const {
+                wait();
+                if (m_state->exception)
+                    std::rethrow_exception(m_state->exception);
+                if constexpr (!std::is_void_v<T>)
+                    return *m_state->value;
+            }
+
+            /**
+             * Make a callback once the result has been set, in the thread which sets it (or immediately in the calling thread if it
+             * already is). The callback should be brief, anything longer should be scheduled.
+             *
+             * @param &&callback TaskFunction to call
+             * @throws std::future_error (no_state) if invalid
+             */
+            void onReady(TaskFunction &&callback) const {
+                std::unique_lock<std::mutex> lock(state()->mutex);
+                if (!m_state->ready) {
+                    m_state->callbacks.push_back(std::move(callback));
+                    return;
+                }
+                lock.unlock();
+                callback();
+            }
+
+            /**
+             * Schedule a continuation in the pool once the result has been set. The continuation receives the value (as const T&, or
+             * nothing for void), and its result becomes that of the returned Future. Should this Future fail, the continuation is not
+             * executed and the returned Future fails with the same exception.
+             *
+             * @param &pool IThreadPool in which to execute the continuation (must remain alive until it is executed)
+             * @param &&func F the continuation
+             * @template F the type of the continuation
+             * @return Future<R> for the result of the continuation
+             * @throws std::future_error (no_state) if invalid
+             */
+            template<typename F>
+            auto then(IThreadPool &pool, F &&func) const {
+                typedef typename Invocation<std::decay_t<F>>::type R;
+                Promise<R> promise;
+                Future<R> future = promise.getFuture();
+                std::shared_ptr<detail::FutureState<T>> state = this->state();
+                onReady([&pool, state, promise = std::move(promise), func = std::forward<F>(func)]() mutable {
+                    if (state->exception) {
+                        promise.setException(state->exception);
+                        return;
+                    }
+                    pool.schedule([state, promise = std::move(promise), func = std::move(func)]() mutable {
+                        if constexpr (std::is_void_v<T>)
+                            detail::fulfil(promise, func);
+                        else
+                            detail::fulfil(promise, func, std::as_const(*state->value));
+                    });
+                });
+                return future;
+            }
+
+        private:
+            template<typename U>
+            friend class Promise;
+
+            /**
+             * The result of invoking the continuation
+             */
+            template<typename F, bool isVoid = std::is_void_v<T>>
+            struct Invocation {
+                    typedef std::invoke_result_t<F&, const T&> type;
+            };
+
+            template<typename F>
+            struct Invocation<F, true> {
+                    typedef std::invoke_result_t<F&> type;
+            };
+
+            /** The shared state, nullptr when invalid */
+            std::shared_ptr<detail::FutureState<T>> m_state;
+
+            /**
+             * CTOR - for the Promise
+             */
+            Future(std::shared_ptr<detail::FutureState<T>> state) : m_state(std::move(state)) {
+            }
+
+            /**
+             * Get the state, ensuring that there is one
+             */
+            const std::shared_ptr<detail::FutureState<T>>& state() const {
+                if (!m_state)
+                    throw std::future_error(std::future_errc::no_state);
+                return m_state;
+            }
+
+    };
+
+    /**
+     * Schedule a function in the pool, getting a Future for its result (or the exception it throws)
+     *
+     * @param &pool IThreadPool in which to execute the function
+     * @param &&func F the function, which cannot take any parameters
+     * @template F the type of the function
+     * @return Future<R> for the result of the function
+     */
+    template<typename F>
+    Future<std::invoke_result_t<std::decay_t<F>&>> submit(IThreadPool &pool, F &&func) {
+        typedef std::invoke_result_t<std::decay_t<F>&> R;
+        Promise<R> promise;
+        Future<R> future = promise.getFuture();
+        pool.schedule([promise = std::move(promise), func = std::forward<F>(func)]() mutable {
+            detail::fulfil(promise, func);
+        });
+        return future;
+    }
+
+    /**
+     * Get a Future which becomes ready once all of the specified Futures are, without blocking a thread while waiting (i.e.: to fan in
+     * after fanning out). Should any of them fail, it fails with the exception of the first (in the order specified) to have failed.
+     *
+     * @param &futures std::vector<Future<T>> to wait for
+     * @template T the type of the values
+     * @return Future<void> which is ready once all of the Futures are
+     */
+    template<typename T>
+    Future<void> whenAll(const std::vector<Future<T>> &futures) {
+        struct Joint {
+                Promise<void> promise;
+                std::vector<Future<T>> futures;
+                std::atomic<size_t> remaining;
+
+                Joint(const std::vector<Future<T>> &futures) : futures(futures), remaining(futures.size()) {
+                }
+
+                void finish() {
+                    for (const Future<T> &future : futures) {
+                        try {
+                            future.get();
+                        } catch (...) {
+                            promise.setException(std::current_exception());
+                            return;
+                        }
+                    }
+                    promise.setValue();
+                }
+        };
+
+        std::shared_ptr<Joint> joint = std::make_shared<Joint>(futures);
+        Future<void> result = joint->promise.getFuture();
+        if (futures.empty()) {
+            joint->promise.setValue();
+            return result;
+        }
+        for (const Future<T> &future : futures) {
+            future.onReady([joint] {
+                if (joint->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    joint->finish();
+            });
+        }
+        return result;
+    }
+}
+
+#endif /* CAMB_THREAD_FUTURE_H_ */
@@ -0,0 +1,156 @@
+#ifndef CAMB_THREAD_MPMCQUEUE_H_
+#define CAMB_THREAD_MPMCQUEUE_H_
+
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <utility>
+
+namespace cadf::thread {
+
+    /**
+     * Bounded lock free queue for any number of producers and consumers, as per Dmitry Vyukov's bounded MPMC queue. Each slot of the
+     * ring carries a sequence number which tells producers and consumers whether it is theirs to fill or empty, so that the only point
+     * of contention is a single compare and swap on the enqueue or dequeue position. Items are dequeued in the order in which their
+     * producers claimed a slot.
+     *
+     * @template T the type of the items, which must be default constructible and move assignable
+     */
+    template<typename T>
+    class MpmcQueue {
+        public:
+            /**
+             * CTOR
+             *
+             * @param capacity size_t the maximum number of items, rounded up to a power of two (at least 2)
+             */
+            MpmcQueue(size_t capacity) : m_enqueuePos(0), m_dequeuePos(0) {
+                size_t size = 2;
+                while (size < capacity)
+                    size <<= 1;
+                m_mask = size - 1;
+                m_cells.reset(new Cell[size]);
+                for (size_t i = 0; i < size; i++)
+                    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            MpmcQueue(const MpmcQueue&) = delete;
+            MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+            /**
+             * Add an item to the back of the queue, unless it is full.
+             *
+             * @param &&item U to add (it is left untouched if the queue is full)
+             * @template U the type of the item, which must be assignable to T
+             * @return bool true if the item was added, false if the queue is full
+             */
+            template<typename U>
+            bool tryPush(U &&item) {
+                Cell *cell;
+                size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+                while (true) {
+                    cell = &m_cells[pos & m_mask];
+                    intptr_t diff = intptr_t(cell->sequence.load(std::memory_order_acquire)) - intptr_t(pos);
+                    if (diff == 0) {
+                        // The slot is free, claim it
+                        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    } else if (diff < 0) {
+                        // The slot has not been emptied since the previous lap
+                        return false;
+                    } else {
+                        // Another producer claimed the slot
+                        pos = m_enqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+
+                cell->data = std::forward<U>(item);
+                cell->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * Remove the item from the front of the queue, unless it is empty.
+             *
+             * @param &item T into which to move the item
+             * @return bool true if an item was removed, false if the queue is empty
+             */
+            bool tryPop(T &item) {
+                Cell *cell;
+                size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+                while (true) {
+                    cell = &m_cells[pos & m_mask];
+                    intptr_t diff = intptr_t(cell->sequence.load(std::memory_order_acquire)) - intptr_t(pos + 1);
+                    if (diff == 0) {
+                        // The slot is filled, claim it
+                        if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    } else if (diff < 0) {
+                        // The slot has not been filled yet
+                        return false;
+                    } else {
+                        // Another consumer claimed the slot
+                        pos = m_dequeuePos.load(std::memory_order_relaxed);
+                    }
+                }
+
+                item = std::move(cell->data);
+                // Release whatever the moved from item may still hold, rather than waiting for the slot to be reused
+                cell->data = T();
+                cell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * Check whether the queue appears to be empty. This is only a snapshot, an item whose producer claimed its slot is
+             * considered to be in the queue even while it is still being written.
+             *
+             * @return bool true if there were no items in the queue
+             */
+            bool empty() const {
+                return m_dequeuePos.load(std::memory_order_acquire) >= m_enqueuePos.load(std::memory_order_acquire);
+            }
+
+            /**
+             * Get the number of items in the queue. Like empty(), this is only a snapshot.
+             *
+             * @return size_t the number of items
+             */
+            size_t size() const {
+                size_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+                size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+                return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+            }
+
+            /**
+             * Get the maximum number of items in the queue
+             *
+             * @return size_t the capacity
+             */
+            size_t capacity() const {
+                return m_mask + 1;
+            }
+
+        private:
+            /**
+             * Slot within the ring
+             */
+            struct Cell {
+                /** The position for which the slot is ready to be filled (== position) or emptied (== position + 1) */
+                std::atomic<size_t> sequence;
+                /** The item */
+                T data;
+            };
+
+            /** Mask mapping a position onto the ring (size - 1) */
+            size_t m_mask;
+            /** The slots of the ring */
+            std::unique_ptr<Cell[]> m_cells;
+            /** The position at which the next item is added */
+            alignas(64) std::atomic<size_t> m_enqueuePos;
+            /** The position from which the next item is removed */
+            alignas(64) std::atomic<size_t> m_dequeuePos;
+    };
+}
+
+#endif /* CAMB_THREAD_MPMCQUEUE_H_ */
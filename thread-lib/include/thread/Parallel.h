@@ -0,0 +1,292 @@
+#ifndef CAMB_THREAD_PARALLEL_H_
+#define CAMB_THREAD_PARALLEL_H_
+
+#include "thread/ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Data parallel algorithms which split a range into chunks (of the grain size), executed by the threads of a pool as well as the
+ * calling thread. The calling thread returns once all of the chunks have been processed, so that the algorithms can also be used from
+ * within one of the pool's threads without the risk of deadlocking (it then simply processes whatever the other threads do not get
+ * to). Should processing a chunk throw, the chunks which have not yet started are skipped and the exception of the first to have
+ * thrown is rethrown in the calling thread.
+ *
+ * A grain size of 0 selects it automatically, splitting the range into 4 chunks per hardware thread so that uneven work is balanced.
+ * An explicit grain size should be used when elements are very cheap (larger) or very expensive (smaller) to process.
+ */
+namespace cadf::thread {
+
+    namespace detail {
+        /**
+         * Chunks into which a range is split, claimed by the calling thread as well as helpers scheduled in the pool
+         *
+         * @template F the type of the function which processes a chunk: void(size_t chunk, size_t begin, size_t end)
+         */
+        template<typename F>
+        struct ParallelRegion {
+                /** Processes a chunk (only called while the calling thread is waiting, so the reference remains valid) */
+                F &func;
+                /** Number of elements in the range */
+                size_t count;
+                /** Number of elements per chunk */
+                size_t grainSize;
+                /** Number of chunks */
+                size_t numChunks;
+                /** The next chunk to be claimed */
+                std::atomic<size_t> nextChunk;
+                /** Set once a chunk has thrown, so that the remaining ones are skipped */
+                std::atomic<bool> failed;
+                /** Protects the completion and exception */
+                std::mutex mutex;
+                /** Signalled once all of the chunks have completed */
+                std::condition_variable condition;
+                /** Number of chunks which have completed */
+                size_t completed;
+                /** The exception of the first chunk to have thrown */
+                std::exception_ptr exception;
+
+                ParallelRegion(F &func, size_t count, size_t grainSize) : func(func), count(count), grainSize(grainSize),
+                        numChunks((count + grainSize - 1) / grainSize), nextChunk(0), failed(false), completed(0) {
+                }
+
+                /**
+                 * Claim and process chunks until there are none left
+                 */
+                void work() {
+                    size_t done = 0;
+                    for (size_t chunk = nextChunk.fetch_add(1); chunk < numChunks; chunk = nextChunk.fetch_add(1)) {
+                        if (!failed.load(std::memory_order_relaxed)) {
+                            try {
+                                func(chunk, chunk * grainSize, std::min(count, (chunk + 1) * grainSize));
+                            } catch (...) {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                if (!exception)
+                                    exception = std::current_exception();
+                                failed = true;
+                            }
+                        }
+                        done++;
+                    }
+
+                    if (done > 0) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        completed += done;
+                        if (completed == numChunks)
+                            condition.notify_all();
+                    }
+                }
+        };
+
+        /**
+         * Determine the grain size to use
+         *
+         * @param count size_t number of elements
+         * @param grainSize size_t requested grain size (0 for automatic)
+         * @return size_t the grain size (at least 1)
+         */
+        inline size_t grainSizeFor(size_t count, size_t grainSize) {
+            if (grainSize > 0)
+                return grainSize;
+            size_t numChunks = std::max(1u, std::thread::hardware_concurrency()) * 4;
+            return std::max<size_t>(1, (count + numChunks - 1) / numChunks);
+        }
+
+        /**
+         * Split the range into chunks and process them, in the pool and in the calling thread
+         *
+         * @param &pool IThreadPool providing the additional threads
+         * @param count size_t number of elements
+         * @param grainSize size_t number of elements per chunk (0 for automatic)
+         * @param &&func F processing a chunk: void(size_t chunk, size_t begin, size_t end)
+         */
+        template<typename F>
+        void parallelChunks(IThreadPool &pool, size_t count, size_t grainSize, F &&func) {
+            if (count == 0)
+                return;
+
+            typedef ParallelRegion<std::remove_reference_t<F>> Region;
+            std::shared_ptr<Region> region = std::make_shared<Region>(func, count, grainSizeFor(count, grainSize));
+            // Helpers which only start once all of the chunks were claimed return without touching the function
+            size_t numHelpers = std::min<size_t>(region->numChunks, std::max(1u, std::thread::hardware_concurrency())) - 1;
+            for (size_t i = 0; i < numHelpers; i++)
+                pool.schedule([region] { region->work(); });
+
+            region->work();
+
+            std::unique_lock<std::mutex> lock(region->mutex);
+            region->condition.wait(lock, [&region] {
+                return region->completed == region->numChunks;
+            });
+            if (region->exception)
+                std::rethrow_exception(region->exception);
+        }
+    }
+
+    /**
+     * Call the function for every index within [begin, end)
+     *
+     * @param &pool IThreadPool providing the additional threads
+     * @param begin Index the first index
+     * @param end Index one past the last index
+     * @param &&func F called with each index
+     * @param grainSize size_t number of indices per chunk (defaults to 0, automatic)
+     * @template Index integral type of the indices
+     * @template F the type of the function: void(Index)
+     */
+    template<typename Index, typename F>
+    void parallelFor(IThreadPool &pool, Index begin, typename std::common_type<Index>::type end, F &&func, size_t grainSize = 0) {
+        static_assert(std::is_integral_v<Index>, "parallelFor requires integral indices");
+        if (end <= begin)
+            return;
+
+        detail::parallelChunks(pool, size_t(end - begin), grainSize, [begin, &func](size_t, size_t from, size_t to) {
+            for (size_t i = from; i < to; i++)
+                func(Index(begin + i));
+        });
+    }
+
+    /**
+     * Apply the operation to every element of the input, storing the results in the output (which may be the input)
+     *
+     * @param &pool IThreadPool providing the additional threads
+     * @param first InputIterator the start of the input
+     * @param last InputIterator the end of the input
+     * @param result OutputIterator the start of the output
+     * @param op Op applied to each element
+     * @param grainSize size_t number of elements per chunk (defaults to 0, automatic)
+     * @template InputIterator random access iterator of the input
+     * @template OutputIterator random access iterator of the output
+     * @template Op the type of the operation
+     * @return OutputIterator one past the last element written
+     */
+    template<typename InputIterator, typename OutputIterator, typename Op>
+    OutputIterator parallelTransform(IThreadPool &pool, InputIterator first, InputIterator last, OutputIterator result, Op op, size_t grainSize = 0) {
+        size_t count = std::distance(first, last);
+        detail::parallelChunks(pool, count, grainSize, [first, result, &op](size_t, size_t from, size_t to) {
+            std::transform(first + from, first + to, result + from, op);
+        });
+        return result + count;
+    }
+
+    /**
+     * Combine all of the elements with the operation. Each chunk is reduced on its own, and the results of the chunks are then
+     * combined in order, such that the operation must be associative (but need not be commutative).
+     *
+     * @param &pool IThreadPool providing the additional threads
+     * @param first Iterator the start of the range
+     * @param last Iterator the end of the range
+     * @param init T the initial value, combined with the result of the first chunk
+     * @param op Op combining two values: T(const T&, const T&), with each chunk starting from its first element (so the elements
+     *           must be convertible to T, see the overload with a separate combining operation otherwise)
+     * @param grainSize size_t number of elements per chunk (defaults to 0, automatic)
+     * @template Iterator random access iterator of the range
+     * @template T the type of the result
+     * @template Op the type of the operation
+     * @return T the result (init if the range is empty)
+     */
+    template<typename Iterator, typename T, typename Op>
+    T parallelReduce(IThreadPool &pool, Iterator first, Iterator last, T init, Op op, size_t grainSize = 0) {
+        size_t count = std::distance(first, last);
+        grainSize = detail::grainSizeFor(count, grainSize);
+        std::vector<std::optional<T>> partials((count + grainSize - 1) / grainSize);
+        detail::parallelChunks(pool, count, grainSize, [first, &op, &partials](size_t chunk, size_t from, size_t to) {
+            T partial = first[from];
+            for (size_t i = from + 1; i < to; i++)
+                partial = op(partial, first[i]);
+            partials[chunk].emplace(std::move(partial));
+        });
+
+        for (std::optional<T> &partial : partials)
+            init = op(init, std::move(*partial));
+        return init;
+    }
+
+    /**
+     * Combine all of the elements with the operation, where the elements are of a different type than the result (i.e.: summing the
+     * lengths of strings). Each chunk starts from the identity and is reduced on its own with op, and the results of the chunks are
+     * then combined in order with combine, such that both must be associative (but need not be commutative).
+     *
+     * @param &pool IThreadPool providing the additional threads
+     * @param first Iterator the start of the range
+     * @param last Iterator the end of the range
+     * @param identity T the identity of combine, from which each chunk starts
+     * @param op Op adding an element to the result of a chunk: T(const T&, element)
+     * @param combine Combine combining the results of two chunks: T(const T&, const T&)
+     * @param grainSize size_t number of elements per chunk (defaults to 0, automatic)
+     * @template Iterator random access iterator of the range
+     * @template T the type of the result
+     * @template Op the type of the operation
+     * @template Combine the type of the combining operation
+     * @return T the result (identity if the range is empty)
+     */
+    template<typename Iterator, typename T, typename Op, typename Combine, typename = std::enable_if_t<!std::is_integral_v<Combine>>>
+    T parallelReduce(IThreadPool &pool, Iterator first, Iterator last, T identity, Op op, Combine combine, size_t grainSize = 0) {
+        size_t count = std::distance(first, last);
+        grainSize = detail::grainSizeFor(count, grainSize);
+        std::vector<std::optional<T>> partials((count + grainSize - 1) / grainSize);
+        detail::parallelChunks(pool, count, grainSize, [first, &identity, &op, &partials](size_t chunk, size_t from, size_t to) {
+            T partial = identity;
+            for (size_t i = from; i < to; i++)
+                partial = op(partial, first[i]);
+            partials[chunk].emplace(std::move(partial));
+        });
+
+        if (partials.empty())
+            return identity;
+        T result = std::move(*partials[0]);
+        for (size_t i = 1; i < partials.size(); i++)
+            result = combine(result, std::move(*partials[i]));
+        return result;
+    }
+
+    /**
+     * Sort the range. The chunks are each sorted, after which pairs of adjacent sorted runs are merged until a single run remains,
+     * with each round of merges also being performed in parallel. The sort is not stable.
+     *
+     * @param &pool IThreadPool providing the additional threads
+     * @param first Iterator the start of the range
+     * @param last Iterator the end of the range
+     * @param comp Compare the ordering of the elements (defaults to std::less)
+     * @param grainSize size_t number of elements per chunk, below which the range is sorted by a single thread (defaults to 0, automatic)
+     * @template Iterator random access iterator of the range
+     * @template Compare the type of the ordering
+     */
+    template<typename Iterator, typename Compare = std::less<>>
+    void parallelSort(IThreadPool &pool, Iterator first, Iterator last, Compare comp = Compare(), size_t grainSize = 0) {
+        size_t count = std::distance(first, last);
+        grainSize = detail::grainSizeFor(count, grainSize);
+        if (count <= grainSize) {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        detail::parallelChunks(pool, count, grainSize, [first, &comp](size_t, size_t from, size_t to) {
+            std::sort(first + from, first + to, comp);
+        });
+
+        // Merge pairs of adjacent runs, doubling the length of the runs each round
+        for (size_t run = grainSize; run < count; run *= 2) {
+            size_t numMerges = (count + 2 * run - 1) / (2 * run);
+            detail::parallelChunks(pool, numMerges, 1, [first, count, run, &comp](size_t, size_t merge, size_t) {
+                size_t from = merge * 2 * run;
+                size_t middle = std::min(count, from + run);
+                size_t to = std::min(count, from + 2 * run);
+                std::inplace_merge(first + from, first + middle, first + to, comp);
+            });
+        }
+    }
+}
+
+#endif /* CAMB_THREAD_PARALLEL_H_ */
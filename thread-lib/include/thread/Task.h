@@ -1,7 +1,9 @@
 #ifndef CAMB_THREAD_TASK_H_
 #define CAMB_THREAD_TASK_H_
 
-#include <csignal>
+#include "thread/CancellationToken.h"
+
+#include <atomic>
 
 namespace cadf::thread {
 
@@ -9,8 +11,8 @@ namespace cadf::thread {
      * Task that is to be executed within a Thread. The logic of the task it be contained within the exec(), with scheduleStop() being used to allow
      * premature stop/abort. LoopingTask can also be used to help facilitate a repetitive action (i.e.: reading messages).
      *
-     * Note: for any blocking behavior an interrupt signal (SIGINT) will be raised when stopping the task. Ensure that any/all blocking behavior respect
-     * this signal to properly ensure that the task can terminate on thread stop.
+     * Note: for any blocking behavior the task must wait via its CancellationToken (see getCancellationToken()), which is cancelled when stopping the
+     * task. Ensure that any/all blocking behavior respects the token to properly ensure that the task can terminate on thread stop.
      */
     class Task {
         public:
@@ -31,25 +33,40 @@ namespace cadf::thread {
 
         protected:
             /**
-             * Make the task sleep for the specified amount of time
+             * Get the token which is cancelled when the Thread executing the task is stopped (and reset when it is started). Blocking calls
+             * should wait for their file descriptor via CancellationToken::waitFor() first, such that they return on stop.
+             *
+             * @return const CancellationToken& the token
+             */
+            const CancellationToken& getCancellationToken() const;
+
+            /**
+             * Make the task sleep for the specified amount of time, waking early should the task be stopped
              *
              * @param secs unsigned int the number of seconds to sleep for
              */
             void ssleep(unsigned int secs);
 
             /**
-             * Make the task sleep for the specified amount of time
+             * Make the task sleep for the specified amount of time, waking early should the task be stopped
              *
              * @param secs unsigned int the number of milliseconds to sleep for
              */
             void msleep(unsigned int millisecs);
 
             /**
-             * Make the task sleep for the specified amount of time
+             * Make the task sleep for the specified amount of time, waking early should the task be stopped
              *
              * @param secs unsigned int the number of microseconds to sleep for
              */
             void usleep(unsigned int microsecs);
+
+        private:
+            /** Cancelled when the thread executing the task is stopped */
+            CancellationToken m_cancellationToken;
+
+            // The thread cancels and resets the token
+            friend class Thread;
     };
 
     /**
@@ -79,14 +96,14 @@ namespace cadf::thread {
             virtual void execLoop() = 0;
 
             /**
-             * Stops the looping behavior, will not break out of the execLoop. Any blocking behavior within must be allow itself to be interrupted
-             * with the interrupt signal (SIGINT)
+             * Stops the looping behavior, will not break out of the execLoop. Any blocking behavior within must allow itself to be interrupted
+             * via the CancellationToken (see Task::getCancellationToken())
              */
             virtual void scheduleStop();
 
         private:
             /** Flag for whether or not the end of the execution loop is desired */
-            bool m_quitting;
+            std::atomic<bool> m_quitting;
     };
 
 }
@@ -0,0 +1,221 @@
+#ifndef CAMB_THREAD_TASKFUNCTION_H_
+#define CAMB_THREAD_TASKFUNCTION_H_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cadf::thread {
+
+    /**
+     * Move only wrapper for a function which takes no parameters, as is scheduled for execution in a thread pool. Unlike a
+     * std::function it cannot be copied, so that it can hold move only captures (i.e.: a std::unique_ptr) and is never copied on its
+     * way through the queue of a pool. Functions whose captures fit within INLINE_SIZE bytes (and which can be moved without throwing)
+     * are stored inline, rather than being allocated on the heap, such that scheduling a small lambda does not allocate at all.
+     *
+     * Any callable can be implicitly converted into a TaskFunction, including a std::function.
+     */
+    class TaskFunction {
+        public:
+            /** The number of bytes available for storing the function inline */
+            static constexpr size_t INLINE_SIZE = 48;
+
+            /**
+             * CTOR - empty
+             */
+            TaskFunction() noexcept : m_ops(nullptr) {
+            }
+
+            /**
+             * CTOR - empty
+             */
+            TaskFunction(std::nullptr_t) noexcept : m_ops(nullptr) {
+            }
+
+            /**
+             * CTOR
+             *
+             * Takes over the function, which is stored inline if it fits. An empty std::function (or null function pointer) results in
+             * an empty TaskFunction.
+             *
+             * @param &&func F the function to wrap
+             * @template F the type of the function, which must be callable without any parameters
+             */
+            template<typename F, typename Callable = std::decay_t<F>,
+                    typename = std::enable_if_t<!std::is_same_v<Callable, TaskFunction> && std::is_invocable_v<Callable&>>>
+            TaskFunction(F &&func) : m_ops(nullptr) {
+                if (isEmpty(func))
+                    return;
+
+                if constexpr (fitsInline<Callable>()) {
+                    new (&m_storage) Callable(std::forward<F>(func));
+                    m_ops = &InlineOps<Callable>::OPS;
+                } else {
+                    *reinterpret_cast<Callable**>(&m_storage) = new Callable(std::forward<F>(func));
+                    m_ops = &HeapOps<Callable>::OPS;
+                }
+            }
+
+            TaskFunction(const TaskFunction&) = delete;
+            TaskFunction& operator=(const TaskFunction&) = delete;
+
+            /**
+             * Move CTOR - the other is left empty
+             */
+            TaskFunction(TaskFunction &&other) noexcept : m_ops(nullptr) {
+                take(other);
+            }
+
+            /**
+             * Move assignment - the current function (if any) is released, and the other is left empty
+             */
+            TaskFunction& operator=(TaskFunction &&other) noexcept {
+                if (this != &other) {
+                    reset();
+                    take(other);
+                }
+                return *this;
+            }
+
+            /**
+             * DTOR
+             */
+            ~TaskFunction() {
+                reset();
+            }
+
+            /**
+             * Execute the function
+             *
+             * @throws std::bad_function_call if empty
+             */
+            void operator()() {
+                if (m_ops == nullptr)
+                    throw std::bad_function_call();
+                m_ops->invoke(&m_storage);
+            }
+
+            /**
+             * Check whether there is a function
+             *
+             * @return bool true if there is a function to execute
+             */
+            explicit operator bool() const noexcept {
+                return m_ops != nullptr;
+            }
+
+            /**
+             * Check whether the function is stored inline (rather than on the heap)
+             *
+             * @return bool true if there is a function and it is stored inline
+             */
+            bool isInline() const noexcept {
+                return m_ops != nullptr && m_ops->isInline;
+            }
+
+            /**
+             * Release the function (if any), leaving the TaskFunction empty
+             */
+            void reset() noexcept {
+                if (m_ops != nullptr) {
+                    m_ops->destroy(&m_storage);
+                    m_ops = nullptr;
+                }
+            }
+
+        private:
+            /**
+             * The operations for the type of function that is stored
+             */
+            struct Ops {
+                /** Execute the function */
+                void (*invoke)(void *storage);
+                /** Move the function from one storage to another, leaving nothing to destroy in the former */
+                void (*move)(void *from, void *to) noexcept;
+                /** Destroy the function */
+                void (*destroy)(void *storage) noexcept;
+                /** Whether the function is stored inline */
+                bool isInline;
+            };
+
+            /**
+             * Operations for a function stored inline
+             */
+            template<typename Callable>
+            struct InlineOps {
+                static void invoke(void *storage) {
+                    (*static_cast<Callable*>(storage))();
+                }
+
+                static void move(void *from, void *to) noexcept {
+                    new (to) Callable(std::move(*static_cast<Callable*>(from)));
+                    static_cast<Callable*>(from)->~Callable();
+                }
+
+                static void destroy(void *storage) noexcept {
+                    static_cast<Callable*>(storage)->~Callable();
+                }
+
+                static constexpr Ops OPS = { &invoke, &move, &destroy, true };
+            };
+
+            /**
+             * Operations for a function stored on the heap, the storage holding the pointer to it
+             */
+            template<typename Callable>
+            struct HeapOps {
+                static void invoke(void *storage) {
+                    (**static_cast<Callable**>(storage))();
+                }
+
+                static void move(void *from, void *to) noexcept {
+                    *static_cast<Callable**>(to) = *static_cast<Callable**>(from);
+                }
+
+                static void destroy(void *storage) noexcept {
+                    delete *static_cast<Callable**>(storage);
+                }
+
+                static constexpr Ops OPS = { &invoke, &move, &destroy, false };
+            };
+
+            /** The operations for the stored function, nullptr when empty */
+            const Ops *m_ops;
+            /** The function itself when stored inline, otherwise a pointer to it */
+            alignas(std::max_align_t) unsigned char m_storage[INLINE_SIZE];
+
+            /**
+             * Check whether the type of function can be stored inline
+             */
+            template<typename Callable>
+            static constexpr bool fitsInline() {
+                return sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Callable>;
+            }
+
+            /**
+             * Check whether the function is empty, which only std::function and function pointers can be
+             */
+            template<typename Callable>
+            static bool isEmpty(const Callable &func) {
+                if constexpr (std::is_pointer_v<Callable> || std::is_constructible_v<bool, const Callable&>)
+                    return !func;
+                else
+                    return false;
+            }
+
+            /**
+             * Take over the function of the other, leaving it empty
+             */
+            void take(TaskFunction &other) noexcept {
+                if (other.m_ops != nullptr) {
+                    other.m_ops->move(&other.m_storage, &m_storage);
+                    m_ops = other.m_ops;
+                    other.m_ops = nullptr;
+                }
+            }
+    };
+}
+
+#endif /* CAMB_THREAD_TASKFUNCTION_H_ */
@@ -0,0 +1,82 @@
+#ifndef CAMB_THREAD_TASKGRAPH_H_
+#define CAMB_THREAD_TASKGRAPH_H_
+
+#include "thread/Future.h"
+#include "thread/TaskFunction.h"
+#include "thread/ThreadPool.h"
+
+#include <memory>
+#include <vector>
+
+namespace cadf::thread {
+
+    /**
+     * Directed acyclic graph of tasks, in which each task is executed in a thread pool as soon as all of the tasks on which it depends
+     * have completed (i.e.: deserializing several parts in parallel, then merging them). No thread blocks waiting for a dependency,
+     * completing a task schedules those of its dependents which became ready, the last of which is executed directly by the same
+     * thread rather than passing through the queue of the pool.
+     *
+     * A task can only depend on tasks which were added before it, so that the graph cannot contain any cycles.
+     */
+    class TaskGraph {
+        public:
+            /** Identifies a task within the graph */
+            typedef size_t TaskId;
+
+            /**
+             * Add a task to the graph
+             *
+             * @param &&task TaskFunction to execute
+             * @param &dependencies std::vector<TaskId> of the tasks which must complete before it is executed (defaults to none)
+             * @return TaskId of the task
+             * @throws TaskGraphException if a dependency is not a task within the graph
+             */
+            TaskId add(TaskFunction &&task, const std::vector<TaskId> &dependencies = { });
+
+            /**
+             * Get the number of tasks in the graph
+             *
+             * @return size_t the number of tasks
+             */
+            size_t size() const;
+
+            /**
+             * Execute the tasks in the pool. The tasks are moved out of the graph, leaving it empty, so that the graph need not outlive
+             * the run. Should a task throw, the tasks which have not yet started are skipped, and the returned Future fails with the
+             * exception of the first task to have thrown.
+             *
+             * @param &pool IThreadPool in which to execute the tasks (must remain alive until they complete)
+             * @return Future<void> which becomes ready once all of the tasks have completed
+             */
+            Future<void> run(IThreadPool &pool);
+
+        private:
+            /**
+             * A task within the graph
+             */
+            struct Node {
+                    /** The task to execute */
+                    TaskFunction task;
+                    /** The tasks which depend on this one */
+                    std::vector<TaskId> dependents;
+                    /** The number of tasks on which this one depends */
+                    size_t numDependencies;
+            };
+
+            /** The state of a run */
+            struct Run;
+
+            /** The tasks, by their ID */
+            std::vector<Node> m_nodes;
+
+            /**
+             * Execute the task, followed by any of its dependents which become ready
+             *
+             * @param run std::shared_ptr<Run> the run to which the task belongs
+             * @param id TaskId of the task
+             */
+            static void execute(std::shared_ptr<Run> run, TaskId id);
+    };
+}
+
+#endif /* CAMB_THREAD_TASKGRAPH_H_ */
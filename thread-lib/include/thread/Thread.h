@@ -2,37 +2,12 @@
 #define CAMB_THREAD_THREAD_H_
 
 #include "thread/Task.h"
+#include "thread/ThreadConfig.h"
 #include <thread>
 #include <atomic>
 
 namespace cadf::thread {
 
-    /**
-     * Helper that makes sure that the interruption is properly configured for a thread.
-     */
-    class ThreadInterruptConfigurator {
-        public:
-            /** The signal that is to be raised to interrupt the blocking behavior within a thread */
-            static const int INTERRUPT_SIGNAL = SIGINT;
-
-            /**
-             * Configure the interruption signal.
-             */
-            static void configure();
-
-        private:
-            /** Flag for whether the configuration has already been performed */
-            static bool m_isConfigured;
-
-            /**
-             * Signal handler for processing the raised signal. Note, that this does nothing as it is only present to ensure that the interrupt signal
-             * is properly handled.
-             *
-             * @param int the raised signal (not used)
-             */
-            static void processSignal(int);
-    };
-
     /**
      * Thread that will execute the logic in the specified executable in a separate thread. Also provides the necessary functionality in order to fully
      * manage the new thread.
@@ -45,8 +20,9 @@ namespace cadf::thread {
              * Creates a new thread in which the specified task will be executed.
              *
              * @param *task Task to be executed within the thread.
+             * @param &config const ThreadConfig to apply to the thread when it starts (defaults to inheriting everything)
              */
-            Thread(Task *task);
+            Thread(Task *task, const ThreadConfig &config = ThreadConfig());
 
             /**
              * DTOR
@@ -57,11 +33,14 @@ namespace cadf::thread {
 
             /**
              * Start executing the task.
+             *
+             * @throws ThreadInitializationException if the ThreadConfig could not be applied (the task is then not executed)
              */
             virtual void start();
 
             /**
-             * Stop executing the task
+             * Stop executing the task. Once the task has been scheduled to stop, its CancellationToken is cancelled to wake it from any
+             * blocking behavior, and the thread is then joined.
              */
             virtual void stop();
 
@@ -75,6 +54,8 @@ namespace cadf::thread {
         private:
             /** The task to execute within this thread */
             Task *m_task;
+            /** The configuration to apply to the thread */
+            ThreadConfig m_config;
             /** Flag for whether or not the task is executing */
             std::atomic<bool> m_alive;
             /** The thread in which the task will actually execute */
@@ -92,8 +73,10 @@ namespace cadf::thread {
              * CTOR
              *
              * Creates a new thread, where the thread itself is the executable.
+             *
+             * @param &config const ThreadConfig to apply to the thread when it starts (defaults to inheriting everything)
              */
-            OneShotThread();
+            OneShotThread(const ThreadConfig &config = ThreadConfig());
 
             /**
              * DTOR
@@ -125,8 +108,10 @@ namespace cadf::thread {
              * CTOR
              *
              * Creates a new thread, where the thread itself is the executable.
+             *
+             * @param &config const ThreadConfig to apply to the thread when it starts (defaults to inheriting everything)
              */
-            LoopingThread();
+            LoopingThread(const ThreadConfig &config = ThreadConfig());
 
             /**
              * DTOR
@@ -0,0 +1,86 @@
+#ifndef CAMB_THREAD_THREADCONFIG_H_
+#define CAMB_THREAD_THREADCONFIG_H_
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cadf::thread {
+
+    /**
+     * Configuration which is applied to a thread when it starts: its name, the CPUs on which it may run, the NUMA node from which its
+     * memory is preferably allocated, and its scheduling policy and priority. Anything which is left at its default is inherited from
+     * the thread which created it, such that a default constructed ThreadConfig changes nothing.
+     *
+     * Accepted by Thread (and so OneShotThread and LoopingThread), as well as the thread pools, for which it applies to each of their
+     * threads (see applyToCurrentThread() for how the name and CPUs are then assigned).
+     */
+    struct ThreadConfig {
+            /**
+             * The scheduling policy
+             */
+            enum class Policy {
+                /** Inherited from the creating thread (priority ignored) */
+                INHERIT,
+                /** SCHED_OTHER, the priority is the nice value (-20 to 19) */
+                OTHER,
+                /** SCHED_BATCH, the priority is the nice value (-20 to 19) */
+                BATCH,
+                /** SCHED_IDLE (priority ignored) */
+                IDLE,
+                /** SCHED_FIFO real time, the priority is 1 to 99 */
+                FIFO,
+                /** SCHED_RR real time, the priority is 1 to 99 */
+                RR
+            };
+
+            /** Name of the thread, as shown by top, perf, gdb, etc. (truncated to 15 characters, empty to leave as is) */
+            std::string name;
+            /** The CPUs on which the thread may run (empty for any) */
+            std::vector<int> cpus;
+            /** For a pool, whether each thread is pinned to a single CPU of the set (round robin), rather than all of them sharing it */
+            bool pinEach = false;
+            /** The NUMA node, restricting the thread to its CPUs and preferably allocating memory from it (-1 for any) */
+            int numaNode = -1;
+            /** The scheduling policy */
+            Policy policy = Policy::INHERIT;
+            /** The priority, as per the policy */
+            int priority = 0;
+
+            /**
+             * Apply the configuration to the calling thread.
+             *
+             * For the threads of a pool, the index of the thread is appended to the name ("name-index"), and with pinEach the
+             * thread is pinned to the CPU at the index (modulo the number of CPUs). Names are limited to 15 characters, should the
+             * name be too long it is truncated such that the index is retained.
+             *
+             * @param index int the index of the thread within its pool (defaults to -1, for a thread which is not part of a pool)
+             * @throws ThreadInitializationException if the configuration is invalid, or could not be applied (i.e.: insufficient
+             *         privileges for a real time policy)
+             */
+            void applyToCurrentThread(int index = -1) const;
+
+            /**
+             * Get the CPUs of the NUMA node
+             *
+             * @param node int the NUMA node
+             * @return std::vector<int> of its CPUs
+             * @throws ThreadInitializationException if there is no such node
+             */
+            static std::vector<int> cpusOfNumaNode(int node);
+
+            /**
+             * Start the threads for a pool. Each thread applies the configuration, and only once all of them have done so
+             * successfully do they proceed to execute the body. Should any fail, none of them execute the body.
+             *
+             * @param count unsigned int the number of threads
+             * @param body std::function<void(unsigned int)> to execute in each thread, given its index
+             * @return std::vector<std::thread> the threads
+             * @throws ThreadInitializationException if the configuration could not be applied (the threads are joined first)
+             */
+            std::vector<std::thread> startThreads(unsigned int count, std::function<void(unsigned int)> body) const;
+    };
+}
+
+#endif /* CAMB_THREAD_THREADCONFIG_H_ */
@@ -13,6 +13,14 @@ namespace cadf::thread {
             ThreadInitializationException(const std::string &reason): std::runtime_error("Unable to perform thread initialization: " + reason) {
             }
     };
+
+    /**
+     * Exception that is to be thrown when a task graph is constructed incorrectly
+     */
+    struct TaskGraphException: public std::runtime_error {
+            TaskGraphException(const std::string &reason): std::runtime_error("Invalid task graph: " + reason) {
+            }
+    };
 }
 
 #endif /* CAMB_THREAD_THREADEXCEPTION_H_ */
@@ -1,6 +1,8 @@
 #ifndef CAMB_THREAD_THREADPOOL_H_
 #define CAMB_THREAD_THREADPOOL_H_
 
+#include "thread/TaskFunction.h"
+
 #include <vector>
 #include <queue>
 #include <functional>
@@ -20,12 +22,14 @@ namespace cadf::thread {
             virtual ~IThreadPool() = default;
 
             /**
-             * Schedules a std::function for execution. The function cannot take any parameters, and it will be placed
-             * in a buffer until an available thread is able to proceed with its execution.
+             * Schedules a function for execution. The function cannot take any parameters, and it will be placed
+             * in a buffer until an available thread is able to proceed with its execution. Any callable (i.e.: a lambda,
+             * std::bind, or std::function) is implicitly converted into a TaskFunction, which is moved (never copied) through
+             * the buffer.
              *
-             * @param func std::function<void()> that is to be scheduled for execution within the next available thread.
+             * @param &&task TaskFunction that is to be scheduled for execution within the next available thread.
              */
-            virtual void schedule(std::function<void()> func) = 0;
+            virtual void schedule(TaskFunction &&task) = 0;
     };
 }
 
@@ -0,0 +1,105 @@
+#ifndef CAMB_THREAD_THREADPOOLMETRICS_H_
+#define CAMB_THREAD_THREADPOOLMETRICS_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace cadf::thread {
+
+    /**
+     * Histogram of durations, in buckets which double in size. Bucket 0 holds durations of 0 ns, and bucket i (> 0) those from
+     * 2^(i-1) ns up to, but excluding, 2^i ns. This is coarse (any percentile is accurate to within a factor of two), but is cheap
+     * enough to record for every task and covers any duration.
+     */
+    struct DurationHistogram {
+            /** The number of buckets */
+            static const unsigned int BUCKETS = 64;
+
+            /** The number of durations in each bucket */
+            std::array<uint64_t, BUCKETS> counts = { };
+            /** The sum of all of the durations */
+            std::chrono::nanoseconds total = std::chrono::nanoseconds::zero();
+
+            /**
+             * Get the number of durations recorded
+             *
+             * @return uint64_t the number of durations
+             */
+            uint64_t count() const;
+
+            /**
+             * Get the mean duration
+             *
+             * @return std::chrono::nanoseconds the mean (0 if there are none)
+             */
+            std::chrono::nanoseconds mean() const;
+
+            /**
+             * Get the duration below which the fraction of the durations lie, as the upper bound of the bucket in which it falls
+             *
+             * @param fraction double between 0 and 1 (i.e.: 0.99 for the 99th percentile)
+             * @return std::chrono::nanoseconds the percentile (0 if there are none)
+             */
+            std::chrono::nanoseconds percentile(double fraction) const;
+
+            /**
+             * Get the bucket into which the duration falls
+             *
+             * @param duration std::chrono::nanoseconds the duration (negative durations are treated as 0)
+             * @return unsigned int the bucket
+             */
+            static unsigned int bucketOf(std::chrono::nanoseconds duration);
+
+            /**
+             * Get the (exclusive) upper bound of the durations of the bucket
+             *
+             * @param bucket unsigned int the bucket
+             * @return std::chrono::nanoseconds the upper bound
+             */
+            static std::chrono::nanoseconds upperBound(unsigned int bucket);
+    };
+
+    /**
+     * The metrics of one of the threads of a pool
+     */
+    struct WorkerMetrics {
+            /** The number of tasks which the thread has executed */
+            uint64_t tasksExecuted = 0;
+            /** The time spent executing tasks */
+            std::chrono::nanoseconds busy = std::chrono::nanoseconds::zero();
+            /** The time spent waiting for tasks */
+            std::chrono::nanoseconds idle = std::chrono::nanoseconds::zero();
+    };
+
+    /**
+     * Snapshot of the metrics of a thread pool. Apart from the queue depth, which is live, the metrics are cumulative since the pool
+     * was created. Busy and idle time only includes periods which have ended, i.e.: a task which is still running is not yet counted.
+     */
+    struct ThreadPoolMetrics {
+            /** Whether metrics are collected at all (false if compiled out via DISABLE_THREAD_POOL_METRICS) */
+            bool enabled = false;
+            /** The number of threads which are running (which varies for an elastic pool, 0 while stopped) */
+            unsigned int threads = 0;
+            /** The number of tasks waiting in the queue */
+            size_t queueDepth = 0;
+            /** The number of tasks executed, by all of the threads */
+            uint64_t tasksExecuted = 0;
+            /** The time between a task being scheduled and it starting to execute */
+            DurationHistogram queueLatency;
+            /** The time that tasks took to execute */
+            DurationHistogram runTime;
+            /** The metrics of each of the threads (for an elastic pool, of each of the slots up to the maximum number of threads) */
+            std::vector<WorkerMetrics> workers;
+
+            /**
+             * Get the fraction of the time that the threads were busy executing tasks
+             *
+             * @return double between 0 and 1 (0 if nothing was recorded)
+             */
+            double utilization() const;
+    };
+}
+
+#endif /* CAMB_THREAD_THREADPOOLMETRICS_H_ */
@@ -0,0 +1,237 @@
+#ifndef CAMB_THREAD_TIMERSERVICE_H_
+#define CAMB_THREAD_TIMERSERVICE_H_
+
+#include "thread/ThreadPool.h"
+#include "thread/TaskFunction.h"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace cadf::thread {
+
+    /**
+     * Executes tasks after a delay, at a given time, or periodically, by scheduling them into a thread pool when they are due. All of
+     * the timers share a single thread, which sleeps on a timerfd until the next of them is due, such that thousands of timers
+     * (heartbeats, timeouts, retries) cost no more than one thread.
+     *
+     * The timers are kept in a hashed hierarchical timer wheel: LEVELS wheels of SLOTS slots each, where a slot of the first wheel
+     * covers a single tick (the resolution), and a slot of each subsequent wheel covers all of the slots of the previous one. Adding or
+     * cancelling a timer takes constant time, and as time advances the timers of a slot are cascaded down into the finer wheel, until
+     * they expire from the first. Timers are never executed early, but up to a tick late.
+     *
+     * Periodic timers are due at a fixed rate (every period from when they were scheduled) rather than a fixed delay after the previous
+     * execution, so that they do not drift. Should an execution still be running when the next one is due, the next one is skipped.
+     */
+    class TimerService {
+        public:
+            /** Identifies a timer, for cancelling it */
+            typedef uint64_t TimerId;
+            /** The clock against which the timers are scheduled */
+            typedef std::chrono::steady_clock Clock;
+
+            /** Number of wheels */
+            static const unsigned int LEVELS = 6;
+            /** Number of bits of the tick used to index the slots of a wheel */
+            static const unsigned int SLOT_BITS = 6;
+            /** Number of slots per wheel */
+            static const unsigned int SLOTS = 1 << SLOT_BITS;
+
+            /**
+             * CTOR
+             *
+             * Creates the timerfd and starts the thread.
+             *
+             * @param *pool IThreadPool in which to execute the tasks
+             * @param resolution std::chrono::nanoseconds the duration of a tick (defaults to 1 millisecond)
+             * @throws ThreadInitializationException if the timerfd cannot be created or the resolution is not positive
+             */
+            TimerService(IThreadPool *pool, std::chrono::nanoseconds resolution = std::chrono::milliseconds(1));
+
+            TimerService(const TimerService&) = delete;
+            TimerService& operator=(const TimerService&) = delete;
+
+            /**
+             * DTOR - stops the thread, timers which did not yet expire are discarded
+             */
+            virtual ~TimerService();
+
+            /**
+             * Execute the task once, after the delay
+             *
+             * @param delay std::chrono::nanoseconds after which to execute the task
+             * @param &&task TaskFunction to execute
+             * @return TimerId of the timer
+             */
+            TimerId scheduleAfter(std::chrono::nanoseconds delay, TaskFunction &&task);
+
+            /**
+             * Execute the task once, at the specified time (or as soon as possible if it has passed)
+             *
+             * @param time Clock::time_point at which to execute the task
+             * @param &&task TaskFunction to execute
+             * @return TimerId of the timer
+             */
+            TimerId scheduleAt(Clock::time_point time, TaskFunction &&task);
+
+            /**
+             * Execute the task repeatedly, every period (the first time after one period), until cancelled
+             *
+             * @param period std::chrono::nanoseconds between executions
+             * @param &&task TaskFunction to execute
+             * @return TimerId of the timer
+             * @throws std::invalid_argument if the period is not positive
+             */
+            TimerId scheduleEvery(std::chrono::nanoseconds period, TaskFunction &&task);
+
+            /**
+             * Cancel the timer, such that its task is no longer executed. An execution which is already under way is not affected.
+             *
+             * @param id TimerId of the timer
+             * @return bool true if the timer was cancelled, false if it already expired (or never existed)
+             */
+            bool cancel(TimerId id);
+
+            /**
+             * Get the number of timers which are pending
+             *
+             * @return size_t the number of timers
+             */
+            size_t size();
+
+        private:
+            /**
+             * The task of a periodic timer, shared with its executions
+             */
+            struct Repeating {
+                    /** The task to execute */
+                    TaskFunction task;
+                    /** Whether an execution is under way */
+                    std::atomic<bool> running;
+            };
+
+            /**
+             * A timer within the wheel
+             */
+            struct Timer {
+                    /** The ID of the timer */
+                    TimerId id;
+                    /** When the timer is due */
+                    Clock::time_point due;
+                    /** The tick in which the timer expires */
+                    uint64_t tick;
+                    /** The period of a periodic timer (zero for one shot timers) */
+                    std::chrono::nanoseconds period;
+                    /** The task of a one shot timer */
+                    TaskFunction task;
+                    /** The task of a periodic timer */
+                    std::shared_ptr<Repeating> repeating;
+                    /** The wheel in which the timer is placed */
+                    unsigned int level;
+                    /** The slot of the wheel in which the timer is placed */
+                    unsigned int slot;
+            };
+
+            /** The timers of a slot, a list so that timers can be moved between slots without invalidating their iterators */
+            typedef std::list<Timer> Slot;
+
+            /** The pool in which to execute the tasks */
+            IThreadPool *m_pool;
+            /** The duration of a tick */
+            std::chrono::nanoseconds m_resolution;
+            /** The time of tick 0 */
+            Clock::time_point m_start;
+            /** The timerfd on which the thread sleeps */
+            int m_timerFd;
+            /** The eventfd via which the thread is woken to terminate */
+            int m_wakeFd;
+            /** Flag for whether the thread is to terminate */
+            std::atomic<bool> m_terminating;
+            /** The thread which advances the wheel */
+            std::thread m_thread;
+            /** Protects the wheel */
+            std::mutex m_mutex;
+            /** The wheels, finest first */
+            Slot m_wheel[LEVELS][SLOTS];
+            /** Where each pending timer is, by its ID */
+            std::unordered_map<TimerId, Slot::iterator> m_timers;
+            /** The ID of the next timer */
+            TimerId m_nextId;
+            /** The next tick to be processed, the first wheel holds the timers expiring within SLOTS ticks of it */
+            uint64_t m_currentTick;
+            /** The tick for which the timerfd is armed (NOT_ARMED if it is not) */
+            uint64_t m_armedTick;
+
+            /**
+             * Add a timer to the wheel
+             */
+            TimerId add(Clock::time_point due, std::chrono::nanoseconds period, TaskFunction &&task);
+
+            /**
+             * The logic of the thread, advancing the wheel whenever the timerfd expires
+             */
+            void run();
+
+            /**
+             * Get the tick in which the time falls, rounding up so that timers are never early
+             */
+            uint64_t tickFor(Clock::time_point time) const;
+
+            /**
+             * Place the timer in the appropriate slot for its tick, moving it from the slot it is currently in
+             *
+             * @param &from Slot in which the timer currently is
+             * @param timer Slot::iterator of the timer
+             */
+            void place(Slot &from, Slot::iterator timer);
+
+            /**
+             * Move all of the timers of a slot of a coarser wheel into finer ones
+             *
+             * @param level unsigned int the wheel
+             * @param slot unsigned int the slot
+             */
+            void cascade(unsigned int level, unsigned int slot);
+
+            /**
+             * Get the number of ticks which have passed (including the current, partially passed, one)
+             *
+             * @return uint64_t the tick following the one in which the current time falls
+             */
+            uint64_t passedTicks() const;
+
+            /**
+             * Process all ticks up to the current time, collecting the tasks which expired
+             *
+             * @param &expired std::vector<TaskFunction> to which to add the tasks to schedule
+             */
+            void advance(std::vector<TaskFunction> &expired);
+
+            /**
+             * Process the current tick, cascading the timers of any coarser wheel whose slot starts at it, and collecting the tasks
+             * which expire in it
+             *
+             * @param &expired std::vector<TaskFunction> to which to add the tasks to schedule
+             */
+            void processTick(std::vector<TaskFunction> &expired);
+
+            /**
+             * Determine the next tick at which the thread must wake, as either a timer expires or timers are to be cascaded
+             *
+             * @return uint64_t the tick (NOT_ARMED if there are no timers)
+             */
+            uint64_t nextWakeTick() const;
+
+            /**
+             * Arm the timerfd for the next tick at which the thread must wake (or disarm it if there are no timers)
+             */
+            void arm();
+    };
+}
+
+#endif /* CAMB_THREAD_TIMERSERVICE_H_ */
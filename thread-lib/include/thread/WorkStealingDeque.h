@@ -0,0 +1,172 @@
+#ifndef CAMB_THREAD_WORKSTEALINGDEQUE_H_
+#define CAMB_THREAD_WORKSTEALINGDEQUE_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace cadf::thread {
+
+    /**
+     * Lock free double ended queue of pointers, as per Chase and Lev ("Dynamic Circular Work-Stealing Deque", with the memory ordering
+     * of Le et al. "Correct and Efficient Work-Stealing for Weak Memory Models"). A single owner pushes and pops at the bottom, while any
+     * number of other threads can steal from the top. The deque grows as required, the buffers it outgrows are retained until it is
+     * destroyed as thieves may still be reading from them.
+     *
+     * The deque does not take ownership of the pointers, anything still contained when it is destroyed must be released by its owner.
+     *
+     * @template T the type to which the stored pointers point
+     */
+    template<typename T>
+    class WorkStealingDeque {
+        public:
+            /**
+             * CTOR
+             *
+             * @param capacity size_t the initial capacity, rounded up to a power of two (defaults to 64)
+             */
+            WorkStealingDeque(size_t capacity = 64): m_top(0), m_bottom(0) {
+                size_t size = 1;
+                while (size < capacity)
+                    size <<= 1;
+                m_buffers.push_back(std::make_unique<Buffer>(size));
+                m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            /**
+             * Add an item to the bottom of the deque. May only be called by the owner.
+             *
+             * @param *item T to add
+             */
+            void push(T *item) {
+                int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+                int64_t top = m_top.load(std::memory_order_acquire);
+                Buffer *buffer = m_buffer.load(std::memory_order_relaxed);
+                if (bottom - top > int64_t(buffer->mask))
+                    buffer = grow(buffer, top, bottom);
+
+                buffer->put(bottom, item);
+                m_bottom.store(bottom + 1, std::memory_order_release);
+            }
+
+            /**
+             * Remove the most recently pushed item from the bottom of the deque. May only be called by the owner.
+             *
+             * @return T* the item, or nullptr if the deque is empty (or the last item was stolen)
+             */
+            T* pop() {
+                int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                Buffer *buffer = m_buffer.load(std::memory_order_relaxed);
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t top = m_top.load(std::memory_order_relaxed);
+
+                if (top > bottom) {
+                    // Empty
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                T *item = buffer->get(bottom);
+                if (top == bottom) {
+                    // The last item, race any thieves for it
+                    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        item = nullptr;
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                }
+                return item;
+            }
+
+            /**
+             * Remove the oldest item from the top of the deque. May be called by any thread.
+             *
+             * @return T* the item, or nullptr if the deque is empty or another thread took the item first
+             */
+            T* steal() {
+                int64_t top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t bottom = m_bottom.load(std::memory_order_acquire);
+                if (top >= bottom)
+                    return nullptr;
+
+                T *item = m_buffer.load(std::memory_order_acquire)->get(top);
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return nullptr;
+                return item;
+            }
+
+            /**
+             * Check whether the deque appears to be empty. This is only a snapshot, items can be added or removed concurrently.
+             *
+             * @return bool true if there were no items in the deque
+             */
+            bool empty() const {
+                return m_top.load(std::memory_order_acquire) >= m_bottom.load(std::memory_order_acquire);
+            }
+
+            /**
+             * Get the approximate number of items in the deque. This is only a snapshot, items can be added or removed concurrently.
+             *
+             * @return size_t the number of items
+             */
+            size_t size() const {
+                int64_t size = m_bottom.load(std::memory_order_acquire) - m_top.load(std::memory_order_acquire);
+                return size > 0 ? size_t(size) : 0;
+            }
+
+        private:
+            /**
+             * Circular buffer of the items, indexed by their (ever increasing) position in the deque
+             */
+            struct Buffer {
+                /** Mask mapping a position onto the buffer (size - 1) */
+                size_t mask;
+                /** The items */
+                std::unique_ptr<std::atomic<T*>[]> items;
+
+                Buffer(size_t size): mask(size - 1), items(new std::atomic<T*>[size]) {
+                }
+
+                // The item is published through the slot as well as the bottom, so that a thief sees what the item points to
+                T* get(int64_t index) const {
+                    return items[size_t(index) & mask].load(std::memory_order_acquire);
+                }
+
+                void put(int64_t index, T *item) {
+                    items[size_t(index) & mask].store(item, std::memory_order_release);
+                }
+            };
+
+            /** Position of the oldest item */
+            alignas(64) std::atomic<int64_t> m_top;
+            /** Position one past the newest item */
+            alignas(64) std::atomic<int64_t> m_bottom;
+            /** The buffer currently in use */
+            alignas(64) std::atomic<Buffer*> m_buffer;
+            /** All of the buffers which were ever used (only accessed by the owner) */
+            std::vector<std::unique_ptr<Buffer>> m_buffers;
+
+            /**
+             * Double the size of the buffer, copying the items over
+             *
+             * @param *buffer Buffer which is full
+             * @param top int64_t position of the oldest item
+             * @param bottom int64_t position one past the newest item
+             * @return Buffer* the new buffer
+             */
+            Buffer* grow(Buffer *buffer, int64_t top, int64_t bottom) {
+                m_buffers.push_back(std::make_unique<Buffer>((buffer->mask + 1) * 2));
+                Buffer *grown = m_buffers.back().get();
+                for (int64_t i = top; i < bottom; i++)
+                    grown->put(i, buffer->get(i));
+                m_buffer.store(grown, std::memory_order_release);
+                return grown;
+            }
+    };
+}
+
+#endif /* CAMB_THREAD_WORKSTEALINGDEQUE_H_ */
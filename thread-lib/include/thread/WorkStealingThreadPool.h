@@ -0,0 +1,147 @@
+#ifndef CAMB_THREAD_WORKSTEALINGTHREADPOOL_H_
+#define CAMB_THREAD_WORKSTEALINGTHREADPOOL_H_
+
+#include "thread/ThreadPool.h"
+#include "thread/ThreadConfig.h"
+#include "thread/WorkStealingDeque.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace cadf::thread {
+
+    /**
+     * Thread pool implementation of the IThreadPool interface in which each thread has its own queue, rather than all threads sharing a
+     * single one. Functions scheduled from within one of the pool's threads are placed on that thread's queue without any locking, while
+     * functions scheduled from elsewhere are placed on a shared queue from which the threads take them in batches. A thread which runs
+     * out of work steals from the queues of the other threads, before parking until more work is scheduled.
+     *
+     * Functions are not guaranteed to be executed in the order in which they were scheduled, a thread executes the most recently
+     * scheduled function from its own queue first while stealing the oldest from the others. This suits work which spawns further work
+     * (i.e.: recursively splitting a problem), for which it keeps the working set of each thread small.
+     */
+    class WorkStealingThreadPool: public IThreadPool {
+        public:
+            /**
+             * CTOR
+             *
+             * Creates a thread pool with a number of available threads as specified by the user. The thread pool will
+             * start by default, this this behavior can be controlled by the client code. Note, that specifying an invalid
+             * number of threads (i.e.: 0) will generate an exception.
+             *
+             * @param numThreads int the number of threads that are to be made available in the thread pool (defaults to std::thread::hardware_concurrency())
+             * @param autoStart bool to indicate whether the thread pool should be started on initialization (defaults to true)
+             * @param &config const ThreadConfig to apply to each of the threads (defaults to inheriting everything)
+             */
+            WorkStealingThreadPool(unsigned int numThreads = std::thread::hardware_concurrency(), bool autoStart = true, const ThreadConfig &config = ThreadConfig());
+
+            /**
+             * DTOR - stops the pool, functions which were not yet executed are discarded
+             */
+            virtual ~WorkStealingThreadPool();
+
+            /**
+             * Starts the thread pool, creates the assigned number of threads and prepares for the scheduling of executions. Does nothing if already started.
+             *
+             * @throws ThreadInitializationException if the ThreadConfig could not be applied (the pool then remains stopped)
+             */
+            virtual void start();
+
+            /**
+             * Stops the thread pool and purges all existing threads. This will wait until all threads terminate their executions and properly join.
+             * Functions which were not yet executed remain scheduled, to be executed once the pool is started again. Does nothing if already stopped.
+             */
+            virtual void stop();
+
+            /**
+             * Check if the thread pool is currently started
+             */
+            virtual bool isStarted();
+
+            /**
+             * Schedules a function for execution. When called from within one of the pool's threads, the function is placed on
+             * that thread's own queue.
+             *
+             * @param &&task TaskFunction that is to be scheduled for execution
+             */
+            virtual void schedule(TaskFunction &&task);
+
+        private:
+            /** Queue of functions owned by a single thread */
+            typedef WorkStealingDeque<TaskFunction> LocalQueue;
+
+            /** Flag for whether or not the pool has been started */
+            bool m_started;
+            /** Flag for whether or not the pool is in the process of terminating */
+            std::atomic<bool> m_terminating;
+            /** The number of threads that are to be created and managed */
+            unsigned int m_numOfThreads;
+            /** The configuration to apply to each of the threads */
+            ThreadConfig m_config;
+            /** Vector of all created threads */
+            std::vector<std::thread> m_threads;
+            /** Mutex to ensure thread safety when managing the thread pool */
+            std::mutex m_threadPoolMutex;
+            /** The queue of each thread, by the index of the thread */
+            std::vector<std::unique_ptr<LocalQueue>> m_localQueues;
+            /** Queue of functions scheduled from outside of the pool */
+            std::queue<TaskFunction*> m_sharedQueue;
+            /** Number of functions in the shared queue, so that it can be checked without locking */
+            std::atomic<size_t> m_sharedQueueSize;
+            /** Mutex to ensure thread safety when accessing the shared queue */
+            std::mutex m_sharedQueueMutex;
+            /** Incremented whenever work is scheduled, so that a parking thread can tell whether it missed any */
+            std::atomic<uint64_t> m_epoch;
+            /** The number of threads which are parked (or about to be), so that scheduling only wakes threads when there are any */
+            std::atomic<unsigned int> m_numParked;
+            /** Mutex to protect the parking of threads */
+            std::mutex m_parkMutex;
+            /** Condition which is used to wake up parked threads */
+            std::condition_variable m_parkCondition;
+
+            /**
+             * The logic for each thread in the pool. It will look for functions to execute, parking when there are none.
+             *
+             * @param index size_t the index of the thread (and its queue)
+             */
+            void waitAndProcess(size_t index);
+
+            /**
+             * Look for a function to execute, first in the thread's own queue, then the shared queue, and finally the queues of the
+             * other threads.
+             *
+             * @param index size_t the index of the thread
+             * @param &random uint64_t state from which to select the thread to steal from
+             * @return TaskFunction* the function to execute, or nullptr if none was found
+             */
+            TaskFunction* findWork(size_t index, uint64_t &random);
+
+            /**
+             * Take a function from the shared queue, moving a share of the remaining ones to the thread's own queue
+             *
+             * @param index size_t the index of the thread
+             * @return TaskFunction* the function to execute, or nullptr if the shared queue was empty
+             */
+            TaskFunction* takeShared(size_t index);
+
+            /**
+             * Check whether there is any work in any of the queues
+             *
+             * @return bool true if there appears to be work
+             */
+            bool hasWork() const;
+
+            /**
+             * Park the thread until work is scheduled, or the pool is terminating
+             */
+            void park();
+
+            /**
+             * Wake a parked thread (if any) after work was scheduled
+             */
+            void notify();
+    };
+}
+
+#endif /* CAMB_THREAD_WORKSTEALINGTHREADPOOL_H_ */
@@ -1,18 +1,108 @@
 #include "thread/BasicThreadPool.h"
 #include "thread/ThreadException.h"
 
+#include <algorithm>
 #include <sstream>
+#include <system_error>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 namespace cadf::thread {
 
+    namespace {
+        /** Number of times an idle thread looks for work before parking */
+        const int SPIN_ATTEMPTS = 64;
+
+#ifdef DISABLE_THREAD_POOL_METRICS
+        /** Whether metrics are recorded (all of the recording is optimized away when not) */
+        const bool METRICS = false;
+#else
+        /** Whether metrics are recorded (all of the recording is optimized away when not) */
+        const bool METRICS = true;
+#endif
+
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The epoch must be usable as a futex word");
+
+        /**
+         * Sleep until woken, provided the word still contains the expected value
+         */
+        void futexWait(std::atomic<uint32_t> *word, uint32_t expected) {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+        }
+
+        /**
+         * Wake up to the specified number of threads sleeping on the word
+         */
+        void futexWake(std::atomic<uint32_t> *word, int count) {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+
+        /**
+         * Add to a counter which only the calling thread writes to, such that no locked instruction is needed
+         */
+        void increment(std::atomic<uint64_t> &counter, uint64_t value) {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        /**
+         * The duration between the two points in time, in nanoseconds (never negative)
+         */
+        uint64_t elapsed(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+            return to > from ? uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count()) : 0;
+        }
+
+        /**
+         * Copy the recorded histogram into that of the snapshot
+         */
+        void accumulate(DurationHistogram &histogram, const std::atomic<uint64_t> *counts, const std::atomic<uint64_t> &total) {
+            for (unsigned int i = 0; i < DurationHistogram::BUCKETS; i++)
+                histogram.counts[i] += counts[i].load(std::memory_order_relaxed);
+            histogram.total += std::chrono::nanoseconds(total.load(std::memory_order_relaxed));
+        }
+    }
+
+    /**
+     * Each thread only ever writes to its own recorder (on its own cache lines), while metrics() reads all of them
+     */
+    struct alignas(64) BasicThreadPool::WorkerRecorder {
+            std::atomic<uint64_t> tasksExecuted;
+            std::atomic<uint64_t> busy;
+            std::atomic<uint64_t> idle;
+            std::atomic<uint64_t> queueLatencyTotal;
+            std::atomic<uint64_t> runTimeTotal;
+            std::atomic<uint64_t> queueLatency[DurationHistogram::BUCKETS];
+            std::atomic<uint64_t> runTime[DurationHistogram::BUCKETS];
+    };
+
     /**
      * CTOR
      */
-    BasicThreadPool::BasicThreadPool(unsigned int numThreads, bool autoStart) : m_started(false), m_terminating(false), m_numOfThreads(numThreads) {
+    BasicThreadPool::BasicThreadPool(unsigned int numThreads, bool autoStart, QueueType queueType, size_t capacity, const ThreadConfig &config,
+            const Elasticity &elasticity) : m_started(false), m_terminating(false), m_numOfThreads(numThreads), m_maxThreads(numThreads),
+            m_elasticity(elasticity), m_config(config), m_numRunning(0), m_numWaiting(0), m_monitorParked(false), m_queueType(queueType), m_overflowSize(0), m_epoch(0),
+            m_numParked(0) {
         // Ensure that a valid number of threads are specified
         if (m_numOfThreads <= 0)
             throw ThreadInitializationException("At least one thread must be added to the ThreadPool");
 
+        if (m_elasticity.maxThreads > 0) {
+            if (m_elasticity.maxThreads < m_numOfThreads)
+                throw ThreadInitializationException("The maximum number of threads cannot be less than the number of threads");
+            if (m_elasticity.idleTimeout.count() <= 0)
+                throw ThreadInitializationException("The idle timeout must be positive");
+            if (m_queueType != QueueType::MUTEX && m_elasticity.maxThreads > m_numOfThreads)
+                throw ThreadInitializationException("An elastic ThreadPool requires QueueType::MUTEX");
+            m_maxThreads = m_elasticity.maxThreads;
+        }
+
+        // Value initialized, so that all of the counters start at 0
+        m_recorders.reset(new WorkerRecorder[m_maxThreads]());
+
+        if (m_queueType == QueueType::LOCK_FREE)
+            m_ring = std::make_unique<MpmcQueue<QueuedTask>>(capacity);
+
         // Start the pool if desired
         if (autoStart)
             start();
@@ -34,8 +124,27 @@ namespace cadf::thread {
             return;
 
         // Create the threads
-        for (unsigned int i = 0; i < m_numOfThreads; i++)
-            m_threads.push_back(std::thread(std::bind(&BasicThreadPool::waitAndProcess, this)));
+        m_terminating = false;
+        void (BasicThreadPool::*process)(unsigned int) = m_queueType == QueueType::LOCK_FREE ? &BasicThreadPool::waitAndProcessLockFree : &BasicThreadPool::waitAndProcess;
+        m_threads = m_config.startThreads(m_numOfThreads, [this, process](unsigned int index) {
+            (this->*process)(index);
+        });
+        // Only now that all of the slots exist can the pool grow
+        m_threads.resize(m_maxThreads);
+        {
+            std::unique_lock<std::mutex> bufferLock(m_bufferMutex);
+            m_slotActive.assign(m_maxThreads, false);
+            std::fill(m_slotActive.begin(), m_slotActive.begin() + m_numOfThreads, true);
+            m_numRunning = m_numOfThreads;
+        }
+        if (m_maxThreads > m_numOfThreads) {
+            m_monitorParked = false;
+            try {
+                m_monitor = std::thread(&BasicThreadPool::monitorBacklog, this);
+            } catch (const std::system_error&) {
+                // Out of threads, the pool then only grows when functions are scheduled or taken from the queue
+            }
+        }
         m_started = true;
     }
 
@@ -48,14 +157,29 @@ namespace cadf::thread {
             return;
 
         // Terminate the threads
-        m_terminating = true;
+        {
+            std::unique_lock<std::mutex> bufferLock(m_bufferMutex);
+            m_terminating = true;
+        }
         m_bufferCondition.notify_all();
+        m_monitorCondition.notify_all();
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        futexWake(&m_epoch, INT_MAX);
 
-        for (std::thread &t : m_threads)
-            t.join();
+        // Once terminating the pool no longer grows, so the slots no longer change
+        if (m_monitor.joinable())
+            m_monitor.join();
+        for (std::thread &t : m_threads) {
+            if (t.joinable())
+                t.join();
+        }
 
         // Purge them
         m_threads.clear();
+        {
+            std::unique_lock<std::mutex> bufferLock(m_bufferMutex);
+            m_numRunning = 0;
+        }
         m_started = false;
     }
 
@@ -70,39 +194,260 @@ namespace cadf::thread {
     /**
      * Schedule function for execution
      */
-    void BasicThreadPool::schedule(std::function<void()> func) {
-        {
+    void BasicThreadPool::schedule(TaskFunction &&task) {
+        QueuedTask queued;
+        queued.task = std::move(task);
+        if (METRICS || m_maxThreads > m_numOfThreads)
+            queued.scheduled = std::chrono::steady_clock::now();
+
+        if (m_queueType == QueueType::MUTEX) {
+            {
+                std::unique_lock<std::mutex> lock(m_bufferMutex);
+                m_buffer.push(std::move(queued));
+                growIfBacklogged();
+            }
+            m_bufferCondition.notify_one();
+            return;
+        }
+
+        if (!m_ring->tryPush(std::move(queued))) {
+            // The ring is full. Rather than blocking (which could deadlock if called from within the pool), overflow into the buffer
             std::unique_lock<std::mutex> lock(m_bufferMutex);
-            m_buffer.push(func);
+            m_buffer.push(std::move(queued));
+            m_overflowSize.fetch_add(1, std::memory_order_release);
         }
-        m_bufferCondition.notify_one();
+
+        // Only make the system call if there is a thread to wake
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (m_numParked.load(std::memory_order_seq_cst) > 0)
+            futexWake(&m_epoch, 1);
     }
 
     /**
      * Wait for a function to be buffered and then execute it
      */
-    void BasicThreadPool::waitAndProcess() {
+    void BasicThreadPool::waitAndProcess(unsigned int index) {
+        WorkerRecorder &recorder = m_recorders[index];
+        std::chrono::steady_clock::time_point lastEnd;
+        if (METRICS)
+            lastEnd = std::chrono::steady_clock::now();
+
         while (true) {
-            std::function<void()> func;
+            QueuedTask queued;
 
             {
-                // Wait for something to appear on the buffer (or termination)
+                // Wait for something to appear on the buffer (or termination, or retirement)
                 std::unique_lock<std::mutex> lock(m_bufferMutex);
-                m_bufferCondition.wait(lock, [=] {
-                    return !m_buffer.empty() || m_terminating;
-                });
-
-                // If terminating, then stop trying to process buffers
-                if (m_terminating)
+                if (!waitForWork(lock, index))
                     break;
 
-                // Grab the next waiting function
-                func = m_buffer.front();
+                // Grab the next waiting function, and help out if what remains has been waiting for too long
+                queued = std::move(m_buffer.front());
                 m_buffer.pop();
+                growIfBacklogged();
             }
 
             // Now outside of the lock, process the function
-            func();
+            execute(queued, recorder, lastEnd);
+        }
+
+        if (METRICS)
+            increment(recorder.idle, elapsed(lastEnd, std::chrono::steady_clock::now()));
+    }
+
+    /**
+     * Wait for a function or termination. The timeout restarts upon a spurious wake up, so a thread retires after being idle for at
+     * least the timeout.
+     */
+    bool BasicThreadPool::waitForWork(std::unique_lock<std::mutex> &lock, unsigned int index) {
+        bool elastic = m_maxThreads > m_numOfThreads;
+        m_numWaiting++;
+        while (m_buffer.empty() && !m_terminating) {
+            if (!elastic) {
+                m_bufferCondition.wait(lock);
+                continue;
+            }
+
+            if (m_bufferCondition.wait_for(lock, m_elasticity.idleTimeout) == std::cv_status::timeout && m_buffer.empty() && !m_terminating
+                    && m_numRunning > m_numOfThreads) {
+                m_numWaiting--;
+                m_numRunning--;
+                m_slotActive[index] = false;
+                return false;
+            }
+        }
+        m_numWaiting--;
+        return !m_terminating;
+    }
+
+    /**
+     * Start the thread in a free slot. The thread which last occupied the slot has retired (or failed to start), so joining it only
+     * waits for it to exit.
+     */
+    void BasicThreadPool::growIfBacklogged() {
+        if (m_numRunning == 0 || m_numRunning >= m_maxThreads || m_numWaiting > 0 || m_terminating || m_buffer.empty())
+            return;
+        if (std::chrono::steady_clock::now() - m_buffer.front().scheduled < m_elasticity.latencyThreshold) {
+            // Should all of the threads remain busy, nothing else might check again once the threshold is reached
+            if (m_monitorParked)
+                m_monitorCondition.notify_one();
+            return;
+        }
+
+        unsigned int index = std::find(m_slotActive.begin(), m_slotActive.end(), false) - m_slotActive.begin();
+        if (m_threads[index].joinable())
+            m_threads[index].join();
+
+        m_slotActive[index] = true;
+        m_numRunning++;
+        try {
+            m_threads[index] = std::thread([this, index] {
+                try {
+                    m_config.applyToCurrentThread(index);
+                } catch (...) {
+                    // The configuration was applied successfully to the initial threads, so this is not expected. Leave the pool as
+                    // it is rather than failing whoever happened to schedule.
+                    std::unique_lock<std::mutex> lock(m_bufferMutex);
+                    m_numRunning--;
+                    m_slotActive[index] = false;
+                    return;
+                }
+                waitAndProcess(index);
+            });
+        } catch (const std::system_error&) {
+            // Out of threads, make do with those which are running
+            m_numRunning--;
+            m_slotActive[index] = false;
+        }
+    }
+
+    /**
+     * Sleep until the function at the front will have waited for the threshold (and at least the threshold since the previous
+     * attempt, giving the thread which was started the chance to take from the queue), or until woken when there is no backlog
+     */
+    void BasicThreadPool::monitorBacklog() {
+        std::unique_lock<std::mutex> lock(m_bufferMutex);
+        std::chrono::steady_clock::time_point attempted;
+        while (!m_terminating) {
+            if (m_buffer.empty() || m_numWaiting > 0 || m_numRunning >= m_maxThreads) {
+                m_monitorParked = true;
+                m_monitorCondition.wait(lock);
+                m_monitorParked = false;
+                continue;
+            }
+
+            std::chrono::steady_clock::time_point due = std::max(m_buffer.front().scheduled, attempted) + m_elasticity.latencyThreshold;
+            if (std::chrono::steady_clock::now() < due) {
+                m_monitorCondition.wait_until(lock, due);
+                continue;
+            }
+            growIfBacklogged();
+            attempted = std::chrono::steady_clock::now();
         }
     }
+
+    /**
+     * Take functions from the ring until terminated, parking on the epoch when there are none. The epoch is read before checking for
+     * work one final time, such that anything scheduled after the check changes the epoch and the futex does not sleep.
+     */
+    void BasicThreadPool::waitAndProcessLockFree(unsigned int index) {
+        WorkerRecorder &recorder = m_recorders[index];
+        std::chrono::steady_clock::time_point lastEnd;
+        if (METRICS)
+            lastEnd = std::chrono::steady_clock::now();
+
+        int idle = 0;
+        while (!m_terminating.load(std::memory_order_acquire)) {
+            QueuedTask queued;
+            if (m_ring->tryPop(queued) || takeOverflow(queued)) {
+                idle = 0;
+                execute(queued, recorder, lastEnd);
+                continue;
+            }
+
+            if (++idle < SPIN_ATTEMPTS) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            idle = 0;
+            uint32_t epoch = m_epoch.load(std::memory_order_seq_cst);
+            m_numParked.fetch_add(1, std::memory_order_seq_cst);
+            if (m_ring->empty() && m_overflowSize.load(std::memory_order_acquire) == 0 && !m_terminating.load(std::memory_order_acquire))
+                futexWait(&m_epoch, epoch);
+            m_numParked.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        if (METRICS)
+            increment(recorder.idle, elapsed(lastEnd, std::chrono::steady_clock::now()));
+    }
+
+    /**
+     * The time since the previous function ended is idle, the time since the function was scheduled its latency
+     */
+    void BasicThreadPool::execute(QueuedTask &queued, WorkerRecorder &recorder, std::chrono::steady_clock::time_point &lastEnd) {
+        if (!METRICS) {
+            queued.task();
+            return;
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        uint64_t latency = elapsed(queued.scheduled, start);
+        increment(recorder.idle, elapsed(lastEnd, start));
+        increment(recorder.queueLatency[DurationHistogram::bucketOf(std::chrono::nanoseconds(latency))], 1);
+        increment(recorder.queueLatencyTotal, latency);
+
+        queued.task();
+
+        lastEnd = std::chrono::steady_clock::now();
+        uint64_t runTime = elapsed(start, lastEnd);
+        increment(recorder.busy, runTime);
+        increment(recorder.runTime[DurationHistogram::bucketOf(std::chrono::nanoseconds(runTime))], 1);
+        increment(recorder.runTimeTotal, runTime);
+        increment(recorder.tasksExecuted, 1);
+    }
+
+    /**
+     * Sum up what each of the threads recorded
+     */
+    ThreadPoolMetrics BasicThreadPool::metrics() {
+        ThreadPoolMetrics metrics;
+        metrics.enabled = METRICS;
+        {
+            std::unique_lock<std::mutex> lock(m_bufferMutex);
+            metrics.threads = m_numRunning;
+            metrics.queueDepth = m_buffer.size();
+        }
+        if (m_queueType == QueueType::LOCK_FREE)
+            metrics.queueDepth = m_ring->size() + m_overflowSize.load(std::memory_order_acquire);
+
+        metrics.workers.resize(m_maxThreads);
+        for (unsigned int i = 0; i < m_maxThreads; i++) {
+            const WorkerRecorder &recorder = m_recorders[i];
+            WorkerMetrics &worker = metrics.workers[i];
+            worker.tasksExecuted = recorder.tasksExecuted.load(std::memory_order_relaxed);
+            worker.busy = std::chrono::nanoseconds(recorder.busy.load(std::memory_order_relaxed));
+            worker.idle = std::chrono::nanoseconds(recorder.idle.load(std::memory_order_relaxed));
+            metrics.tasksExecuted += worker.tasksExecuted;
+            accumulate(metrics.queueLatency, recorder.queueLatency, recorder.queueLatencyTotal);
+            accumulate(metrics.runTime, recorder.runTime, recorder.runTimeTotal);
+        }
+        return metrics;
+    }
+
+    /**
+     * Take from the overflow buffer, without locking if it is empty
+     */
+    bool BasicThreadPool::takeOverflow(QueuedTask &queued) {
+        if (m_overflowSize.load(std::memory_order_acquire) == 0)
+            return false;
+
+        std::unique_lock<std::mutex> lock(m_bufferMutex);
+        if (m_buffer.empty())
+            return false;
+        queued = std::move(m_buffer.front());
+        m_buffer.pop();
+        m_overflowSize.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
 }
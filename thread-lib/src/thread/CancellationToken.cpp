@@ -0,0 +1,99 @@
+#include "thread/CancellationToken.h"
+#include "thread/ThreadException.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace cadf::thread {
+
+    /**
+     * CTOR
+     */
+    CancellationToken::CancellationToken() : m_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)), m_cancelled(false) {
+        if (m_fd < 0)
+            throw ThreadInitializationException("Unable to create the eventfd");
+    }
+
+    /**
+     * DTOR
+     */
+    CancellationToken::~CancellationToken() {
+        close(m_fd);
+    }
+
+    /**
+     * The eventfd remains readable until reset, so everyone waiting is woken
+     */
+    void CancellationToken::cancel() {
+        if (m_cancelled.exchange(true))
+            return;
+        uint64_t one = 1;
+        if (write(m_fd, &one, sizeof(one)) < 0) {
+            // Cannot fail, the counter cannot overflow from a single write
+        }
+    }
+
+    /**
+     * Drain the eventfd
+     */
+    void CancellationToken::reset() {
+        uint64_t count;
+        if (read(m_fd, &count, sizeof(count)) < 0) {
+            // Nothing to drain, it was not cancelled
+        }
+        m_cancelled = false;
+    }
+
+    /**
+     * Check if cancelled
+     */
+    bool CancellationToken::isCancelled() const {
+        return m_cancelled;
+    }
+
+    /**
+     * The eventfd
+     */
+    int CancellationToken::getFd() const {
+        return m_fd;
+    }
+
+    /**
+     * Poll both, retrying when interrupted by a signal
+     */
+    bool CancellationToken::waitFor(int fd, short events) const {
+        pollfd fds[2] = { { fd, events, 0 }, { m_fd, POLLIN, 0 } };
+        while (!isCancelled()) {
+            if (poll(fds, 2, -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+                // Let whatever is called next report the problem with the file descriptor
+                return true;
+            }
+            if (fds[1].revents != 0)
+                return false;
+            if (fds[0].revents != 0)
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * Poll the eventfd alone until the deadline
+     */
+    bool CancellationToken::sleepFor(std::chrono::nanoseconds duration) const {
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + duration;
+        pollfd fds[1] = { { m_fd, POLLIN, 0 } };
+        while (!isCancelled()) {
+            std::chrono::nanoseconds remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining.count() <= 0)
+                return true;
+            timespec timeout = { time_t(remaining.count() / 1000000000), long(remaining.count() % 1000000000) };
+            if (ppoll(fds, 1, &timeout, nullptr) > 0)
+                return false;
+        }
+        return false;
+    }
+}
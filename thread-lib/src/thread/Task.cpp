@@ -1,34 +1,41 @@
 #include "thread/Task.h"
-#include <unistd.h>
+#include <chrono>
 
 
 namespace cadf::thread {
 
+    /*
+     * The token of the task
+     */
+    const CancellationToken& Task::getCancellationToken() const {
+        return m_cancellationToken;
+    }
+
     /*
      * Sleep for specified number of seconds
      */
     void Task::ssleep(unsigned int secs) {
-        ::sleep(secs);
+        m_cancellationToken.sleepFor(std::chrono::seconds(secs));
     }
 
     /*
      * Sleep for specified number of milliseconds
      */
     void Task::msleep(unsigned int millisecs) {
-        usleep(1000 * millisecs);
+        m_cancellationToken.sleepFor(std::chrono::milliseconds(millisecs));
     }
 
     /*
      * Sleep for specified number of microseconds
      */
     void Task::usleep(unsigned int microsecs) {
-        ::usleep(microsecs);
+        m_cancellationToken.sleepFor(std::chrono::microseconds(microsecs));
     }
 
     /*
      * CTOR
      */
-    LoopingTask::LoopingTask(): m_quitting(true) {
+    LoopingTask::LoopingTask(): m_quitting(false) {
 
     }
 
@@ -50,8 +57,9 @@ namespace cadf::thread {
      * Continue executing the execLoop() until scheduleStop()
      */
     void LoopingTask::exec() {
-        m_quitting = false;
         while (!m_quitting)
             execLoop();
+        // Reset only once the loop has ended, so that a stop scheduled before the loop starts is not lost
+        m_quitting = false;
     }
 }
@@ -0,0 +1,131 @@
+#include "thread/TaskGraph.h"
+#include "thread/ThreadException.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace cadf::thread {
+
+    /**
+     * The state of a run, shared by all of its tasks
+     */
+    struct TaskGraph::Run {
+            /** The pool in which the tasks are executed */
+            IThreadPool &pool;
+            /** The tasks */
+            std::vector<Node> nodes;
+            /** The number of dependencies of each task which have yet to complete */
+            std::unique_ptr<std::atomic<size_t>[]> pending;
+            /** The number of tasks which have yet to complete */
+            std::atomic<size_t> remaining;
+            /** Set once a task has thrown, so that the remaining ones are skipped */
+            std::atomic<bool> failed;
+            /** Protects the exception */
+            std::mutex exceptionMutex;
+            /** The exception of the first task to have thrown */
+            std::exception_ptr exception;
+            /** Fulfilled once all of the tasks have completed */
+            Promise<void> promise;
+
+            Run(IThreadPool &pool, std::vector<Node> &&nodes) : pool(pool), nodes(std::move(nodes)), pending(new std::atomic<size_t>[this->nodes.size()]),
+                    remaining(this->nodes.size()), failed(false) {
+                for (size_t i = 0; i < this->nodes.size(); i++)
+                    pending[i].store(this->nodes[i].numDependencies, std::memory_order_relaxed);
+            }
+    };
+
+    /**
+     * Add the task, registering it as a dependent of its dependencies
+     */
+    TaskGraph::TaskId TaskGraph::add(TaskFunction &&task, const std::vector<TaskId> &dependencies) {
+        TaskId id = m_nodes.size();
+        for (TaskId dependency : dependencies) {
+            if (dependency >= id)
+                throw TaskGraphException("task " + std::to_string(id) + " depends on unknown task " + std::to_string(dependency));
+        }
+
+        for (TaskId dependency : dependencies)
+            m_nodes[dependency].dependents.push_back(id);
+        m_nodes.push_back(Node { std::move(task), { }, dependencies.size() });
+        return id;
+    }
+
+    /**
+     * Number of tasks
+     */
+    size_t TaskGraph::size() const {
+        return m_nodes.size();
+    }
+
+    /**
+     * Schedule all of the tasks without dependencies, the rest are scheduled as their dependencies complete
+     */
+    Future<void> TaskGraph::run(IThreadPool &pool) {
+        std::shared_ptr<Run> run = std::make_shared<Run>(pool, std::move(m_nodes));
+        m_nodes.clear();
+        Future<void> future = run->promise.getFuture();
+        if (run->nodes.empty()) {
+            run->promise.setValue();
+            return future;
+        }
+
+        // Determine the roots before scheduling any, as the tasks could otherwise already be executing
+        std::vector<TaskId> roots;
+        for (TaskId id = 0; id < run->nodes.size(); id++) {
+            if (run->nodes[id].numDependencies == 0)
+                roots.push_back(id);
+        }
+        for (TaskId id : roots)
+            pool.schedule([run, id] { execute(run, id); });
+        return future;
+    }
+
+    /**
+     * Execute the task, then release its dependents. All but one of those which become ready are scheduled, the remaining one is
+     * executed next by this thread.
+     */
+    void TaskGraph::execute(std::shared_ptr<Run> run, TaskId id) {
+        while (true) {
+            Node &node = run->nodes[id];
+            if (!run->failed.load(std::memory_order_acquire)) {
+                try {
+                    node.task();
+                } catch (...) {
+                    std::unique_lock<std::mutex> lock(run->exceptionMutex);
+                    if (!run->exception)
+                        run->exception = std::current_exception();
+                    run->failed.store(true, std::memory_order_release);
+                }
+            }
+            // Release whatever the task captured now, rather than once the whole run completes
+            node.task.reset();
+
+            bool hasNext = false;
+            TaskId next = 0;
+            for (TaskId dependent : node.dependents) {
+                if (run->pending[dependent].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    continue;
+                if (hasNext)
+                    run->pool.schedule([run, dependent] { execute(run, dependent); });
+                else
+                    next = dependent;
+                hasNext = true;
+            }
+
+            if (run->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                std::unique_lock<std::mutex> lock(run->exceptionMutex);
+                std::exception_ptr exception = run->exception;
+                lock.unlock();
+                if (exception)
+                    run->promise.setException(exception);
+                else
+                    run->promise.setValue();
+            }
+
+            if (!hasNext)
+                return;
+            id = next;
+        }
+    }
+}
@@ -5,33 +5,10 @@
 
 namespace cadf::thread {
 
-    bool ThreadInterruptConfigurator::m_isConfigured = false;
-
-    /*
-     * Configure the mechanism to allow for interrupting blocking calls in the thread.
-     */
-    void ThreadInterruptConfigurator::configure() {
-        if (m_isConfigured)
-            return;
-        m_isConfigured = true;
-
-        // Configure the signal
-        siginterrupt(INTERRUPT_SIGNAL, true);
-        std::signal(INTERRUPT_SIGNAL, ThreadInterruptConfigurator::processSignal);
-    }
-
-    /*
-     * Required to ensure that the thread actually receives the signal and not the whole application
-     */
-    void ThreadInterruptConfigurator::processSignal(int) {
-        // Intentionally left blank
-    }
-
     /**
      * Create a new thread with the specified Task.
      */
-    Thread::Thread(Task *executable): m_task(executable), m_alive(false) {
-        ThreadInterruptConfigurator::configure();
+    Thread::Thread(Task *executable, const ThreadConfig &config): m_task(executable), m_config(config), m_alive(false) {
     }
 
     /*
@@ -52,15 +29,31 @@ namespace cadf::thread {
         else if (m_thread.joinable())
             m_thread.join();
 
+        // Cancelled by a previous stop
+        m_task->m_cancellationToken.reset();
+
         std::promise<void> threadStarted;
         std::future<void> waitForStart = threadStarted.get_future();
         m_thread = std::thread([&] {
+            // Configure the thread before the task starts, reporting any failure back to the caller
+            try {
+                m_config.applyToCurrentThread();
+            } catch (...) {
+                threadStarted.set_exception(std::current_exception());
+                return;
+            }
             m_alive = true;
             threadStarted.set_value();
             m_task->exec();
             m_alive = false;
         });
-        waitForStart.get();
+
+        try {
+            waitForStart.get();
+        } catch (...) {
+            m_thread.join();
+            throw;
+        }
     }
 
     /*
@@ -73,9 +66,9 @@ namespace cadf::thread {
             return;
         }
 
+        // Only the task is woken, the rest of the process is left alone
         m_task->scheduleStop();
-        pthread_kill(m_thread.native_handle(), ThreadInterruptConfigurator::INTERRUPT_SIGNAL);
-        std::raise(ThreadInterruptConfigurator::INTERRUPT_SIGNAL);
+        m_task->m_cancellationToken.cancel();
         if (m_thread.joinable())
             m_thread.join();
     }
@@ -93,7 +86,7 @@ namespace cadf::thread {
     /**
      * Create a new one-shot thread with itself as the task
      */
-    OneShotThread::OneShotThread() : Thread(this) {
+    OneShotThread::OneShotThread(const ThreadConfig &config) : Thread(this, config) {
     }
 
 
@@ -103,6 +96,6 @@ namespace cadf::thread {
     /**
      * Create a new looping thread with itself as the task
      */
-    LoopingThread::LoopingThread() : Thread(this) {
+    LoopingThread::LoopingThread(const ThreadConfig &config) : Thread(this, config) {
     }
 }
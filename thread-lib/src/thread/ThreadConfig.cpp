@@ -0,0 +1,216 @@
+#include "thread/ThreadConfig.h"
+#include "thread/ThreadException.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace cadf::thread {
+
+    namespace {
+        /** Maximum length of a thread name (excluding the terminator) */
+        const size_t MAX_NAME_LENGTH = 15;
+
+        /**
+         * Parse a Linux CPU list (i.e.: "0-3,8,10-11")
+         */
+        std::vector<int> parseCpuList(const std::string &list) {
+            std::vector<int> cpus;
+            std::stringstream stream(list);
+            std::string range;
+            while (std::getline(stream, range, ',')) {
+                if (range.empty() || range == "\n")
+                    continue;
+                size_t dash = range.find('-');
+                int first = std::stoi(range.substr(0, dash));
+                int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                for (int cpu = first; cpu <= last; cpu++)
+                    cpus.push_back(cpu);
+            }
+            return cpus;
+        }
+
+        /**
+         * The CPUs on which the calling thread is currently allowed to run
+         */
+        std::vector<int> currentCpus() {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            std::vector<int> cpus;
+            if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                    if (CPU_ISSET(cpu, &set))
+                        cpus.push_back(cpu);
+                }
+            }
+            return cpus;
+        }
+
+        /**
+         * Map the policy onto that of the scheduler
+         */
+        int schedulerPolicy(ThreadConfig::Policy policy) {
+            switch (policy) {
+                case ThreadConfig::Policy::BATCH:
+                    return SCHED_BATCH;
+                case ThreadConfig::Policy::IDLE:
+                    return SCHED_IDLE;
+                case ThreadConfig::Policy::FIFO:
+                    return SCHED_FIFO;
+                case ThreadConfig::Policy::RR:
+                    return SCHED_RR;
+                default:
+                    return SCHED_OTHER;
+            }
+        }
+    }
+
+    /**
+     * Name, then CPUs (of the NUMA node), memory policy, and finally scheduling
+     */
+    void ThreadConfig::applyToCurrentThread(int index) const {
+        if (!name.empty()) {
+            // Truncate the name rather than the index, so that the threads of a pool can still be told apart
+            std::string suffix = index < 0 ? "" : "-" + std::to_string(index);
+            std::string threadName = name.substr(0, MAX_NAME_LENGTH - suffix.size()) + suffix;
+            pthread_setname_np(pthread_self(), threadName.c_str());
+        }
+
+        // The CPUs of the set, restricted to those of the NUMA node
+        std::vector<int> allowed = cpus;
+        if (numaNode >= 0) {
+            std::vector<int> nodeCpus = cpusOfNumaNode(numaNode);
+            if (allowed.empty()) {
+                allowed = nodeCpus;
+            } else {
+                allowed.erase(std::remove_if(allowed.begin(), allowed.end(), [&nodeCpus](int cpu) {
+                    return std::find(nodeCpus.begin(), nodeCpus.end(), cpu) == nodeCpus.end();
+                }), allowed.end());
+                if (allowed.empty())
+                    throw ThreadInitializationException("None of the CPUs belong to NUMA node " + std::to_string(numaNode));
+            }
+        }
+        if (pinEach && index >= 0) {
+            if (allowed.empty())
+                allowed = currentCpus();
+            if (!allowed.empty())
+                allowed = { allowed[size_t(index) % allowed.size()] };
+        }
+
+        if (!allowed.empty()) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (int cpu : allowed) {
+                if (cpu < 0 || cpu >= CPU_SETSIZE)
+                    throw ThreadInitializationException("Invalid CPU " + std::to_string(cpu));
+                CPU_SET(cpu, &set);
+            }
+            if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+                throw ThreadInitializationException("Unable to set the CPU affinity");
+        }
+
+        if (numaNode >= 0) {
+            const size_t bitsPerWord = sizeof(unsigned long) * 8;
+            std::vector<unsigned long> nodeMask(size_t(numaNode) / bitsPerWord + 1, 0);
+            nodeMask[size_t(numaNode) / bitsPerWord] = 1UL << (size_t(numaNode) % bitsPerWord);
+            // The kernel takes the number of bits plus one
+            if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, nodeMask.data(), nodeMask.size() * bitsPerWord + 1) != 0)
+                throw ThreadInitializationException("Unable to prefer memory from NUMA node " + std::to_string(numaNode));
+        }
+
+        if (policy == Policy::INHERIT)
+            return;
+
+        int scheduler = schedulerPolicy(policy);
+        bool realTime = policy == Policy::FIFO || policy == Policy::RR;
+        if (realTime && (priority < sched_get_priority_min(scheduler) || priority > sched_get_priority_max(scheduler)))
+            throw ThreadInitializationException("Invalid real time priority " + std::to_string(priority));
+        if ((policy == Policy::OTHER || policy == Policy::BATCH) && (priority < -20 || priority > 19))
+            throw ThreadInitializationException("Invalid nice value " + std::to_string(priority));
+
+        sched_param param = { };
+        param.sched_priority = realTime ? priority : 0;
+        if (pthread_setschedparam(pthread_self(), scheduler, &param) != 0)
+            throw ThreadInitializationException("Unable to set the scheduling policy (insufficient privileges?)");
+        // The nice value of the thread alone, which on Linux is what the "process" of a thread ID refers to
+        if ((policy == Policy::OTHER || policy == Policy::BATCH) && setpriority(PRIO_PROCESS, syscall(SYS_gettid), priority) != 0)
+            throw ThreadInitializationException("Unable to set the nice value (insufficient privileges?)");
+    }
+
+    /**
+     * As listed in sysfs
+     */
+    std::vector<int> ThreadConfig::cpusOfNumaNode(int node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string list;
+        if (node < 0 || !file || !std::getline(file, list))
+            throw ThreadInitializationException("No such NUMA node " + std::to_string(node));
+        return parseCpuList(list);
+    }
+
+    /**
+     * Gate the threads until all of them have applied the configuration
+     */
+    std::vector<std::thread> ThreadConfig::startThreads(unsigned int count, std::function<void(unsigned int)> body) const {
+        struct Gate {
+                std::mutex mutex;
+                std::condition_variable condition;
+                unsigned int remaining;
+                bool released = false;
+                std::exception_ptr exception;
+        };
+        std::shared_ptr<Gate> gate = std::make_shared<Gate>();
+        gate->remaining = count;
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < count; i++) {
+            threads.emplace_back([this, gate, body, i] {
+                std::exception_ptr exception;
+                try {
+                    applyToCurrentThread(i);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+
+                std::unique_lock<std::mutex> lock(gate->mutex);
+                if (exception && !gate->exception)
+                    gate->exception = exception;
+                if (--gate->remaining == 0)
+                    gate->condition.notify_all();
+                gate->condition.wait(lock, [&gate] {
+                    return gate->released;
+                });
+                if (gate->exception)
+                    return;
+                lock.unlock();
+                body(i);
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(gate->mutex);
+        gate->condition.wait(lock, [&gate] {
+            return gate->remaining == 0;
+        });
+        gate->released = true;
+        gate->condition.notify_all();
+        std::exception_ptr exception = gate->exception;
+        lock.unlock();
+
+        if (exception) {
+            for (std::thread &t : threads)
+                t.join();
+            std::rethrow_exception(exception);
+        }
+        return threads;
+    }
+}
@@ -0,0 +1,79 @@
+#include "thread/ThreadPoolMetrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cadf::thread {
+
+    /**
+     * Sum of the buckets
+     */
+    uint64_t DurationHistogram::count() const {
+        uint64_t sum = 0;
+        for (uint64_t c : counts)
+            sum += c;
+        return sum;
+    }
+
+    /**
+     * Total over count
+     */
+    std::chrono::nanoseconds DurationHistogram::mean() const {
+        uint64_t n = count();
+        return n == 0 ? std::chrono::nanoseconds::zero() : std::chrono::nanoseconds(total.count() / int64_t(n));
+    }
+
+    /**
+     * Walk the buckets until the rank of the fraction is reached
+     */
+    std::chrono::nanoseconds DurationHistogram::percentile(double fraction) const {
+        uint64_t n = count();
+        if (n == 0)
+            return std::chrono::nanoseconds::zero();
+
+        uint64_t rank = uint64_t(std::ceil(std::min(std::max(fraction, 0.0), 1.0) * n));
+        if (rank == 0)
+            rank = 1;
+        uint64_t seen = 0;
+        for (unsigned int bucket = 0; bucket < BUCKETS; bucket++) {
+            seen += counts[bucket];
+            if (seen >= rank)
+                return upperBound(bucket);
+        }
+        return upperBound(BUCKETS - 1);
+    }
+
+    /**
+     * The number of significant bits of the duration
+     */
+    unsigned int DurationHistogram::bucketOf(std::chrono::nanoseconds duration) {
+        if (duration.count() <= 0)
+            return 0;
+        unsigned int bits = 64 - __builtin_clzll(uint64_t(duration.count()));
+        return bits < BUCKETS ? bits : BUCKETS - 1;
+    }
+
+    /**
+     * 2^bucket, saturated for the last bucket
+     */
+    std::chrono::nanoseconds DurationHistogram::upperBound(unsigned int bucket) {
+        if (bucket >= BUCKETS - 1)
+            return std::chrono::nanoseconds::max();
+        return std::chrono::nanoseconds(int64_t(1) << bucket);
+    }
+
+    /**
+     * Busy over busy and idle, across all of the threads
+     */
+    double ThreadPoolMetrics::utilization() const {
+        std::chrono::nanoseconds busy = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds idle = std::chrono::nanoseconds::zero();
+        for (const WorkerMetrics &worker : workers) {
+            busy += worker.busy;
+            idle += worker.idle;
+        }
+        if ((busy + idle).count() == 0)
+            return 0;
+        return double(busy.count()) / double((busy + idle).count());
+    }
+}
@@ -0,0 +1,328 @@
+#include "thread/TimerService.h"
+#include "thread/ThreadException.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace cadf::thread {
+
+    namespace {
+        /** m_armedTick when the timerfd is not armed */
+        const uint64_t NOT_ARMED = UINT64_MAX;
+        /** Mask of the bits of a tick which index the slots of a wheel */
+        const uint64_t SLOT_MASK = TimerService::SLOTS - 1;
+
+        /**
+         * Number of ticks covered by a slot of the wheel
+         */
+        uint64_t ticksPerSlot(unsigned int level) {
+            return uint64_t(1) << (TimerService::SLOT_BITS * level);
+        }
+    }
+
+    /**
+     * CTOR
+     */
+    TimerService::TimerService(IThreadPool *pool, std::chrono::nanoseconds resolution) : m_pool(pool), m_resolution(resolution), m_start(Clock::now()),
+            m_timerFd(-1), m_wakeFd(-1), m_terminating(false), m_nextId(1), m_currentTick(0), m_armedTick(NOT_ARMED) {
+        if (m_resolution.count() <= 0)
+            throw ThreadInitializationException("The timer resolution must be positive");
+
+        // steady_clock is CLOCK_MONOTONIC, so that tick times can be armed as they are
+        m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (m_timerFd < 0)
+            throw ThreadInitializationException("Unable to create the timerfd");
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_wakeFd < 0) {
+            close(m_timerFd);
+            throw ThreadInitializationException("Unable to create the eventfd");
+        }
+
+        m_thread = std::thread(&TimerService::run, this);
+    }
+
+    /**
+     * DTOR
+     */
+    TimerService::~TimerService() {
+        m_terminating = true;
+        uint64_t one = 1;
+        if (write(m_wakeFd, &one, sizeof(one)) < 0) {
+            // Cannot fail, the counter cannot overflow from a single write
+        }
+        m_thread.join();
+
+        close(m_timerFd);
+        close(m_wakeFd);
+    }
+
+    /**
+     * Schedule relative to now
+     */
+    TimerService::TimerId TimerService::scheduleAfter(std::chrono::nanoseconds delay, TaskFunction &&task) {
+        return add(Clock::now() + delay, std::chrono::nanoseconds::zero(), std::move(task));
+    }
+
+    /**
+     * Schedule at the time
+     */
+    TimerService::TimerId TimerService::scheduleAt(Clock::time_point time, TaskFunction &&task) {
+        return add(time, std::chrono::nanoseconds::zero(), std::move(task));
+    }
+
+    /**
+     * Schedule periodically, starting one period from now
+     */
+    TimerService::TimerId TimerService::scheduleEvery(std::chrono::nanoseconds period, TaskFunction &&task) {
+        if (period.count() <= 0)
+            throw std::invalid_argument("The period of a timer must be positive");
+        return add(Clock::now() + period, period, std::move(task));
+    }
+
+    /**
+     * Remove the timer from its slot
+     */
+    bool TimerService::cancel(TimerId id) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unordered_map<TimerId, Slot::iterator>::iterator found = m_timers.find(id);
+        if (found == m_timers.end())
+            return false;
+
+        Slot::iterator timer = found->second;
+        m_wheel[timer->level][timer->slot].erase(timer);
+        m_timers.erase(found);
+        return true;
+    }
+
+    /**
+     * Number of pending timers
+     */
+    size_t TimerService::size() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_timers.size();
+    }
+
+    /**
+     * Place the timer, and rearm if it expires before the thread would otherwise wake
+     */
+    TimerService::TimerId TimerService::add(Clock::time_point due, std::chrono::nanoseconds period, TaskFunction &&task) {
+        Slot pending;
+        pending.emplace_back();
+        Slot::iterator timer = pending.begin();
+        timer->due = due;
+        timer->tick = tickFor(due);
+        timer->period = period;
+        if (period.count() > 0) {
+            timer->repeating = std::make_shared<Repeating>();
+            timer->repeating->task = std::move(task);
+            timer->repeating->running = false;
+        } else {
+            timer->task = std::move(task);
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // The wheel does not turn while it is empty, so catch up on the idle time before placing relative to it
+        if (m_timers.empty())
+            m_currentTick = std::max(m_currentTick, passedTicks());
+        timer->id = m_nextId++;
+        m_timers[timer->id] = timer;
+        place(pending, timer);
+        if (m_armedTick == NOT_ARMED || timer->tick < m_armedTick)
+            arm();
+        return timer->id;
+    }
+
+    /**
+     * Sleep on the timerfd (or eventfd for termination), processing the wheel whenever woken, and scheduling what expired outside of
+     * the lock
+     */
+    void TimerService::run() {
+        pollfd fds[2] = { { m_timerFd, POLLIN, 0 }, { m_wakeFd, POLLIN, 0 } };
+        std::vector<TaskFunction> expired;
+        while (!m_terminating.load(std::memory_order_acquire)) {
+            if (poll(fds, 2, -1) < 0 && errno != EINTR)
+                break;
+
+            // Both are non blocking, as the timer may have been rearmed since it expired
+            uint64_t count;
+            if (fds[0].revents & POLLIN && read(m_timerFd, &count, sizeof(count)) < 0) {
+                // Nothing to read after all
+            }
+            if (fds[1].revents & POLLIN && read(m_wakeFd, &count, sizeof(count)) < 0) {
+                // Nothing to read after all
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                advance(expired);
+                arm();
+            }
+
+            for (TaskFunction &task : expired)
+                m_pool->schedule(std::move(task));
+            expired.clear();
+        }
+    }
+
+    /**
+     * Round up, a timer due part way through a tick expires at the end of it
+     */
+    uint64_t TimerService::tickFor(Clock::time_point time) const {
+        if (time <= m_start)
+            return 0;
+        std::chrono::nanoseconds elapsed = time - m_start;
+        return uint64_t((elapsed.count() + m_resolution.count() - 1) / m_resolution.count());
+    }
+
+    /**
+     * The finest wheel whose range covers the remaining ticks, in the slot that the tick maps to. The slot of a coarser wheel is
+     * always reached (and cascaded) before the tick, as the tick is at least one full slot of that wheel away.
+     */
+    void TimerService::place(Slot &from, Slot::iterator timer) {
+        if (timer->tick < m_currentTick)
+            timer->tick = m_currentTick;
+
+        uint64_t delta = timer->tick - m_currentTick;
+        uint64_t tick = timer->tick;
+        unsigned int level = 0;
+        while (level < LEVELS - 1 && delta >= ticksPerSlot(level + 1))
+            level++;
+        // Beyond the range of the coarsest wheel, place it at the very end of it so that it is placed again once in range
+        if (delta >= ticksPerSlot(LEVELS))
+            tick = m_currentTick + ticksPerSlot(LEVELS) - 1;
+
+        timer->level = level;
+        timer->slot = (tick >> (SLOT_BITS * level)) & SLOT_MASK;
+        Slot &to = m_wheel[level][timer->slot];
+        to.splice(to.end(), from, timer);
+    }
+
+    /**
+     * Move the timers down
+     */
+    void TimerService::cascade(unsigned int level, unsigned int slot) {
+        Slot pending;
+        pending.splice(pending.end(), m_wheel[level][slot]);
+        while (!pending.empty())
+            place(pending, pending.begin());
+    }
+
+    /**
+     * Ticks from the start up to and including the one in which now falls
+     */
+    uint64_t TimerService::passedTicks() const {
+        Clock::time_point now = Clock::now();
+        return now < m_start ? 0 : uint64_t((now - m_start) / m_resolution) + 1;
+    }
+
+    /**
+     * Process the ticks which have passed, jumping over those in which there is nothing to expire or cascade (straight to now if
+     * there are no timers at all)
+     */
+    void TimerService::advance(std::vector<TaskFunction> &expired) {
+        uint64_t passed = passedTicks();
+        while (m_currentTick < passed) {
+            uint64_t next = nextWakeTick();
+            if (next >= passed) {
+                m_currentTick = passed;
+                return;
+            }
+            m_currentTick = next;
+            processTick(expired);
+        }
+    }
+
+    /**
+     * Cascade (coarsest first), then expire the slot of the tick in the first wheel, all of whose timers expire in this tick
+     */
+    void TimerService::processTick(std::vector<TaskFunction> &expired) {
+        uint64_t tick = m_currentTick;
+        for (unsigned int level = LEVELS - 1; level > 0; level--) {
+            if ((tick & (ticksPerSlot(level) - 1)) == 0)
+                cascade(level, (tick >> (SLOT_BITS * level)) & SLOT_MASK);
+        }
+
+        Slot &slot = m_wheel[0][tick & SLOT_MASK];
+        while (!slot.empty()) {
+            Slot::iterator timer = slot.begin();
+            if (!timer->repeating) {
+                expired.push_back(std::move(timer->task));
+                m_timers.erase(timer->id);
+                slot.erase(timer);
+                continue;
+            }
+
+            // Skip the execution if the previous one is still running
+            std::shared_ptr<Repeating> repeating = timer->repeating;
+            if (!repeating->running.exchange(true)) {
+                expired.push_back([repeating] {
+                    try {
+                        repeating->task();
+                    } catch (...) {
+                        repeating->running = false;
+                        throw;
+                    }
+                    repeating->running = false;
+                });
+            }
+
+            // Fixed rate, skipping any periods which were missed entirely
+            do {
+                timer->due += timer->period;
+                timer->tick = tickFor(timer->due);
+            } while (timer->tick <= tick);
+            place(slot, timer);
+        }
+
+        m_currentTick = tick + 1;
+    }
+
+    /**
+     * The first tick in which a timer of the finest wheel expires, or a slot of a coarser wheel containing timers needs to be
+     * cascaded, whichever is sooner. Slots of the second wheel which are empty are skipped, so that the thread wakes at most once per
+     * full turn of the second wheel while there are only distant timers.
+     */
+    uint64_t TimerService::nextWakeTick() const {
+        if (m_timers.empty())
+            return NOT_ARMED;
+
+        uint64_t next = NOT_ARMED;
+        for (uint64_t tick = m_currentTick; tick < m_currentTick + SLOTS; tick++) {
+            if (!m_wheel[0][tick & SLOT_MASK].empty()) {
+                next = tick;
+                break;
+            }
+        }
+
+        uint64_t boundary = (m_currentTick + SLOT_MASK) & ~SLOT_MASK;
+        for (unsigned int i = 0; i < SLOTS && boundary < next; i++, boundary += SLOTS) {
+            unsigned int slot = (boundary >> SLOT_BITS) & SLOT_MASK;
+            if (slot == 0 || !m_wheel[1][slot].empty())
+                return boundary;
+        }
+        return next;
+    }
+
+    /**
+     * Arm with the absolute time of the tick (firing immediately if it has already passed)
+     */
+    void TimerService::arm() {
+        m_armedTick = nextWakeTick();
+
+        itimerspec spec = { };
+        if (m_armedTick != NOT_ARMED) {
+            std::chrono::nanoseconds time = (m_start + m_resolution * m_armedTick).time_since_epoch();
+            // A zero value would disarm the timer
+            if (time.count() <= 0)
+                time = std::chrono::nanoseconds(1);
+            spec.it_value.tv_sec = time.count() / 1000000000;
+            spec.it_value.tv_nsec = time.count() % 1000000000;
+        }
+        timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+    }
+}
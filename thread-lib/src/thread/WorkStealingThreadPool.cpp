@@ -0,0 +1,232 @@
+#include "thread/WorkStealingThreadPool.h"
+#include "thread/ThreadException.h"
+
+#include <algorithm>
+
+namespace cadf::thread {
+
+    namespace {
+        /** The pool to which the current thread belongs (if any) */
+        thread_local WorkStealingThreadPool *currentPool = nullptr;
+        /** The index of the current thread within its pool */
+        thread_local size_t currentIndex = 0;
+
+        /** Number of times an idle thread looks for work before parking */
+        const int SPIN_ATTEMPTS = 64;
+        /** Maximum number of functions a thread moves from the shared queue to its own in one go */
+        const size_t MAX_BATCH_SIZE = 32;
+
+        /**
+         * xorshift64, for picking which thread to steal from
+         */
+        uint64_t nextRandom(uint64_t &state) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+    }
+
+    /**
+     * CTOR
+     */
+    WorkStealingThreadPool::WorkStealingThreadPool(unsigned int numThreads, bool autoStart, const ThreadConfig &config) : m_started(false), m_terminating(false),
+            m_numOfThreads(numThreads), m_config(config), m_sharedQueueSize(0), m_epoch(0), m_numParked(0) {
+        // Ensure that a valid number of threads are specified
+        if (m_numOfThreads <= 0)
+            throw ThreadInitializationException("At least one thread must be added to the ThreadPool");
+
+        // The queues outlive the threads, so that work is retained across a restart
+        for (unsigned int i = 0; i < m_numOfThreads; i++)
+            m_localQueues.push_back(std::make_unique<LocalQueue>());
+
+        // Start the pool if desired
+        if (autoStart)
+            start();
+    }
+
+    /**
+     * DTOR
+     */
+    WorkStealingThreadPool::~WorkStealingThreadPool() {
+        stop();
+
+        // Discard whatever was not executed
+        for (std::unique_ptr<LocalQueue> &queue : m_localQueues) {
+            while (TaskFunction *func = queue->pop())
+                delete func;
+        }
+        while (!m_sharedQueue.empty()) {
+            delete m_sharedQueue.front();
+            m_sharedQueue.pop();
+        }
+    }
+
+    /**
+     * Start the pool
+     */
+    void WorkStealingThreadPool::start() {
+        std::unique_lock<std::mutex> lock(m_threadPoolMutex);
+        if (m_started)
+            return;
+
+        // Create the threads
+        m_terminating = false;
+        m_threads = m_config.startThreads(m_numOfThreads, [this](unsigned int index) {
+            waitAndProcess(index);
+        });
+        m_started = true;
+    }
+
+    /**
+     * Stop the pool
+     */
+    void WorkStealingThreadPool::stop() {
+        std::unique_lock<std::mutex> lock(m_threadPoolMutex);
+        if (!m_started)
+            return;
+
+        // Terminate the threads, waking any that are parked
+        m_terminating = true;
+        {
+            std::unique_lock<std::mutex> parkLock(m_parkMutex);
+            m_parkCondition.notify_all();
+        }
+
+        for (std::thread &t : m_threads)
+            t.join();
+
+        // Purge them
+        m_threads.clear();
+        m_started = false;
+    }
+
+    /**
+     * Check if the pool is started
+     */
+    bool WorkStealingThreadPool::isStarted() {
+        std::unique_lock<std::mutex> lock(m_threadPoolMutex);
+        return m_started;
+    }
+
+    /**
+     * Schedule function for execution, on the current thread's queue if it belongs to the pool
+     */
+    void WorkStealingThreadPool::schedule(TaskFunction &&task) {
+        TaskFunction *scheduled = new TaskFunction(std::move(task));
+        if (currentPool == this) {
+            m_localQueues[currentIndex]->push(scheduled);
+        } else {
+            std::unique_lock<std::mutex> lock(m_sharedQueueMutex);
+            m_sharedQueue.push(scheduled);
+            m_sharedQueueSize.fetch_add(1, std::memory_order_release);
+        }
+        notify();
+    }
+
+    /**
+     * Find and execute functions until terminated, spinning briefly before parking when there are none
+     */
+    void WorkStealingThreadPool::waitAndProcess(size_t index) {
+        currentPool = this;
+        currentIndex = index;
+        uint64_t random = index + 1;
+        int idle = 0;
+
+        while (!m_terminating.load(std::memory_order_acquire)) {
+            std::unique_ptr<TaskFunction> func(findWork(index, random));
+            if (func) {
+                idle = 0;
+                (*func)();
+            } else if (++idle < SPIN_ATTEMPTS) {
+                std::this_thread::yield();
+            } else {
+                idle = 0;
+                park();
+            }
+        }
+
+        currentPool = nullptr;
+    }
+
+    /**
+     * Own queue first (most recent first), then the shared queue, and finally steal (oldest first) starting from a random thread
+     */
+    TaskFunction* WorkStealingThreadPool::findWork(size_t index, uint64_t &random) {
+        if (TaskFunction *func = m_localQueues[index]->pop())
+            return func;
+        if (TaskFunction *func = takeShared(index))
+            return func;
+
+        size_t numQueues = m_localQueues.size();
+        size_t start = nextRandom(random) % numQueues;
+        for (size_t i = 0; i < numQueues; i++) {
+            size_t victim = (start + i) % numQueues;
+            if (victim == index)
+                continue;
+            if (TaskFunction *func = m_localQueues[victim]->steal())
+                return func;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Take the first function, along with this thread's share of the remainder so that the lock is taken less often
+     */
+    TaskFunction* WorkStealingThreadPool::takeShared(size_t index) {
+        if (m_sharedQueueSize.load(std::memory_order_acquire) == 0)
+            return nullptr;
+
+        std::unique_lock<std::mutex> lock(m_sharedQueueMutex);
+        if (m_sharedQueue.empty())
+            return nullptr;
+
+        TaskFunction *func = m_sharedQueue.front();
+        m_sharedQueue.pop();
+        size_t batch = std::min(m_sharedQueue.size() / m_numOfThreads, MAX_BATCH_SIZE);
+        for (size_t i = 0; i < batch; i++) {
+            m_localQueues[index]->push(m_sharedQueue.front());
+            m_sharedQueue.pop();
+        }
+        m_sharedQueueSize.store(m_sharedQueue.size(), std::memory_order_release);
+        return func;
+    }
+
+    /**
+     * Check all of the queues
+     */
+    bool WorkStealingThreadPool::hasWork() const {
+        if (m_sharedQueueSize.load(std::memory_order_acquire) > 0)
+            return true;
+        return std::any_of(m_localQueues.begin(), m_localQueues.end(), [](const std::unique_ptr<LocalQueue> &queue) {
+            return !queue->empty();
+        });
+    }
+
+    /**
+     * Park until the epoch changes. The epoch is read before checking for work one final time, such that any work scheduled after the
+     * check also changes the epoch, and the thread does not park (or is woken up) as a result.
+     */
+    void WorkStealingThreadPool::park() {
+        uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+        m_numParked.fetch_add(1, std::memory_order_seq_cst);
+        if (!hasWork()) {
+            std::unique_lock<std::mutex> lock(m_parkMutex);
+            m_parkCondition.wait(lock, [=] {
+                return m_epoch.load(std::memory_order_seq_cst) != epoch || m_terminating.load(std::memory_order_acquire);
+            });
+        }
+        m_numParked.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * Only take the lock when there is a thread to wake
+     */
+    void WorkStealingThreadPool::notify() {
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (m_numParked.load(std::memory_order_seq_cst) > 0) {
+            std::unique_lock<std::mutex> lock(m_parkMutex);
+            m_parkCondition.notify_one();
+        }
+    }
+}
@@ -3,7 +3,11 @@
 #   define BOOST_TEST_MODULE Main
 #endif
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 
 #include "thread/BasicThreadPool.h"
@@ -151,4 +155,202 @@ BOOST_AUTO_TEST_SUITE(BasicThreadPool_Test_Suite)
         BOOST_CHECK_EQUAL(1, counter3.numTimesCalled);
     }
 
+    /**
+     * Verify that the lock free queue executes everything that is scheduled, including what overflows the ring
+     */
+    BOOST_AUTO_TEST_CASE(LockFreeQueueTest) {
+        std::atomic<int> counter(0);
+        cadf::thread::BasicThreadPool p(3, false, cadf::thread::BasicThreadPool::QueueType::LOCK_FREE, 4);
+
+        // Far more than the ring can hold
+        for (int i = 0; i < 100; i++)
+            p.schedule([&counter] { counter++; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        BOOST_CHECK_EQUAL(0, counter.load());
+
+        p.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10)); // 10 ms wait should be long enough for the threads to process
+        BOOST_CHECK_EQUAL(100, counter.load());
+
+        // Once the threads have parked, they are woken for more
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        p.schedule([&counter] { counter++; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        BOOST_CHECK_EQUAL(101, counter.load());
+    }
+
+    /**
+     * Verify that the pool can be restarted, with either kind of queue
+     */
+    BOOST_AUTO_TEST_CASE(RestartTest) {
+        for (cadf::thread::BasicThreadPool::QueueType type : { cadf::thread::BasicThreadPool::QueueType::MUTEX, cadf::thread::BasicThreadPool::QueueType::LOCK_FREE }) {
+            std::atomic<int> counter(0);
+            cadf::thread::BasicThreadPool p(2, true, type);
+            p.stop();
+            p.start();
+            p.schedule([&counter] { counter++; });
+            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // 10 ms wait should be long enough for the thread to process
+            BOOST_CHECK_EQUAL(1, counter.load());
+        }
+    }
+
+    /**
+     * Verify that functions with move only captures are moved through both kinds of queue (including the overflow of the ring)
+     */
+    BOOST_AUTO_TEST_CASE(MoveOnlyTaskTest) {
+        for (cadf::thread::BasicThreadPool::QueueType queueType : { cadf::thread::BasicThreadPool::QueueType::MUTEX, cadf::thread::BasicThreadPool::QueueType::LOCK_FREE }) {
+            std::atomic<int> sum(0);
+            cadf::thread::BasicThreadPool p(2, false, queueType, 4);
+            for (int i = 1; i <= 10; i++) {
+                std::unique_ptr<int> value = std::make_unique<int>(i);
+                p.schedule([value = std::move(value), &sum] { sum += *value; });
+            }
+
+            p.start();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10)); // 10 ms wait should be long enough for the threads to process
+            BOOST_CHECK_EQUAL(55, sum.load());
+        }
+    }
+
+    /**
+     * Verify the metrics which are recorded, with either kind of queue (including the overflow of the ring)
+     */
+    BOOST_AUTO_TEST_CASE(MetricsTest) {
+        for (cadf::thread::BasicThreadPool::QueueType queueType : { cadf::thread::BasicThreadPool::QueueType::MUTEX, cadf::thread::BasicThreadPool::QueueType::LOCK_FREE }) {
+            std::atomic<int> counter(0);
+            cadf::thread::BasicThreadPool p(2, false, queueType, 4);
+            for (int i = 0; i < 9; i++)
+                p.schedule([&counter] { counter++; });
+            p.schedule([&counter] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                counter++;
+            });
+            BOOST_CHECK_EQUAL(10, p.metrics().queueDepth);
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            p.start();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20)); // 20 ms wait should be long enough for the threads to process
+            p.stop();
+            BOOST_REQUIRE_EQUAL(10, counter.load());
+
+            cadf::thread::ThreadPoolMetrics metrics = p.metrics();
+            BOOST_CHECK_EQUAL(0, metrics.queueDepth);
+            BOOST_REQUIRE_EQUAL(2, metrics.workers.size());
+            if (!metrics.enabled) {
+                BOOST_CHECK_EQUAL(0, metrics.tasksExecuted);
+                continue;
+            }
+
+            BOOST_CHECK_EQUAL(10, metrics.tasksExecuted);
+            BOOST_CHECK_EQUAL(10, metrics.workers[0].tasksExecuted + metrics.workers[1].tasksExecuted);
+            BOOST_CHECK_EQUAL(10, metrics.queueLatency.count());
+            BOOST_CHECK_EQUAL(10, metrics.runTime.count());
+            // Everything waited for the pool to start, and one of them slept
+            BOOST_CHECK(metrics.queueLatency.percentile(0) >= std::chrono::milliseconds(10));
+            BOOST_CHECK(metrics.runTime.percentile(1) >= std::chrono::milliseconds(5));
+            BOOST_CHECK(metrics.workers[0].busy + metrics.workers[1].busy >= std::chrono::milliseconds(5));
+            BOOST_CHECK(metrics.workers[0].idle + metrics.workers[1].idle >= std::chrono::milliseconds(15));
+            BOOST_CHECK(metrics.utilization() > 0 && metrics.utilization() < 1);
+
+            // Cumulative across restarts
+            p.start();
+            p.schedule([&counter] { counter++; });
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            BOOST_CHECK_EQUAL(11, p.metrics().tasksExecuted);
+        }
+    }
+
+    /**
+     * Verify that invalid elasticity is rejected
+     */
+    BOOST_AUTO_TEST_CASE(ElasticInvalidTest) {
+        cadf::thread::BasicThreadPool::Elasticity elasticity;
+        elasticity.maxThreads = 1;
+        BOOST_CHECK_THROW(cadf::thread::BasicThreadPool(2, false, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, cadf::thread::ThreadConfig(), elasticity),
+                cadf::thread::ThreadInitializationException);
+
+        elasticity.maxThreads = 4;
+        BOOST_CHECK_THROW(cadf::thread::BasicThreadPool(2, false, cadf::thread::BasicThreadPool::QueueType::LOCK_FREE, 1024, cadf::thread::ThreadConfig(), elasticity),
+                cadf::thread::ThreadInitializationException);
+
+        elasticity.idleTimeout = std::chrono::nanoseconds(0);
+        BOOST_CHECK_THROW(cadf::thread::BasicThreadPool(2, false, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, cadf::thread::ThreadConfig(), elasticity),
+                cadf::thread::ThreadInitializationException);
+    }
+
+    /**
+     * Verify that an elastic pool grows while functions wait for too long, up to its maximum, and shrinks back once idle
+     */
+    BOOST_AUTO_TEST_CASE(ElasticTest) {
+        cadf::thread::BasicThreadPool::Elasticity elasticity;
+        elasticity.maxThreads = 3;
+        elasticity.latencyThreshold = std::chrono::milliseconds(1);
+        elasticity.idleTimeout = std::chrono::milliseconds(50);
+        cadf::thread::BasicThreadPool p(1, true, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, cadf::thread::ThreadConfig(), elasticity);
+        BOOST_CHECK_EQUAL(1, p.metrics().threads);
+
+        for (int round = 0; round < 2; round++) {
+            std::mutex mutex;
+            std::set<std::thread::id> threads;
+            std::atomic<int> counter(0);
+            for (int i = 0; i < 12; i++) {
+                p.schedule([&] {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        threads.insert(std::this_thread::get_id());
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    counter++;
+                });
+            }
+
+            for (int i = 0; i < 200 && counter.load() < 12; i++)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            BOOST_REQUIRE_EQUAL(12, counter.load());
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                BOOST_CHECK_EQUAL(3, threads.size());
+            }
+            BOOST_CHECK_EQUAL(3, p.metrics().threads);
+
+            // The additional threads retire once idle, leaving the minimum
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            BOOST_CHECK_EQUAL(1, p.metrics().threads);
+        }
+
+        p.stop();
+        BOOST_CHECK_EQUAL(0, p.metrics().threads);
+        BOOST_CHECK_EQUAL(3, p.metrics().workers.size());
+    }
+
+    /**
+     * Verify that an elastic pool grows while all of its threads are blocked, even though nothing else is scheduled
+     */
+    BOOST_AUTO_TEST_CASE(ElasticBlockedTest) {
+        cadf::thread::BasicThreadPool::Elasticity elasticity;
+        elasticity.maxThreads = 4;
+        elasticity.latencyThreshold = std::chrono::milliseconds(5);
+        elasticity.idleTimeout = std::chrono::milliseconds(50);
+        cadf::thread::BasicThreadPool p(2, true, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, cadf::thread::ThreadConfig(), elasticity);
+
+        // Each of the functions blocks until all of them are running, which requires the pool to grow
+        std::atomic<int> started(0);
+        std::atomic<int> counter(0);
+        for (int i = 0; i < 4; i++) {
+            p.schedule([&] {
+                started++;
+                for (int j = 0; j < 1000 && started.load() < 4; j++)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                counter++;
+            });
+        }
+
+        for (int i = 0; i < 2000 && counter.load() < 4; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        BOOST_REQUIRE_EQUAL(4, counter.load());
+        BOOST_CHECK_EQUAL(4, started.load());
+        BOOST_CHECK_EQUAL(4, p.metrics().threads);
+        p.stop();
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <unistd.h>
+
+#include "thread/CancellationToken.h"
+
+// Test helpers for the CancellationTokenTest
+namespace CancellationTokenTest {
+    /**
+     * Pipe which is closed when done
+     */
+    struct Pipe {
+            int fds[2];
+
+            Pipe() {
+                BOOST_REQUIRE_EQUAL(0, pipe(fds));
+            }
+
+            ~Pipe() {
+                close(fds[0]);
+                close(fds[1]);
+            }
+    };
+}
+
+/**
+ * Test suite for the unit testing of the CancellationToken
+ */
+BOOST_AUTO_TEST_SUITE(CancellationToken_Test_Suite)
+
+    /**
+     * Verify that waiting returns once the file descriptor is ready
+     */
+    BOOST_AUTO_TEST_CASE(ReadyTest) {
+        CancellationTokenTest::Pipe pipe;
+        cadf::thread::CancellationToken token;
+        BOOST_CHECK(!token.isCancelled());
+
+        BOOST_REQUIRE_EQUAL(1, write(pipe.fds[1], "x", 1));
+        BOOST_CHECK(token.waitFor(pipe.fds[0]));
+        BOOST_CHECK(token.waitFor(pipe.fds[1], POLLOUT));
+    }
+
+    /**
+     * Verify that cancelling wakes those which are waiting, and all which wait later until reset
+     */
+    BOOST_AUTO_TEST_CASE(CancelTest) {
+        CancellationTokenTest::Pipe pipe;
+        cadf::thread::CancellationToken token;
+
+        std::future<bool> waiting = std::async(std::launch::async, [&] {
+            return token.waitFor(pipe.fds[0]);
+        });
+        BOOST_CHECK(waiting.wait_for(std::chrono::milliseconds(10)) == std::future_status::timeout);
+        token.cancel();
+        BOOST_REQUIRE(waiting.wait_for(std::chrono::seconds(1)) == std::future_status::ready);
+        BOOST_CHECK(!waiting.get());
+        BOOST_CHECK(token.isCancelled());
+
+        // Remains cancelled, even with the file descriptor ready
+        BOOST_REQUIRE_EQUAL(1, write(pipe.fds[1], "x", 1));
+        BOOST_CHECK(!token.waitFor(pipe.fds[0]));
+        token.cancel();
+        BOOST_CHECK(!token.waitFor(pipe.fds[0]));
+
+        token.reset();
+        BOOST_CHECK(!token.isCancelled());
+        BOOST_CHECK(token.waitFor(pipe.fds[0]));
+    }
+
+    /**
+     * Verify that sleeping lasts for the duration, unless cancelled
+     */
+    BOOST_AUTO_TEST_CASE(SleepTest) {
+        cadf::thread::CancellationToken token;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        BOOST_CHECK(token.sleepFor(std::chrono::milliseconds(5)));
+        BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(5));
+
+        std::thread canceller([&token] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            token.cancel();
+        });
+        start = std::chrono::steady_clock::now();
+        BOOST_CHECK(!token.sleepFor(std::chrono::seconds(10)));
+        BOOST_CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+        canceller.join();
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,160 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "thread/Future.h"
+#include "thread/BasicThreadPool.h"
+
+// Test helpers for the FutureTest
+namespace FutureTest {
+    /**
+     * Check that the future_error has the expected code
+     */
+    std::function<bool(const std::future_error&)> hasCode(std::future_errc code) {
+        return [code](const std::future_error &e) {
+            return e.code() == std::make_error_code(code);
+        };
+    }
+}
+
+/**
+ * Test suite for the unit testing of the Future, Promise, submit, and whenAll
+ */
+BOOST_AUTO_TEST_SUITE(Future_Test_Suite)
+
+    /**
+     * Verify the result set via a promise is available to all of its futures, and that it can only be set once
+     */
+    BOOST_AUTO_TEST_CASE(PromiseTest) {
+        cadf::thread::Future<int> invalid;
+        BOOST_CHECK(!invalid.valid());
+        BOOST_CHECK_EXCEPTION(invalid.get(), std::future_error, FutureTest::hasCode(std::future_errc::no_state));
+
+        cadf::thread::Promise<int> promise;
+        cadf::thread::Future<int> first = promise.getFuture();
+        cadf::thread::Future<int> second = first;
+        BOOST_CHECK(first.valid());
+        BOOST_CHECK(!first.isReady());
+
+        promise.setValue(42);
+        BOOST_CHECK(first.isReady());
+        BOOST_CHECK_EQUAL(42, first.get());
+        BOOST_CHECK_EQUAL(42, second.get());
+        BOOST_CHECK_EQUAL(42, promise.getFuture().get());
+        BOOST_CHECK_EXCEPTION(promise.setValue(1), std::future_error, FutureTest::hasCode(std::future_errc::promise_already_satisfied));
+        BOOST_CHECK_EXCEPTION(promise.setException(nullptr), std::future_error, FutureTest::hasCode(std::future_errc::promise_already_satisfied));
+    }
+
+    /**
+     * Verify that an exception set in the promise is thrown from the future, and that destroying a promise which was not satisfied
+     * breaks it
+     */
+    BOOST_AUTO_TEST_CASE(PromiseExceptionTest) {
+        cadf::thread::Promise<void> promise;
+        cadf::thread::Future<void> future = promise.getFuture();
+        promise.setException(std::make_exception_ptr(std::runtime_error("failed")));
+        BOOST_CHECK_THROW(future.get(), std::runtime_error);
+
+        cadf::thread::Future<std::string> broken;
+        {
+            cadf::thread::Promise<std::string> abandoned;
+            broken = abandoned.getFuture();
+        }
+        BOOST_CHECK(broken.isReady());
+        BOOST_CHECK_EXCEPTION(broken.get(), std::future_error, FutureTest::hasCode(std::future_errc::broken_promise));
+    }
+
+    /**
+     * Verify that callbacks are made when the result is set, or immediately if it already is
+     */
+    BOOST_AUTO_TEST_CASE(OnReadyTest) {
+        int called = 0;
+        cadf::thread::Promise<int> promise;
+        cadf::thread::Future<int> future = promise.getFuture();
+        future.onReady([&called] { called++; });
+        future.onReady([&called] { called++; });
+        BOOST_CHECK_EQUAL(0, called);
+
+        promise.setValue(1);
+        BOOST_CHECK_EQUAL(2, called);
+        future.onReady([&called] { called++; });
+        BOOST_CHECK_EQUAL(3, called);
+    }
+
+    /**
+     * Verify that submitted functions produce their results (or exceptions) via the future, including move only results
+     */
+    BOOST_AUTO_TEST_CASE(SubmitTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        cadf::thread::Future<int> value = cadf::thread::submit(pool, [] { return 6 * 7; });
+        cadf::thread::Future<void> nothing = cadf::thread::submit(pool, [] {});
+        cadf::thread::Future<int> failed = cadf::thread::submit(pool, []() -> int { throw std::runtime_error("failed"); });
+        cadf::thread::Future<std::unique_ptr<int>> moveOnly = cadf::thread::submit(pool, [] { return std::make_unique<int>(5); });
+
+        BOOST_CHECK_EQUAL(42, value.get());
+        BOOST_CHECK_NO_THROW(nothing.get());
+        BOOST_CHECK_THROW(failed.get(), std::runtime_error);
+        BOOST_CHECK_EQUAL(5, *moveOnly.get());
+    }
+
+    /**
+     * Verify that continuations are chained, receive the value of their predecessor, and that failures skip them
+     */
+    BOOST_AUTO_TEST_CASE(ThenTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        std::atomic<int> executed(0);
+
+        cadf::thread::Future<std::string> chained = cadf::thread::submit(pool, [] { return 20; })
+                .then(pool, [](int value) { return value + 1; })
+                .then(pool, [](int value) { return std::to_string(value * 2); });
+        BOOST_CHECK_EQUAL("42", chained.get());
+
+        cadf::thread::Future<void> afterVoid = cadf::thread::submit(pool, [] {}).then(pool, [&executed] { executed++; });
+        afterVoid.get();
+        BOOST_CHECK_EQUAL(1, executed.load());
+
+        cadf::thread::Future<int> skipped = cadf::thread::submit(pool, []() -> int { throw std::invalid_argument("failed"); })
+                .then(pool, [&executed](int value) { executed++; return value; });
+        BOOST_CHECK_THROW(skipped.get(), std::invalid_argument);
+        BOOST_CHECK_EQUAL(1, executed.load());
+
+        // Attached once already complete
+        cadf::thread::Future<int> ready = cadf::thread::submit(pool, [] { return 1; });
+        ready.wait();
+        BOOST_CHECK_EQUAL(2, ready.then(pool, [](int value) { return value + 1; }).get());
+    }
+
+    /**
+     * Verify fanning out from one future, and back in via whenAll
+     */
+    BOOST_AUTO_TEST_CASE(FanOutFanInTest) {
+        cadf::thread::BasicThreadPool pool(3);
+        cadf::thread::Future<int> source = cadf::thread::submit(pool, [] { return 10; });
+
+        std::vector<cadf::thread::Future<int>> parts;
+        for (int i = 0; i < 8; i++)
+            parts.push_back(source.then(pool, [i](int value) { return value * i; }));
+
+        int merged = 0;
+        cadf::thread::Future<void> merge = cadf::thread::whenAll(parts).then(pool, [&parts, &merged] {
+            for (const cadf::thread::Future<int> &part : parts)
+                merged += part.get();
+        });
+        merge.get();
+        BOOST_CHECK_EQUAL(280, merged);
+
+        BOOST_CHECK(cadf::thread::whenAll(std::vector<cadf::thread::Future<int>>()).isReady());
+
+        parts.push_back(cadf::thread::submit(pool, []() -> int { throw std::runtime_error("failed"); }));
+        BOOST_CHECK_THROW(cadf::thread::whenAll(parts).get(), std::runtime_error);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
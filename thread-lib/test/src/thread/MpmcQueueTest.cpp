@@ -0,0 +1,102 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "thread/MpmcQueue.h"
+
+/**
+ * Test suite for the unit testing of the MpmcQueue
+ */
+BOOST_AUTO_TEST_SUITE(MpmcQueue_Test_Suite)
+
+    /**
+     * Verify that items come out in the order they went in, and that the capacity is respected
+     */
+    BOOST_AUTO_TEST_CASE(OrderAndCapacityTest) {
+        cadf::thread::MpmcQueue<int> queue(3);
+        BOOST_CHECK_EQUAL(4, queue.capacity());
+        BOOST_CHECK(queue.empty());
+        BOOST_CHECK_EQUAL(0, queue.size());
+
+        int item = -1;
+        BOOST_CHECK(!queue.tryPop(item));
+        for (int i = 0; i < 4; i++)
+            BOOST_CHECK(queue.tryPush(i));
+        BOOST_CHECK(!queue.tryPush(4));
+        BOOST_CHECK(!queue.empty());
+        BOOST_CHECK_EQUAL(4, queue.size());
+
+        // Wrapping around the ring
+        for (int lap = 0; lap < 3; lap++) {
+            for (int i = 0; i < 4; i++) {
+                BOOST_CHECK(queue.tryPop(item));
+                BOOST_CHECK_EQUAL(i, item);
+                BOOST_CHECK(queue.tryPush(i));
+            }
+        }
+    }
+
+    /**
+     * Verify that a failed push leaves the item as it was, and that popped items are released from the ring
+     */
+    BOOST_AUTO_TEST_CASE(MoveOnlyTest) {
+        cadf::thread::MpmcQueue<std::unique_ptr<int>> queue(2);
+        std::unique_ptr<int> first = std::make_unique<int>(1);
+        BOOST_CHECK(queue.tryPush(std::move(first)));
+        BOOST_CHECK(queue.tryPush(std::make_unique<int>(2)));
+
+        std::unique_ptr<int> rejected = std::make_unique<int>(3);
+        BOOST_CHECK(!queue.tryPush(std::move(rejected)));
+        BOOST_REQUIRE(rejected);
+        BOOST_CHECK_EQUAL(3, *rejected);
+
+        std::unique_ptr<int> item;
+        BOOST_CHECK(queue.tryPop(item));
+        BOOST_CHECK_EQUAL(1, *item);
+    }
+
+    /**
+     * Verify that with several producers and consumers, each item is consumed exactly once
+     */
+    BOOST_AUTO_TEST_CASE(ConcurrentTest) {
+        const int numProducers = 3;
+        const int perProducer = 50000;
+        cadf::thread::MpmcQueue<int> queue(64);
+        std::vector<std::atomic<int>> consumed(numProducers * perProducer);
+        std::atomic<int> numConsumed(0);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < numProducers; p++) {
+            threads.emplace_back([&queue, p, perProducer] {
+                for (int i = 0; i < perProducer; i++) {
+                    while (!queue.tryPush(p * perProducer + i))
+                        std::this_thread::yield();
+                }
+            });
+        }
+        for (int c = 0; c < 3; c++) {
+            threads.emplace_back([&] {
+                int item;
+                while (numConsumed.load() < numProducers * perProducer) {
+                    if (queue.tryPop(item)) {
+                        consumed[item]++;
+                        numConsumed++;
+                    }
+                }
+            });
+        }
+        for (std::thread &t : threads)
+            t.join();
+
+        for (int i = 0; i < numProducers * perProducer; i++)
+            BOOST_REQUIRE_EQUAL(1, consumed[i].load());
+        BOOST_CHECK(queue.empty());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "thread/Parallel.h"
+#include "thread/BasicThreadPool.h"
+
+/**
+ * Test suite for the unit testing of the parallel algorithms
+ */
+BOOST_AUTO_TEST_SUITE(Parallel_Test_Suite)
+
+    /**
+     * Verify that every index is visited exactly once, for automatic and explicit grain sizes
+     */
+    BOOST_AUTO_TEST_CASE(ParallelForTest) {
+        cadf::thread::BasicThreadPool pool(3);
+        for (size_t grainSize : { 0, 1, 7, 1000, 5000 }) {
+            std::vector<std::atomic<int>> visited(1000);
+            cadf::thread::parallelFor(pool, 0, 1000, [&visited](int i) { visited[i]++; }, grainSize);
+            for (std::atomic<int> &count : visited)
+                BOOST_REQUIRE_EQUAL(1, count.load());
+        }
+
+        // Offset and empty ranges
+        std::atomic<long> sum(0);
+        cadf::thread::parallelFor(pool, 10L, 20L, [&sum](long i) { sum += i; });
+        BOOST_CHECK_EQUAL(145, sum.load());
+        cadf::thread::parallelFor(pool, 5, 5, [](int) { BOOST_FAIL("Nothing to visit"); });
+        cadf::thread::parallelFor(pool, 5, 2, [](int) { BOOST_FAIL("Nothing to visit"); });
+    }
+
+    /**
+     * Verify that an exception thrown while processing is rethrown in the calling thread
+     */
+    BOOST_AUTO_TEST_CASE(ParallelForExceptionTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        BOOST_CHECK_THROW(cadf::thread::parallelFor(pool, 0, 100, [](int i) {
+            if (i == 42)
+                throw std::runtime_error("failed");
+        }, 10), std::runtime_error);
+    }
+
+    /**
+     * Verify that the algorithms can be used from within a thread of the pool, even if it is the only one
+     */
+    BOOST_AUTO_TEST_CASE(NestedTest) {
+        cadf::thread::BasicThreadPool pool(1);
+        std::atomic<int> sum(0);
+        std::atomic<bool> done(false);
+        pool.schedule([&] {
+            cadf::thread::parallelFor(pool, 0, 100, [&sum](int i) { sum += i; }, 1);
+            done = true;
+        });
+        for (int i = 0; i < 1000 && !done; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        BOOST_CHECK(done.load());
+        BOOST_CHECK_EQUAL(4950, sum.load());
+    }
+
+    /**
+     * Verify the transformation into another container, as well as in place
+     */
+    BOOST_AUTO_TEST_CASE(ParallelTransformTest) {
+        cadf::thread::BasicThreadPool pool(3);
+        std::vector<int> input(1001);
+        std::iota(input.begin(), input.end(), 0);
+
+        std::vector<std::string> output(input.size());
+        std::vector<std::string>::iterator end = cadf::thread::parallelTransform(pool, input.begin(), input.end(), output.begin(), [](int i) {
+            return std::to_string(i);
+        }, 10);
+        BOOST_CHECK(end == output.end());
+        for (size_t i = 0; i < input.size(); i++)
+            BOOST_REQUIRE_EQUAL(std::to_string(i), output[i]);
+
+        cadf::thread::parallelTransform(pool, input.begin(), input.end(), input.begin(), [](int i) { return i * 2; });
+        for (size_t i = 0; i < input.size(); i++)
+            BOOST_REQUIRE_EQUAL(int(i * 2), input[i]);
+    }
+
+    /**
+     * Verify that the reduction combines the chunks in order (so that an associative but non commutative operation is correct)
+     */
+    BOOST_AUTO_TEST_CASE(ParallelReduceTest) {
+        cadf::thread::BasicThreadPool pool(3);
+        std::vector<long> values(10000);
+        std::iota(values.begin(), values.end(), 1);
+        BOOST_CHECK_EQUAL(50005000 + 5, cadf::thread::parallelReduce(pool, values.begin(), values.end(), 5L, std::plus<long>()));
+        BOOST_CHECK_EQUAL(5, cadf::thread::parallelReduce(pool, values.begin(), values.begin(), 5L, std::plus<long>()));
+
+        std::vector<std::string> letters;
+        for (char c = 'a'; c <= 'z'; c++)
+            letters.push_back(std::string(1, c));
+        std::string concatenated = cadf::thread::parallelReduce(pool, letters.begin(), letters.end(), std::string(">"),
+                [](const std::string &a, const std::string &b) { return a + b; }, 3);
+        BOOST_CHECK_EQUAL(">abcdefghijklmnopqrstuvwxyz", concatenated);
+    }
+
+    /**
+     * Verify a reduction into a different type than that of the elements, with the chunks combined by a separate operation
+     */
+    BOOST_AUTO_TEST_CASE(ParallelReduceCombineTest) {
+        cadf::thread::BasicThreadPool pool(3);
+        std::vector<std::string> words;
+        size_t expected = 0;
+        for (int i = 0; i < 1000; i++) {
+            words.push_back(std::string(i % 7, 'x'));
+            expected += i % 7;
+        }
+
+        auto addLength = [](size_t total, const std::string &word) { return total + word.size(); };
+        BOOST_CHECK_EQUAL(expected, cadf::thread::parallelReduce(pool, words.begin(), words.end(), size_t(0), addLength, std::plus<size_t>()));
+        BOOST_CHECK_EQUAL(expected, cadf::thread::parallelReduce(pool, words.begin(), words.end(), size_t(0), addLength, std::plus<size_t>(), 30));
+        BOOST_CHECK_EQUAL(0, cadf::thread::parallelReduce(pool, words.begin(), words.begin(), size_t(0), addLength, std::plus<size_t>()));
+    }
+
+    /**
+     * Verify sorting, including a custom ordering and a number of elements which is not a multiple of the grain size
+     */
+    BOOST_AUTO_TEST_CASE(ParallelSortTest) {
+        cadf::thread::BasicThreadPool pool(3);
+        std::mt19937 random(42);
+        for (size_t grainSize : { 0, 1, 3, 100, 20000 }) {
+            std::vector<int> values(10007);
+            for (int &value : values)
+                value = random() % 1000;
+            std::vector<int> expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            cadf::thread::parallelSort(pool, values.begin(), values.end(), std::less<>(), grainSize);
+            BOOST_REQUIRE(expected == values);
+
+            cadf::thread::parallelSort(pool, values.begin(), values.end(), std::greater<>());
+            std::reverse(expected.begin(), expected.end());
+            BOOST_REQUIRE(expected == values);
+        }
+
+        std::vector<int> empty;
+        cadf::thread::parallelSort(pool, empty.begin(), empty.end());
+        BOOST_CHECK(empty.empty());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
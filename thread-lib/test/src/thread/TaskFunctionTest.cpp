@@ -0,0 +1,159 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <functional>
+#include <memory>
+
+#include "thread/TaskFunction.h"
+
+// Test helpers for the TaskFunctionTest
+namespace TaskFunctionTest {
+    int counter = 0;
+
+    void increment() {
+        counter++;
+    }
+
+    /**
+     * Counts how many instances are alive
+     */
+    struct Tracked {
+            static int alive;
+
+            Tracked() {
+                alive++;
+            }
+
+            Tracked(const Tracked&) {
+                alive++;
+            }
+
+            Tracked(Tracked&&) noexcept {
+                alive++;
+            }
+
+            ~Tracked() {
+                alive--;
+            }
+    };
+    int Tracked::alive = 0;
+}
+
+/**
+ * Test suite for the unit testing of the TaskFunction
+ */
+BOOST_AUTO_TEST_SUITE(TaskFunction_Test_Suite)
+
+    /**
+     * Verify that a default constructed function is empty, and throws when executed
+     */
+    BOOST_AUTO_TEST_CASE(EmptyTest) {
+        cadf::thread::TaskFunction task;
+        BOOST_CHECK(!task);
+        BOOST_CHECK(!task.isInline());
+        BOOST_CHECK_THROW(task(), std::bad_function_call);
+
+        cadf::thread::TaskFunction fromNull(nullptr);
+        BOOST_CHECK(!fromNull);
+
+        cadf::thread::TaskFunction fromEmptyFunction(std::function<void()>{});
+        BOOST_CHECK(!fromEmptyFunction);
+
+        void (*nullPointer)() = nullptr;
+        cadf::thread::TaskFunction fromNullPointer(nullPointer);
+        BOOST_CHECK(!fromNullPointer);
+    }
+
+    /**
+     * Verify that small functions are stored inline, and large ones on the heap, and both are executed
+     */
+    BOOST_AUTO_TEST_CASE(InlineAndHeapTest) {
+        int counter = 0;
+        cadf::thread::TaskFunction small([&counter] { counter++; });
+        BOOST_CHECK(small);
+        BOOST_CHECK(small.isInline());
+        small();
+        BOOST_CHECK_EQUAL(1, counter);
+
+        std::array<char, cadf::thread::TaskFunction::INLINE_SIZE + 1> large = { };
+        large[0] = 5;
+        cadf::thread::TaskFunction big([&counter, large] { counter += large[0]; });
+        BOOST_CHECK(big);
+        BOOST_CHECK(!big.isInline());
+        big();
+        BOOST_CHECK_EQUAL(6, counter);
+
+        TaskFunctionTest::counter = 0;
+        cadf::thread::TaskFunction pointer(&TaskFunctionTest::increment);
+        BOOST_CHECK(pointer.isInline());
+        pointer();
+        BOOST_CHECK_EQUAL(1, TaskFunctionTest::counter);
+
+        cadf::thread::TaskFunction bound(std::bind(&TaskFunctionTest::increment));
+        bound();
+        BOOST_CHECK_EQUAL(2, TaskFunctionTest::counter);
+    }
+
+    /**
+     * Verify that move only captures are supported, and that a mutable function retains its state between executions
+     */
+    BOOST_AUTO_TEST_CASE(MoveOnlyAndMutableTest) {
+        std::unique_ptr<int> value = std::make_unique<int>(41);
+        int result = 0;
+        cadf::thread::TaskFunction task([value = std::move(value), &result] () mutable { result = ++(*value); });
+        task();
+        BOOST_CHECK_EQUAL(42, result);
+        task();
+        BOOST_CHECK_EQUAL(43, result);
+    }
+
+    /**
+     * Verify that moving transfers the function (inline or on the heap), leaving the source empty
+     */
+    BOOST_AUTO_TEST_CASE(MoveTest) {
+        int counter = 0;
+        cadf::thread::TaskFunction first([&counter] { counter++; });
+        cadf::thread::TaskFunction second(std::move(first));
+        BOOST_CHECK(!first);
+        BOOST_CHECK(second.isInline());
+        second();
+        BOOST_CHECK_EQUAL(1, counter);
+
+        std::array<char, cadf::thread::TaskFunction::INLINE_SIZE * 2> large = { };
+        cadf::thread::TaskFunction third([&counter, large] { counter += 10 + large[0]; });
+        second = std::move(third);
+        BOOST_CHECK(!third);
+        BOOST_CHECK(!second.isInline());
+        second();
+        BOOST_CHECK_EQUAL(11, counter);
+    }
+
+    /**
+     * Verify that the captures are destroyed exactly once, whether the function is moved, replaced, reset, or destroyed
+     */
+    BOOST_AUTO_TEST_CASE(DestroyCapturesTest) {
+        TaskFunctionTest::Tracked::alive = 0;
+        {
+            TaskFunctionTest::Tracked tracked;
+            cadf::thread::TaskFunction small([tracked] {});
+            std::array<char, cadf::thread::TaskFunction::INLINE_SIZE> padding = { };
+            cadf::thread::TaskFunction big([tracked, padding] {});
+            BOOST_CHECK_EQUAL(3, TaskFunctionTest::Tracked::alive);
+
+            cadf::thread::TaskFunction moved(std::move(small));
+            BOOST_CHECK_EQUAL(3, TaskFunctionTest::Tracked::alive);
+            moved = std::move(big);
+            BOOST_CHECK_EQUAL(2, TaskFunctionTest::Tracked::alive);
+            moved.reset();
+            BOOST_CHECK_EQUAL(1, TaskFunctionTest::Tracked::alive);
+
+            moved = cadf::thread::TaskFunction([tracked] {});
+            BOOST_CHECK_EQUAL(2, TaskFunctionTest::Tracked::alive);
+        }
+        BOOST_CHECK_EQUAL(0, TaskFunctionTest::Tracked::alive);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,127 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "thread/TaskGraph.h"
+#include "thread/BasicThreadPool.h"
+#include "thread/ThreadException.h"
+
+// Test helpers for the TaskGraphTest
+namespace TaskGraphTest {
+    /**
+     * Records the order in which the tasks were executed
+     */
+    struct Recorder {
+            std::mutex mutex;
+            std::vector<int> order;
+
+            void record(int task) {
+                std::unique_lock<std::mutex> lock(mutex);
+                order.push_back(task);
+            }
+
+            size_t positionOf(int task) {
+                std::unique_lock<std::mutex> lock(mutex);
+                for (size_t i = 0; i < order.size(); i++) {
+                    if (order[i] == task)
+                        return i;
+                }
+                return order.size();
+            }
+    };
+}
+
+/**
+ * Test suite for the unit testing of the TaskGraph
+ */
+BOOST_AUTO_TEST_SUITE(TaskGraph_Test_Suite)
+
+    /**
+     * Verify that a task can only depend on tasks which are already in the graph
+     */
+    BOOST_AUTO_TEST_CASE(InvalidDependencyTest) {
+        cadf::thread::TaskGraph graph;
+        cadf::thread::TaskGraph::TaskId first = graph.add([] {});
+        BOOST_CHECK_EQUAL(0, first);
+        BOOST_CHECK_THROW(graph.add([] {}, { 1 }), cadf::thread::TaskGraphException);
+        BOOST_CHECK_THROW(graph.add([] {}, { first, 5 }), cadf::thread::TaskGraphException);
+        BOOST_CHECK_EQUAL(1, graph.size());
+    }
+
+    /**
+     * Verify that an empty graph completes immediately
+     */
+    BOOST_AUTO_TEST_CASE(EmptyGraphTest) {
+        cadf::thread::BasicThreadPool pool(1);
+        cadf::thread::TaskGraph graph;
+        BOOST_CHECK(graph.run(pool).isReady());
+    }
+
+    /**
+     * Verify that each task executes exactly once, and only after all of its dependencies
+     */
+    BOOST_AUTO_TEST_CASE(DependencyOrderTest) {
+        cadf::thread::BasicThreadPool pool(4);
+        TaskGraphTest::Recorder recorder;
+        cadf::thread::TaskGraph graph;
+
+        // Diamond: 0 -> (1, 2, 3) -> 4, then 5 after 4 and 2
+        cadf::thread::TaskGraph::TaskId source = graph.add([&recorder] { recorder.record(0); });
+        std::vector<cadf::thread::TaskGraph::TaskId> parts;
+        for (int i = 1; i <= 3; i++)
+            parts.push_back(graph.add([&recorder, i] { recorder.record(i); }, { source }));
+        cadf::thread::TaskGraph::TaskId merge = graph.add([&recorder] { recorder.record(4); }, parts);
+        graph.add([&recorder] { recorder.record(5); }, { merge, parts[1] });
+        BOOST_CHECK_EQUAL(6, graph.size());
+
+        graph.run(pool).get();
+        BOOST_CHECK_EQUAL(0, graph.size());
+        BOOST_REQUIRE_EQUAL(6, recorder.order.size());
+        BOOST_CHECK_EQUAL(0, recorder.positionOf(0));
+        for (int i = 1; i <= 3; i++)
+            BOOST_CHECK(recorder.positionOf(i) < recorder.positionOf(4));
+        BOOST_CHECK_EQUAL(5, recorder.positionOf(5));
+    }
+
+    /**
+     * Verify a wide fan out and fan in
+     */
+    BOOST_AUTO_TEST_CASE(FanOutFanInTest) {
+        cadf::thread::BasicThreadPool pool(4);
+        std::atomic<int> sum(0);
+        int total = -1;
+        cadf::thread::TaskGraph graph;
+
+        std::vector<cadf::thread::TaskGraph::TaskId> parts;
+        for (int i = 1; i <= 100; i++)
+            parts.push_back(graph.add([&sum, i] { sum += i; }));
+        graph.add([&sum, &total] { total = sum.load(); }, parts);
+
+        graph.run(pool).get();
+        BOOST_CHECK_EQUAL(5050, total);
+    }
+
+    /**
+     * Verify that once a task throws, its dependents are skipped and the run fails with its exception
+     */
+    BOOST_AUTO_TEST_CASE(FailureTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        std::atomic<int> executed(0);
+        cadf::thread::TaskGraph graph;
+
+        cadf::thread::TaskGraph::TaskId first = graph.add([&executed] { executed++; });
+        cadf::thread::TaskGraph::TaskId failing = graph.add([] { throw std::runtime_error("failed"); }, { first });
+        graph.add([&executed] { executed++; }, { failing });
+
+        cadf::thread::Future<void> result = graph.run(pool);
+        BOOST_CHECK_THROW(result.get(), std::runtime_error);
+        BOOST_CHECK_EQUAL(1, executed.load());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
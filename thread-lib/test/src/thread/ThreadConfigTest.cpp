@@ -0,0 +1,227 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "thread/ThreadConfig.h"
+#include "thread/Thread.h"
+#include "thread/BasicThreadPool.h"
+#include "thread/ThreadException.h"
+
+// Test helpers for the ThreadConfigTest
+namespace ThreadConfigTest {
+    /**
+     * Thread which executes the function once
+     */
+    class FunctionThread: public cadf::thread::OneShotThread {
+        public:
+            FunctionThread(std::function<void()> func, const cadf::thread::ThreadConfig &config) : OneShotThread(config), m_func(func) {
+            }
+
+            ~FunctionThread() {
+                stop();
+            }
+
+        protected:
+            void exec() {
+                m_func();
+            }
+
+            void scheduleStop() {
+            }
+
+        private:
+            std::function<void()> m_func;
+    };
+
+    /**
+     * The name of the calling thread
+     */
+    std::string currentName() {
+        char name[16] = { };
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        return name;
+    }
+
+    /**
+     * The CPUs on which the calling thread may run
+     */
+    std::set<int> currentCpus() {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+        std::set<int> cpus;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set))
+                cpus.insert(cpu);
+        }
+        return cpus;
+    }
+
+    /**
+     * Execute the function within a Thread with the configuration, returning what it returns
+     */
+    template<typename T>
+    T runIn(const cadf::thread::ThreadConfig &config, std::function<T()> func) {
+        std::promise<T> result;
+        FunctionThread thread([&] { result.set_value(func()); }, config);
+        thread.start();
+        return result.get_future().get();
+    }
+}
+
+/**
+ * Test suite for the unit testing of the ThreadConfig
+ */
+BOOST_AUTO_TEST_SUITE(ThreadConfig_Test_Suite)
+
+    /**
+     * Verify that the default configuration leaves everything as inherited
+     */
+    BOOST_AUTO_TEST_CASE(DefaultTest) {
+        std::set<int> cpus = ThreadConfigTest::currentCpus();
+        int policy = sched_getscheduler(0);
+        BOOST_CHECK(cpus == ThreadConfigTest::runIn<std::set<int>>(cadf::thread::ThreadConfig(), ThreadConfigTest::currentCpus));
+        BOOST_CHECK_EQUAL(policy, ThreadConfigTest::runIn<int>(cadf::thread::ThreadConfig(), [] { return sched_getscheduler(0); }));
+    }
+
+    /**
+     * Verify that the thread is named, truncating names which are too long
+     */
+    BOOST_AUTO_TEST_CASE(NameTest) {
+        cadf::thread::ThreadConfig config;
+        config.name = "bus-reader";
+        BOOST_CHECK_EQUAL("bus-reader", ThreadConfigTest::runIn<std::string>(config, ThreadConfigTest::currentName));
+
+        config.name = "a-very-long-thread-name";
+        BOOST_CHECK_EQUAL("a-very-long-thr", ThreadConfigTest::runIn<std::string>(config, ThreadConfigTest::currentName));
+    }
+
+    /**
+     * Verify that a name which is too long is truncated such that the index of the thread within its pool is retained
+     */
+    BOOST_AUTO_TEST_CASE(LongPoolNameTest) {
+        cadf::thread::ThreadConfig config;
+        config.name = "a-very-long-thread-name";
+        std::pair<int, std::string> expected[] = { { 3, "a-very-long-t-3" }, { 12, "a-very-long--12" } };
+        for (const std::pair<int, std::string> &thread : expected) {
+            std::string name;
+            std::thread([&] {
+                config.applyToCurrentThread(thread.first);
+                name = ThreadConfigTest::currentName();
+            }).join();
+            BOOST_CHECK_EQUAL(thread.second, name);
+        }
+    }
+
+    /**
+     * Verify that the threads of a pool are named and pinned by their index
+     */
+    BOOST_AUTO_TEST_CASE(PoolTest) {
+        cadf::thread::ThreadConfig config;
+        config.name = "pool";
+        config.cpus = { 0 };
+        config.pinEach = true;
+
+        std::mutex mutex;
+        std::set<std::string> names;
+        std::set<int> cpus;
+        cadf::thread::BasicThreadPool pool(2, true, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, config);
+        std::promise<void> done[2];
+        std::shared_future<void> reported[2] = { done[0].get_future().share(), done[1].get_future().share() };
+        for (int i = 0; i < 2; i++) {
+            // Block each thread until both have reported, so that each of them reports once
+            pool.schedule([&, i] {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    names.insert(ThreadConfigTest::currentName());
+                    std::set<int> current = ThreadConfigTest::currentCpus();
+                    cpus.insert(current.begin(), current.end());
+                }
+                done[i].set_value();
+                reported[1 - i].wait();
+            });
+        }
+        reported[0].wait();
+        reported[1].wait();
+        pool.stop();
+
+        BOOST_CHECK(names == std::set<std::string>({ "pool-0", "pool-1" }));
+        BOOST_CHECK(cpus == std::set<int>({ 0 }));
+    }
+
+    /**
+     * Verify the restriction to the CPUs of a NUMA node
+     */
+    BOOST_AUTO_TEST_CASE(NumaNodeTest) {
+        std::vector<int> nodeCpus = cadf::thread::ThreadConfig::cpusOfNumaNode(0);
+        BOOST_REQUIRE(!nodeCpus.empty());
+        BOOST_CHECK_THROW(cadf::thread::ThreadConfig::cpusOfNumaNode(100000), cadf::thread::ThreadInitializationException);
+
+        cadf::thread::ThreadConfig config;
+        config.numaNode = 0;
+        std::set<int> cpus = ThreadConfigTest::runIn<std::set<int>>(config, ThreadConfigTest::currentCpus);
+        for (int cpu : cpus)
+            BOOST_CHECK(std::find(nodeCpus.begin(), nodeCpus.end(), cpu) != nodeCpus.end());
+    }
+
+    /**
+     * Verify the scheduling policies which do not require any privileges
+     */
+    BOOST_AUTO_TEST_CASE(PolicyTest) {
+        cadf::thread::ThreadConfig config;
+        config.policy = cadf::thread::ThreadConfig::Policy::BATCH;
+        config.priority = 5;
+        BOOST_CHECK_EQUAL(SCHED_BATCH, ThreadConfigTest::runIn<int>(config, [] { return sched_getscheduler(0); }));
+        BOOST_CHECK_EQUAL(5, ThreadConfigTest::runIn<int>(config, [] { return getpriority(PRIO_PROCESS, syscall(SYS_gettid)); }));
+
+        config.policy = cadf::thread::ThreadConfig::Policy::IDLE;
+        config.priority = 0;
+        BOOST_CHECK_EQUAL(SCHED_IDLE, ThreadConfigTest::runIn<int>(config, [] { return sched_getscheduler(0); }));
+    }
+
+    /**
+     * Verify that when the configuration cannot be applied, the thread (or pool) does not start
+     */
+    BOOST_AUTO_TEST_CASE(InvalidConfigTest) {
+        bool executed = false;
+        cadf::thread::ThreadConfig invalidCpu;
+        invalidCpu.cpus = { -1 };
+        ThreadConfigTest::FunctionThread thread([&executed] { executed = true; }, invalidCpu);
+        BOOST_CHECK_THROW(thread.start(), cadf::thread::ThreadInitializationException);
+        BOOST_CHECK(!thread.isAlive());
+        BOOST_CHECK(!executed);
+
+        cadf::thread::ThreadConfig invalidPriority;
+        invalidPriority.policy = cadf::thread::ThreadConfig::Policy::FIFO;
+        invalidPriority.priority = 0;
+        BOOST_CHECK_THROW(cadf::thread::BasicThreadPool(2, true, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, invalidPriority),
+                cadf::thread::ThreadInitializationException);
+
+        cadf::thread::BasicThreadPool pool(2, false, cadf::thread::BasicThreadPool::QueueType::MUTEX, 1024, invalidPriority);
+        BOOST_CHECK_THROW(pool.start(), cadf::thread::ThreadInitializationException);
+        BOOST_CHECK(!pool.isStarted());
+
+        cadf::thread::ThreadConfig invalidNice;
+        invalidNice.policy = cadf::thread::ThreadConfig::Policy::OTHER;
+        invalidNice.priority = 20;
+        BOOST_CHECK(cadf::thread::ThreadConfig().startThreads(0, [](unsigned int) {}).empty());
+        BOOST_CHECK_THROW(invalidNice.startThreads(3, [](unsigned int) {
+            BOOST_FAIL("Must not be executed");
+        }), cadf::thread::ThreadInitializationException);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
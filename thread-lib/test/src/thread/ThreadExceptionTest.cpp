@@ -19,4 +19,12 @@ BOOST_AUTO_TEST_SUITE(ThreadException_Test_Suite)
         BOOST_CHECK_EQUAL("Unable to perform thread initialization: This is some error message", cadf::thread::ThreadInitializationException("This is some error message").what());
     }
 
+    /**
+     * Verify the message of the TaskGraphException
+     */
+    BOOST_AUTO_TEST_CASE(TaskGraphExceptionTest) {
+        BOOST_CHECK_EQUAL("Invalid task graph: SOMETHING", cadf::thread::TaskGraphException("SOMETHING").what());
+        BOOST_CHECK_EQUAL("Invalid task graph: This is some error message", cadf::thread::TaskGraphException("This is some error message").what());
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,75 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+
+#include "thread/ThreadPoolMetrics.h"
+
+/**
+ * Test suite for the unit testing of the ThreadPoolMetrics
+ */
+BOOST_AUTO_TEST_SUITE(ThreadPoolMetrics_Test_Suite)
+
+    /**
+     * Verify the bucket into which durations fall, and the bounds of the buckets
+     */
+    BOOST_AUTO_TEST_CASE(BucketTest) {
+        BOOST_CHECK_EQUAL(0, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(-5)));
+        BOOST_CHECK_EQUAL(0, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(0)));
+        BOOST_CHECK_EQUAL(1, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(1)));
+        BOOST_CHECK_EQUAL(2, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(2)));
+        BOOST_CHECK_EQUAL(2, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(3)));
+        BOOST_CHECK_EQUAL(3, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(4)));
+        BOOST_CHECK_EQUAL(cadf::thread::DurationHistogram::BUCKETS - 1, cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds::max()));
+
+        BOOST_CHECK(std::chrono::nanoseconds(1) == cadf::thread::DurationHistogram::upperBound(0));
+        BOOST_CHECK(std::chrono::nanoseconds(4) == cadf::thread::DurationHistogram::upperBound(2));
+        BOOST_CHECK(std::chrono::nanoseconds::max() == cadf::thread::DurationHistogram::upperBound(cadf::thread::DurationHistogram::BUCKETS - 1));
+
+        // Every duration is below the upper bound of its bucket, and at least that of the previous bucket
+        for (int64_t ns : { 1, 7, 1000, 999999, 123456789 }) {
+            unsigned int bucket = cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(ns));
+            BOOST_CHECK(std::chrono::nanoseconds(ns) < cadf::thread::DurationHistogram::upperBound(bucket));
+            BOOST_CHECK(std::chrono::nanoseconds(ns) >= cadf::thread::DurationHistogram::upperBound(bucket - 1));
+        }
+    }
+
+    /**
+     * Verify the count, mean and percentiles of a histogram
+     */
+    BOOST_AUTO_TEST_CASE(HistogramTest) {
+        cadf::thread::DurationHistogram histogram;
+        BOOST_CHECK_EQUAL(0, histogram.count());
+        BOOST_CHECK(std::chrono::nanoseconds::zero() == histogram.mean());
+        BOOST_CHECK(std::chrono::nanoseconds::zero() == histogram.percentile(0.5));
+
+        // 90 durations of 100 ns and 10 of 10 us
+        histogram.counts[cadf::thread::DurationHistogram::bucketOf(std::chrono::nanoseconds(100))] = 90;
+        histogram.counts[cadf::thread::DurationHistogram::bucketOf(std::chrono::microseconds(10))] = 10;
+        histogram.total = std::chrono::nanoseconds(90 * 100 + 10 * 10000);
+        BOOST_CHECK_EQUAL(100, histogram.count());
+        BOOST_CHECK(std::chrono::nanoseconds(1090) == histogram.mean());
+        BOOST_CHECK(std::chrono::nanoseconds(128) == histogram.percentile(0));
+        BOOST_CHECK(std::chrono::nanoseconds(128) == histogram.percentile(0.9));
+        BOOST_CHECK(std::chrono::nanoseconds(16384) == histogram.percentile(0.91));
+        BOOST_CHECK(std::chrono::nanoseconds(16384) == histogram.percentile(1));
+    }
+
+    /**
+     * Verify the utilization across the workers
+     */
+    BOOST_AUTO_TEST_CASE(UtilizationTest) {
+        cadf::thread::ThreadPoolMetrics metrics;
+        BOOST_CHECK_EQUAL(0, metrics.utilization());
+
+        metrics.workers.resize(2);
+        metrics.workers[0].busy = std::chrono::milliseconds(30);
+        metrics.workers[0].idle = std::chrono::milliseconds(70);
+        metrics.workers[1].busy = std::chrono::milliseconds(50);
+        metrics.workers[1].idle = std::chrono::milliseconds(50);
+        BOOST_CHECK_CLOSE(0.4, metrics.utilization(), 0.0001);
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -3,7 +3,9 @@
 #   define BOOST_TEST_MODULE Main
 #endif
 #include <boost/test/unit_test.hpp>
+#include <csignal>
 #include <thread>
+#include <unistd.h>
 
 #include "thread/Thread.h"
 #include "thread/ThreadException.h"
@@ -44,6 +46,43 @@ namespace ThreadTest {
             }
     };
 
+    /**
+     * Looping thread which blocks reading from a pipe to which nothing is written, or sleeping for a long time
+     */
+    class BlockingThread: public cadf::thread::LoopingThread {
+        public:
+            BlockingThread(bool sleep) : m_sleep(sleep) {
+                BOOST_REQUIRE_EQUAL(0, pipe(m_fds));
+            }
+
+            ~BlockingThread() {
+                stop();
+                close(m_fds[0]);
+                close(m_fds[1]);
+            }
+
+        protected:
+            virtual void execLoop() {
+                if (m_sleep) {
+                    ssleep(10);
+                } else if (getCancellationToken().waitFor(m_fds[0])) {
+                    char c;
+                    BOOST_CHECK(read(m_fds[0], &c, 1) > 0);
+                }
+            }
+
+        private:
+            bool m_sleep;
+            int m_fds[2];
+    };
+
+    /** The number of SIGINT received */
+    volatile sig_atomic_t numInterrupts = 0;
+
+    void countInterrupt(int) {
+        numInterrupts++;
+    }
+
     struct TimedTest {
             TimedTest() {
                 m_start = std::chrono::high_resolution_clock::now();
@@ -360,4 +399,23 @@ BOOST_AUTO_TEST_SUITE(Thread_Test_Suite)
         BOOST_CHECK(!thread.isAlive());
     }
 
+    /**
+     * Verify that threads blocked waiting on their cancellation token (or sleeping) are stopped promptly, without any signal being raised
+     */
+    BOOST_FIXTURE_TEST_CASE(StopBlockedThreadTest, ThreadTest::TimedTest) {
+        void (*previous)(int) = std::signal(SIGINT, ThreadTest::countInterrupt);
+        for (bool sleep : { false, true }) {
+            ThreadTest::BlockingThread thread(sleep);
+            for (int i = 0; i < 2; i++) {
+                thread.start();
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                BOOST_CHECK(thread.isAlive());
+                thread.stop();
+                BOOST_CHECK(!thread.isAlive());
+            }
+        }
+        std::signal(SIGINT, previous);
+        BOOST_CHECK_EQUAL(0, ThreadTest::numInterrupts);
+    }
+
     BOOST_AUTO_TEST_SUITE_END()
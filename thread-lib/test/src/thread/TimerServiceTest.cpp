@@ -0,0 +1,198 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "thread/TimerService.h"
+#include "thread/BasicThreadPool.h"
+#include "thread/ThreadException.h"
+
+// Test helpers for the TimerServiceTest
+namespace TimerServiceTest {
+    /**
+     * Wait (up to a second) for the counter to reach the expected value
+     */
+    bool waitFor(const std::atomic<int> &counter, int expected) {
+        for (int i = 0; i < 1000 && counter.load() < expected; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return counter.load() >= expected;
+    }
+}
+
+/**
+ * Test suite for the unit testing of the TimerService
+ */
+BOOST_AUTO_TEST_SUITE(TimerService_Test_Suite)
+
+    /**
+     * Verify that the resolution and period must be positive
+     */
+    BOOST_AUTO_TEST_CASE(InvalidArgumentsTest) {
+        cadf::thread::BasicThreadPool pool(1);
+        BOOST_CHECK_THROW(cadf::thread::TimerService(&pool, std::chrono::nanoseconds(0)), cadf::thread::ThreadInitializationException);
+
+        cadf::thread::TimerService timers(&pool);
+        BOOST_CHECK_THROW(timers.scheduleEvery(std::chrono::milliseconds(0), [] {}), std::invalid_argument);
+    }
+
+    /**
+     * Verify that a one shot timer is executed once, and not before it is due
+     */
+    BOOST_AUTO_TEST_CASE(ScheduleAfterTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        cadf::thread::TimerService timers(&pool);
+        std::atomic<int> counter(0);
+        std::chrono::steady_clock::time_point executedAt;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        timers.scheduleAfter(std::chrono::milliseconds(20), [&] {
+            executedAt = std::chrono::steady_clock::now();
+            counter++;
+        });
+        BOOST_CHECK_EQUAL(1, timers.size());
+        BOOST_REQUIRE(TimerServiceTest::waitFor(counter, 1));
+        BOOST_CHECK(executedAt - start >= std::chrono::milliseconds(20));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        BOOST_CHECK_EQUAL(1, counter.load());
+        BOOST_CHECK_EQUAL(0, timers.size());
+    }
+
+    /**
+     * Verify that timers at a time which has already passed are executed immediately
+     */
+    BOOST_AUTO_TEST_CASE(ScheduleAtTest) {
+        cadf::thread::BasicThreadPool pool(1);
+        cadf::thread::TimerService timers(&pool);
+        std::atomic<int> counter(0);
+
+        timers.scheduleAt(std::chrono::steady_clock::now() - std::chrono::seconds(1), [&counter] { counter++; });
+        timers.scheduleAt(std::chrono::steady_clock::now() + std::chrono::milliseconds(5), [&counter] { counter++; });
+        BOOST_CHECK(TimerServiceTest::waitFor(counter, 2));
+    }
+
+    /**
+     * Verify that cancelled timers are not executed, and that only pending timers can be cancelled
+     */
+    BOOST_AUTO_TEST_CASE(CancelTest) {
+        cadf::thread::BasicThreadPool pool(1);
+        cadf::thread::TimerService timers(&pool);
+        std::atomic<int> cancelled(0);
+        std::atomic<int> executed(0);
+
+        cadf::thread::TimerService::TimerId first = timers.scheduleAfter(std::chrono::milliseconds(10), [&cancelled] { cancelled++; });
+        cadf::thread::TimerService::TimerId second = timers.scheduleAfter(std::chrono::milliseconds(5), [&executed] { executed++; });
+        BOOST_CHECK(first != second);
+        BOOST_CHECK(timers.cancel(first));
+        BOOST_CHECK(!timers.cancel(first));
+        BOOST_CHECK(!timers.cancel(12345));
+
+        BOOST_REQUIRE(TimerServiceTest::waitFor(executed, 1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        BOOST_CHECK_EQUAL(0, cancelled.load());
+        BOOST_CHECK(!timers.cancel(second));
+    }
+
+    /**
+     * Verify that a periodic timer is executed repeatedly until cancelled
+     */
+    BOOST_AUTO_TEST_CASE(ScheduleEveryTest) {
+        cadf::thread::BasicThreadPool pool(1);
+        cadf::thread::TimerService timers(&pool);
+        std::atomic<int> counter(0);
+
+        cadf::thread::TimerService::TimerId id = timers.scheduleEvery(std::chrono::milliseconds(5), [&counter] { counter++; });
+        BOOST_REQUIRE(TimerServiceTest::waitFor(counter, 5));
+        BOOST_CHECK(timers.cancel(id));
+        BOOST_CHECK_EQUAL(0, timers.size());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        int afterCancel = counter.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        BOOST_CHECK_EQUAL(afterCancel, counter.load());
+    }
+
+    /**
+     * Verify that an execution of a periodic timer is skipped while the previous one is still running
+     */
+    BOOST_AUTO_TEST_CASE(OverrunTest) {
+        cadf::thread::BasicThreadPool pool(4);
+        cadf::thread::TimerService timers(&pool);
+        std::atomic<int> running(0);
+        std::atomic<int> maxRunning(0);
+        std::atomic<int> counter(0);
+
+        timers.scheduleEvery(std::chrono::milliseconds(1), [&] {
+            int now = ++running;
+            if (now > maxRunning)
+                maxRunning = now;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            running--;
+            counter++;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(55));
+        BOOST_CHECK_EQUAL(1, maxRunning.load());
+        BOOST_CHECK(counter.load() <= 6);
+    }
+
+    /**
+     * Verify that many timers, spread across several wheels with a fine resolution, are all executed and none of them early
+     */
+    BOOST_AUTO_TEST_CASE(ManyTimersTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        cadf::thread::TimerService timers(&pool, std::chrono::microseconds(1));
+        std::atomic<int> counter(0);
+        std::atomic<int> early(0);
+        std::mt19937 random(42);
+
+        const int numTimers = 1000;
+        for (int i = 0; i < numTimers; i++) {
+            // Up to 300 ms, which at 1 us per tick is beyond the range of the third wheel
+            std::chrono::microseconds delay((i == 0) ? 300000 : random() % 300000);
+            std::chrono::steady_clock::time_point due = std::chrono::steady_clock::now() + delay;
+            timers.scheduleAt(due, [&counter, &early, due] {
+                if (std::chrono::steady_clock::now() < due)
+                    early++;
+                counter++;
+            });
+        }
+
+        BOOST_CHECK(TimerServiceTest::waitFor(counter, numTimers));
+        BOOST_CHECK_EQUAL(0, early.load());
+        BOOST_CHECK_EQUAL(0, timers.size());
+    }
+
+    /**
+     * Verify that a timer added after the wheel has been idle for many ticks is executed on time, rather than once the wheel has
+     * caught up on the idle ticks
+     */
+    BOOST_AUTO_TEST_CASE(AfterIdleTest) {
+        cadf::thread::BasicThreadPool pool(2);
+        cadf::thread::TimerService timers(&pool, std::chrono::nanoseconds(10));
+        std::atomic<int> counter(0);
+        std::chrono::steady_clock::time_point executedAt;
+
+        timers.scheduleAfter(std::chrono::milliseconds(1), [&counter] { counter++; });
+        BOOST_REQUIRE(TimerServiceTest::waitFor(counter, 1));
+
+        // 50 million ticks without any timers
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        timers.scheduleAfter(std::chrono::milliseconds(10), [&] {
+            executedAt = std::chrono::steady_clock::now();
+            counter++;
+        });
+        BOOST_REQUIRE(TimerServiceTest::waitFor(counter, 2));
+        BOOST_CHECK(executedAt - start >= std::chrono::milliseconds(10));
+        BOOST_CHECK(executedAt - start < std::chrono::milliseconds(100));
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "thread/WorkStealingDeque.h"
+
+/**
+ * Test suite for the unit testing of the WorkStealingDeque
+ */
+BOOST_AUTO_TEST_SUITE(WorkStealingDeque_Test_Suite)
+
+    /**
+     * Verify that the owner takes the newest item, while thieves take the oldest
+     */
+    BOOST_AUTO_TEST_CASE(PopAndStealOrderTest) {
+        int values[] = { 0, 1, 2, 3 };
+        cadf::thread::WorkStealingDeque<int> deque;
+        BOOST_CHECK(deque.empty());
+        BOOST_CHECK(deque.pop() == nullptr);
+        BOOST_CHECK(deque.steal() == nullptr);
+
+        for (int &value : values)
+            deque.push(&value);
+        BOOST_CHECK_EQUAL(4, deque.size());
+        BOOST_CHECK_EQUAL(&values[3], deque.pop());
+        BOOST_CHECK_EQUAL(&values[0], deque.steal());
+        BOOST_CHECK_EQUAL(&values[2], deque.pop());
+        BOOST_CHECK_EQUAL(&values[1], deque.steal());
+        BOOST_CHECK(deque.empty());
+        BOOST_CHECK(deque.pop() == nullptr);
+        BOOST_CHECK(deque.steal() == nullptr);
+    }
+
+    /**
+     * Verify that the deque grows beyond its initial capacity, retaining the order of the items
+     */
+    BOOST_AUTO_TEST_CASE(GrowTest) {
+        std::vector<int> values(100);
+        cadf::thread::WorkStealingDeque<int> deque(2);
+        for (int &value : values)
+            deque.push(&value);
+        BOOST_CHECK_EQUAL(100, deque.size());
+
+        for (size_t i = 0; i < 50; i++)
+            BOOST_CHECK_EQUAL(&values[i], deque.steal());
+        for (size_t i = 100; i > 50; i--)
+            BOOST_CHECK_EQUAL(&values[i - 1], deque.pop());
+        BOOST_CHECK(deque.empty());
+    }
+
+    /**
+     * Verify that with the owner and several thieves racing for the items, each item is taken exactly once
+     */
+    BOOST_AUTO_TEST_CASE(ConcurrentStealTest) {
+        const int numItems = 100000;
+        std::vector<int> values(numItems, 0);
+        std::vector<std::atomic<int>> taken(numItems);
+        cadf::thread::WorkStealingDeque<int> deque(16);
+        std::atomic<bool> done(false);
+
+        auto take = [&values, &taken](int *item) {
+            taken[item - values.data()]++;
+        };
+
+        std::vector<std::thread> thieves;
+        for (int i = 0; i < 3; i++) {
+            thieves.emplace_back([&deque, &done, &take] {
+                while (!done || !deque.empty()) {
+                    if (int *item = deque.steal())
+                        take(item);
+                }
+            });
+        }
+
+        for (int i = 0; i < numItems; i++) {
+            deque.push(&values[i]);
+            if (i % 3 == 0) {
+                if (int *item = deque.pop())
+                    take(item);
+            }
+        }
+        while (int *item = deque.pop())
+            take(item);
+        done = true;
+        for (std::thread &thief : thieves)
+            thief.join();
+
+        for (int i = 0; i < numItems; i++)
+            BOOST_REQUIRE_EQUAL(1, taken[i].load());
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()
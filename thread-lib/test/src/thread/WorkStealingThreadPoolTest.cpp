@@ -0,0 +1,127 @@
+#define BOOST_TEST_DYN_LINK
+#ifdef STAND_ALONE
+#   define BOOST_TEST_MODULE Main
+#endif
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+
+#include "thread/WorkStealingThreadPool.h"
+#include "thread/ThreadException.h"
+
+// Test helpers for the WorkStealingThreadPoolTest
+namespace WorkStealingThreadPoolTest {
+    /**
+     * Wait (up to a second) for the counter to reach the expected value
+     */
+    bool waitFor(const std::atomic<int> &counter, int expected) {
+        for (int i = 0; i < 1000 && counter.load() != expected; i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return counter.load() == expected;
+    }
+
+    /**
+     * Recursively split the range, counting each leaf
+     */
+    void split(cadf::thread::IThreadPool *pool, std::atomic<int> *counter, int size) {
+        if (size == 1) {
+            (*counter)++;
+            return;
+        }
+        pool->schedule([pool, counter, size] { split(pool, counter, size / 2); });
+        pool->schedule([pool, counter, size] { split(pool, counter, size - size / 2); });
+    }
+}
+
+/**
+ * Test suite for the unit testing of the WorkStealingThreadPool
+ */
+BOOST_AUTO_TEST_SUITE(WorkStealingThreadPool_Test_Suite)
+
+    /**
+     * Verify that if an invalid number of threads is specified, an exception is thrown
+     */
+    BOOST_AUTO_TEST_CASE(InvalidInitializationTest) {
+        BOOST_REQUIRE_THROW(cadf::thread::WorkStealingThreadPool(0), cadf::thread::ThreadInitializationException);
+    }
+
+    /**
+     * Verify that the pool is not started if auto initialize is set to false, and can be restarted
+     */
+    BOOST_AUTO_TEST_CASE(NoAutoInitializationTest) {
+        cadf::thread::WorkStealingThreadPool p(2, false);
+        BOOST_CHECK_EQUAL(false, p.isStarted());
+
+        p.start();
+        BOOST_CHECK_EQUAL(true, p.isStarted());
+        p.stop();
+        BOOST_CHECK_EQUAL(false, p.isStarted());
+
+        std::atomic<int> counter(0);
+        p.schedule([&counter] { counter++; });
+        p.start();
+        BOOST_CHECK(WorkStealingThreadPoolTest::waitFor(counter, 1));
+    }
+
+    /**
+     * Verify that functions scheduled from outside of the pool are all executed, across all threads
+     */
+    BOOST_AUTO_TEST_CASE(ExternalScheduleTest) {
+        std::atomic<int> counter(0);
+        std::mutex idsMutex;
+        std::set<std::thread::id> ids;
+        cadf::thread::WorkStealingThreadPool p(4);
+
+        for (int i = 0; i < 1000; i++) {
+            p.schedule([&] {
+                std::unique_lock<std::mutex> lock(idsMutex);
+                ids.insert(std::this_thread::get_id());
+                counter++;
+            });
+        }
+        BOOST_CHECK(WorkStealingThreadPoolTest::waitFor(counter, 1000));
+        std::unique_lock<std::mutex> lock(idsMutex);
+        BOOST_CHECK(ids.count(std::this_thread::get_id()) == 0);
+    }
+
+    /**
+     * Verify that functions scheduled prior to starting are executed on start
+     */
+    BOOST_AUTO_TEST_CASE(ScheduleForExecutionWhenNotStartedTest) {
+        std::atomic<int> counter(0);
+        cadf::thread::WorkStealingThreadPool p(3, false);
+        for (int i = 0; i < 3; i++)
+            p.schedule([&counter] { counter++; });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        BOOST_CHECK_EQUAL(0, counter.load());
+
+        p.start();
+        BOOST_CHECK(WorkStealingThreadPoolTest::waitFor(counter, 3));
+    }
+
+    /**
+     * Verify that work scheduled from within the pool is spread across the threads via stealing
+     */
+    BOOST_AUTO_TEST_CASE(NestedScheduleTest) {
+        std::atomic<int> counter(0);
+        cadf::thread::WorkStealingThreadPool p(4);
+        p.schedule([&p, &counter] { WorkStealingThreadPoolTest::split(&p, &counter, 10000); });
+        BOOST_CHECK(WorkStealingThreadPoolTest::waitFor(counter, 10000));
+    }
+
+    /**
+     * Verify that parked threads are woken for work which is scheduled after they went idle
+     */
+    BOOST_AUTO_TEST_CASE(WakeAfterIdleTest) {
+        std::atomic<int> counter(0);
+        cadf::thread::WorkStealingThreadPool p(2);
+        for (int i = 1; i <= 5; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            p.schedule([&counter] { counter++; });
+            BOOST_CHECK(WorkStealingThreadPoolTest::waitFor(counter, i));
+        }
+    }
+
+    BOOST_AUTO_TEST_SUITE_END()